@@ -84,6 +84,33 @@ function(add_cpp_test)
 endfunction()
 
 
+##------------------------------------------------------------------------------
+## - Builds a benchmark that uses gtest. Benchmarks are not added to ctest,
+##   they are run directly from the build tree.
+##
+## add_cpp_benchmark( BENCHMARK benchmark DEPENDS_ON dep1 dep2 ... )
+##------------------------------------------------------------------------------
+function(add_cpp_benchmark)
+
+    set(options)
+    set(singleValueArgs BENCHMARK)
+    set(multiValueArgs DEPENDS_ON)
+
+    # parse our arguments
+    cmake_parse_arguments(arg
+                         "${options}"
+                         "${singleValueArgs}"
+                         "${multiValueArgs}" ${ARGN} )
+
+    message(STATUS " [*] Adding Benchmark: ${arg_BENCHMARK} ")
+
+    add_executable( ${arg_BENCHMARK} ${arg_BENCHMARK}.cpp)
+
+    target_link_libraries( ${arg_BENCHMARK} ${UNIT_TEST_BASE_LIBS})
+    target_link_libraries( ${arg_BENCHMARK} "${arg_DEPENDS_ON}" )
+
+endfunction()
+
 ##------------------------------------------------------------------------------
 ## - Builds and adds a test that uses gtest and mpi
 ##
@@ -55,6 +55,17 @@
 #include "conduit_blueprint_mesh.hpp"
 #include "conduit_blueprint_utils.hpp"
 
+//-----------------------------------------------------------------------------
+// std lib includes
+//-----------------------------------------------------------------------------
+#include <map>
+#include <sstream>
+#include <vector>
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+#include <pthread.h>
+#endif
+
 using namespace conduit;
 // access verify logging helpers
 using namespace conduit::blueprint::utils;
@@ -307,6 +318,1040 @@ mesh::verify(const Node &n,
 }
 
 
+//-----------------------------------------------------------------------------
+// -- deep verify helpers --
+//-----------------------------------------------------------------------------
+
+// number of array entries checked by each deep verify work item
+static const index_t DEEP_VERIFY_CHUNK_SIZE = 1 << 16;
+
+//---------------------------------------------------------------------------//
+// a bounds check of an integer array, logged to info when it fails
+//---------------------------------------------------------------------------//
+struct DeepVerifyCheck
+{
+    const Node          *values;
+    int64                min_val;
+    int64                max_val;
+    std::string          desc;
+    Node                *info;
+    std::string          proto_name;
+};
+
+//---------------------------------------------------------------------------//
+// a range of a check's values, these are checked in parallel
+//---------------------------------------------------------------------------//
+struct DeepVerifyChunk
+{
+    index_t              check;
+    index_t              begin;
+    index_t              end;
+    // number of violations, and the first max_errors of them
+    index_t              num_errors;
+    std::vector<index_t> error_idxs;
+    std::vector<int64>   error_vals;
+};
+
+//---------------------------------------------------------------------------//
+// work shared by the deep verify threads
+//---------------------------------------------------------------------------//
+struct DeepVerifyWork
+{
+    const std::vector<DeepVerifyCheck>  *checks;
+    std::vector<DeepVerifyChunk>        *chunks;
+    index_t                              max_errors;
+    index_t                              next_chunk;
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    pthread_mutex_t                      mutex;
+#endif
+};
+
+//---------------------------------------------------------------------------//
+template<typename T>
+static index_t
+deep_verify_count_out_of_range(const uint8 *ptr,
+                               index_t stride,
+                               index_t begin,
+                               index_t end,
+                               int64 min_val,
+                               int64 max_val)
+{
+    index_t res = 0;
+    if(stride == (index_t)sizeof(T))
+    {
+        // contiguous and branch free, so the compiler can vectorize it
+        const T *vals = (const T*)ptr;
+        for(index_t i = begin; i < end; i++)
+        {
+            int64 val = (int64)vals[i];
+            res += (val < min_val) | (val > max_val);
+        }
+    }
+    else
+    {
+        for(index_t i = begin; i < end; i++)
+        {
+            int64 val = (int64)*((const T*)(ptr + i * stride));
+            res += (val < min_val) | (val > max_val);
+        }
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+template<typename T>
+static void
+deep_verify_check_chunk(const DeepVerifyCheck &check,
+                        index_t max_errors,
+                        DeepVerifyChunk &chunk)
+{
+    const DataType &dt = check.values->dtype();
+    const uint8 *ptr   = (const uint8*)check.values->element_ptr(0);
+    index_t stride     = dt.stride();
+
+    chunk.num_errors = deep_verify_count_out_of_range<T>(ptr,
+                                                         stride,
+                                                         chunk.begin,
+                                                         chunk.end,
+                                                         check.min_val,
+                                                         check.max_val);
+
+    // violations are rare, so only find them when we know they exist
+    for(index_t i = chunk.begin; 
+        i < chunk.end && chunk.num_errors > 0 &&
+        (index_t)chunk.error_idxs.size() < max_errors;
+        i++)
+    {
+        int64 val = (int64)*((const T*)(ptr + i * stride));
+        if(val < check.min_val || val > check.max_val)
+        {
+            chunk.error_idxs.push_back(i);
+            chunk.error_vals.push_back(val);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+static void
+deep_verify_run_chunk(const DeepVerifyCheck &check,
+                      index_t max_errors,
+                      DeepVerifyChunk &chunk)
+{
+    switch(check.values->dtype().id())
+    {
+        case DataType::INT8_ID:
+            deep_verify_check_chunk<int8>(check,max_errors,chunk);
+            break;
+        case DataType::INT16_ID:
+            deep_verify_check_chunk<int16>(check,max_errors,chunk);
+            break;
+        case DataType::INT32_ID:
+            deep_verify_check_chunk<int32>(check,max_errors,chunk);
+            break;
+        case DataType::INT64_ID:
+            deep_verify_check_chunk<int64>(check,max_errors,chunk);
+            break;
+        case DataType::UINT8_ID:
+            deep_verify_check_chunk<uint8>(check,max_errors,chunk);
+            break;
+        case DataType::UINT16_ID:
+            deep_verify_check_chunk<uint16>(check,max_errors,chunk);
+            break;
+        case DataType::UINT32_ID:
+            deep_verify_check_chunk<uint32>(check,max_errors,chunk);
+            break;
+        case DataType::UINT64_ID:
+            deep_verify_check_chunk<uint64>(check,max_errors,chunk);
+            break;
+        default:
+            // structural verify already reports non integer arrays
+            break;
+    }
+}
+
+//---------------------------------------------------------------------------//
+static void
+deep_verify_work_loop(DeepVerifyWork &work)
+{
+    index_t num_chunks = (index_t)work.chunks->size();
+    while(true)
+    {
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+        pthread_mutex_lock(&work.mutex);
+#endif
+        index_t idx = work.next_chunk++;
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+        pthread_mutex_unlock(&work.mutex);
+#endif
+        if(idx >= num_chunks)
+        {
+            return;
+        }
+
+        DeepVerifyChunk &chunk = (*work.chunks)[(size_t)idx];
+        deep_verify_run_chunk((*work.checks)[(size_t)chunk.check],
+                              work.max_errors,
+                              chunk);
+    }
+}
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+//---------------------------------------------------------------------------//
+static void *
+deep_verify_thread_main(void *work)
+{
+    deep_verify_work_loop(*static_cast<DeepVerifyWork*>(work));
+    return NULL;
+}
+#endif
+
+//---------------------------------------------------------------------------//
+// runs the bounds checks with num_threads threads and logs violations,
+// returns false if any check failed
+//---------------------------------------------------------------------------//
+static bool
+deep_verify_run_checks(const std::vector<DeepVerifyCheck> &checks,
+                       index_t max_errors,
+                       index_t num_threads)
+{
+    std::vector<DeepVerifyChunk> chunks;
+    for(size_t i=0; i < checks.size(); i++)
+    {
+        index_t num_vals = checks[i].values->dtype().number_of_elements();
+        for(index_t begin = 0; begin < num_vals;
+            begin += DEEP_VERIFY_CHUNK_SIZE)
+        {
+            DeepVerifyChunk chunk;
+            chunk.check = (index_t)i;
+            chunk.begin = begin;
+            chunk.end   = begin + DEEP_VERIFY_CHUNK_SIZE < num_vals ?
+                          begin + DEEP_VERIFY_CHUNK_SIZE : num_vals;
+            chunk.num_errors = 0;
+            chunks.push_back(chunk);
+        }
+    }
+
+    DeepVerifyWork work;
+    work.checks     = &checks;
+    work.chunks     = &chunks;
+    work.max_errors = max_errors;
+    work.next_chunk = 0;
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    if(num_threads > (index_t)chunks.size())
+    {
+        num_threads = (index_t)chunks.size();
+    }
+
+    pthread_mutex_init(&work.mutex,NULL);
+    std::vector<pthread_t> threads;
+    // this thread works too
+    for(index_t i=1; i < num_threads; i++)
+    {
+        pthread_t thread;
+        if(pthread_create(&thread,
+                          NULL,
+                          deep_verify_thread_main,
+                          &work) == 0)
+        {
+            threads.push_back(thread);
+        }
+    }
+    deep_verify_work_loop(work);
+    for(size_t i=0; i < threads.size(); i++)
+    {
+        pthread_join(threads[i],NULL);
+    }
+    pthread_mutex_destroy(&work.mutex);
+#else
+    deep_verify_work_loop(work);
+#endif
+
+    // chunks are in index order, so the first chunks with errors 
+    // hold the first violations of each check
+    bool res = true;
+    std::vector<index_t> num_errors(checks.size(),0);
+    std::vector<index_t> num_logged(checks.size(),0);
+
+    for(size_t i=0; i < chunks.size(); i++)
+    {
+        const DeepVerifyChunk &chunk = chunks[i];
+        if(chunk.num_errors == 0)
+        {
+            continue;
+        }
+
+        size_t check_idx = (size_t)chunk.check;
+        const DeepVerifyCheck &check = checks[check_idx];
+        num_errors[check_idx] += chunk.num_errors;
+
+        for(size_t j=0; j < chunk.error_idxs.size() &&
+                        num_logged[check_idx] < max_errors; j++)
+        {
+            std::ostringstream oss;
+            oss << check.desc << "[" << chunk.error_idxs[j] << "] = "
+                << chunk.error_vals[j] << " is out of range ["
+                << check.min_val << ", " << check.max_val << "]";
+            log_error(*check.info,check.proto_name,oss.str());
+            num_logged[check_idx]++;
+        }
+    }
+
+    for(size_t i=0; i < checks.size(); i++)
+    {
+        if(num_errors[i] == 0)
+        {
+            continue;
+        }
+
+        if(num_errors[i] > num_logged[i])
+        {
+            std::ostringstream oss;
+            oss << checks[i].desc << " has " 
+                << (num_errors[i] - num_logged[i])
+                << " more out of range values";
+            log_error(*checks[i].info,checks[i].proto_name,oss.str());
+        }
+
+        log_verify_result(*checks[i].info,false);
+        res = false;
+    }
+
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+static bool
+deep_verify_is_valid(const Node &info,
+                     const std::string &path)
+{
+    std::string valid_path = path + "/valid";
+    return info.has_path(valid_path) && 
+           info[valid_path].as_string() == "true";
+}
+
+//---------------------------------------------------------------------------//
+// returns the number of points in a (verified) coordset, or -1
+//---------------------------------------------------------------------------//
+static index_t
+deep_verify_coordset_points(const Node &coordset)
+{
+    const std::string type_name = coordset["type"].as_string();
+    index_t res = -1;
+
+    if(type_name == "uniform")
+    {
+        const Node &dims = coordset["dims"];
+        res = (index_t)dims["i"].to_int64();
+        if(dims.has_child("j"))
+        {
+            res *= (index_t)dims["j"].to_int64();
+        }
+        if(dims.has_child("k"))
+        {
+            res *= (index_t)dims["k"].to_int64();
+        }
+    }
+    else if(type_name == "rectilinear")
+    {
+        res = 1;
+        NodeConstIterator itr = coordset["values"].children();
+        while(itr.has_next())
+        {
+            res *= itr.next().dtype().number_of_elements();
+        }
+    }
+    else if(type_name == "explicit")
+    {
+        const Node &vals = coordset["values"];
+        if(vals.number_of_children() > 0)
+        {
+            res = vals.child(0).dtype().number_of_elements();
+        }
+    }
+
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+// returns the number of elements implied by a coordset's logical dims,
+// used by uniform and rectilinear topologies
+//---------------------------------------------------------------------------//
+static index_t
+deep_verify_implicit_elements(const Node &coordset)
+{
+    const std::string type_name = coordset["type"].as_string();
+    index_t res = 1;
+
+    if(type_name == "uniform")
+    {
+        NodeConstIterator itr = coordset["dims"].children();
+        while(itr.has_next())
+        {
+            index_t dim = (index_t)itr.next().to_int64();
+            // a single point along an axis doesn't add a dimension
+            res *= dim > 1 ? dim - 1 : 1;
+        }
+    }
+    else if(type_name == "rectilinear")
+    {
+        NodeConstIterator itr = coordset["values"].children();
+        while(itr.has_next())
+        {
+            index_t dim = itr.next().dtype().number_of_elements();
+            res *= dim > 1 ? dim - 1 : 1;
+        }
+    }
+    else
+    {
+        res = -1;
+    }
+
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+static index_t
+deep_verify_shape_indices(const std::string &shape)
+{
+    index_t res = 0;
+    if(shape == "point")
+    {
+        res = 1;
+    }
+    else if(shape == "line")
+    {
+        res = 2;
+    }
+    else if(shape == "tri")
+    {
+        res = 3;
+    }
+    else if(shape == "quad" || shape == "tet")
+    {
+        res = 4;
+    }
+    else if(shape == "hex")
+    {
+        res = 8;
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+// checks a single shape unstructured element group, returns the number
+// of elements
+//---------------------------------------------------------------------------//
+static index_t
+deep_verify_element_group(const Node &elements,
+                          const std::string &desc,
+                          index_t num_points,
+                          Node &info,
+                          std::vector<DeepVerifyCheck> &checks,
+                          bool &res)
+{
+    const std::string proto_name = "mesh::topology::unstructured";
+    const Node &conn = elements["connectivity"];
+    index_t num_idxs = conn.dtype().number_of_elements();
+    index_t shape_idxs = deep_verify_shape_indices(
+                                            elements["shape"].as_string());
+
+    if(shape_idxs > 0 && num_idxs % shape_idxs != 0)
+    {
+        std::ostringstream oss;
+        oss << desc << " has " << num_idxs << " entries, which is not a "
+            << "multiple of " << shape_idxs << " (the number of indices "
+            << "of a " << elements["shape"].as_string() << ")";
+        log_error(info,proto_name,oss.str());
+        res = false;
+    }
+
+    if(num_idxs > 0)
+    {
+        DeepVerifyCheck check;
+        check.values     = &conn;
+        check.min_val    = 0;
+        check.max_val    = (int64)num_points - 1;
+        check.desc       = desc;
+        check.info       = &info;
+        check.proto_name = proto_name;
+        checks.push_back(check);
+    }
+
+    return shape_idxs > 0 ? num_idxs / shape_idxs : 0;
+}
+
+//---------------------------------------------------------------------------//
+// checks a mixed shape unstructured topology (element_types, stream and
+// element_index), returns the number of elements, or -1 if unknown
+//---------------------------------------------------------------------------//
+static index_t
+deep_verify_element_stream(const Node &elements,
+                           index_t num_points,
+                           Node &info,
+                           std::vector<DeepVerifyCheck> &checks,
+                           bool &res)
+{
+    const std::string proto_name = "mesh::topology::unstructured";
+
+    const char *req_paths[] = {"stream", "element_index/stream_ids"};
+    for(index_t i = 0; i < 2; i++)
+    {
+        if(!elements.has_path(req_paths[i]))
+        {
+            log_error(info,proto_name,"missing child \"elements/" +
+                      std::string(req_paths[i]) + "\"");
+            res = false;
+        }
+        else if(!elements[req_paths[i]].dtype().is_integer())
+        {
+            log_error(info,proto_name,"\"elements/" +
+                      std::string(req_paths[i]) + 
+                      "\" is not an integer array");
+            res = false;
+        }
+    }
+
+    bool has_counts  = elements.has_path("element_index/element_counts");
+    bool has_offsets = elements.has_path("element_index/offsets");
+    std::string index_path = has_counts ? "element_index/element_counts" :
+                                          "element_index/offsets";
+    if(!has_counts && !has_offsets)
+    {
+        log_error(info,proto_name,"missing child "
+                  "\"elements/element_index/element_counts\" or "
+                  "\"elements/element_index/offsets\"");
+        res = false;
+    }
+    else if(!elements[index_path].dtype().is_integer())
+    {
+        log_error(info,proto_name,"\"elements/" + index_path +
+                  "\" is not an integer array");
+        res = false;
+    }
+
+    // the number of stream entries used by each stream id
+    std::map<int64,index_t> stream_id_idxs;
+    NodeConstIterator itr = elements["element_types"].children();
+    while(itr.has_next())
+    {
+        const Node &etype = itr.next();
+        if(!etype.has_child("stream_id") || !etype.has_child("shape"))
+        {
+            log_error(info,proto_name,"elements/element_types/" + 
+                      itr.name() + " needs a \"stream_id\" and a \"shape\"");
+            res = false;
+            continue;
+        }
+        stream_id_idxs[etype["stream_id"].to_int64()] =
+            deep_verify_shape_indices(etype["shape"].as_string());
+    }
+
+    if(!res)
+    {
+        return -1;
+    }
+
+    const Node &stream = elements["stream"];
+    index_t stream_len = stream.dtype().number_of_elements();
+
+    Node stream_ids, index_vals;
+    elements["element_index/stream_ids"].to_int64_array(stream_ids);
+    elements[index_path].to_int64_array(index_vals);
+    const int64 *ids  = stream_ids.as_int64_ptr();
+    const int64 *idx  = index_vals.as_int64_ptr();
+    index_t num_ids   = stream_ids.dtype().number_of_elements();
+    index_t num_idx   = index_vals.dtype().number_of_elements();
+
+    std::vector<index_t> ids_idxs((size_t)num_ids,0);
+    for(index_t i = 0; i < num_ids; i++)
+    {
+        std::map<int64,index_t>::const_iterator s_itr;
+        s_itr = stream_id_idxs.find(ids[i]);
+        if(s_itr == stream_id_idxs.end())
+        {
+            std::ostringstream oss;
+            oss << "elements/element_index/stream_ids[" << i << "] = " 
+                << ids[i] << " is not a stream_id of elements/element_types";
+            log_error(info,proto_name,oss.str());
+            res = false;
+            return -1;
+        }
+        ids_idxs[(size_t)i] = s_itr->second;
+    }
+
+    index_t num_elements = 0;
+    if(has_counts)
+    {
+        // one count per stream id group, the groups are stored in order
+        if(num_idx != num_ids)
+        {
+            std::ostringstream oss;
+            oss << "elements/element_index/element_counts has " << num_idx
+                << " entries, but elements/element_index/stream_ids has "
+                << num_ids;
+            log_error(info,proto_name,oss.str());
+            res = false;
+            return -1;
+        }
+
+        index_t stream_used = 0;
+        for(index_t i = 0; i < num_idx; i++)
+        {
+            if(idx[i] < 0)
+            {
+                std::ostringstream oss;
+                oss << "elements/element_index/element_counts[" << i 
+                    << "] = " << idx[i] << " is negative";
+                log_error(info,proto_name,oss.str());
+                res = false;
+                return -1;
+            }
+            num_elements += (index_t)idx[i];
+            stream_used  += (index_t)idx[i] * ids_idxs[(size_t)i];
+        }
+
+        if(stream_used > stream_len)
+        {
+            std::ostringstream oss;
+            oss << "elements/element_index/element_counts imply "
+                << stream_used << " stream entries, but elements/stream has "
+                << stream_len;
+            log_error(info,proto_name,oss.str());
+            res = false;
+            num_elements = -1;
+        }
+    }
+    else
+    {
+        // one offset per element, with an optional end offset
+        if(num_idx != num_ids && num_idx != num_ids + 1)
+        {
+            std::ostringstream oss;
+            oss << "elements/element_index/offsets has " << num_idx
+                << " entries, but elements/element_index/stream_ids has "
+                << num_ids;
+            log_error(info,proto_name,oss.str());
+            res = false;
+            return -1;
+        }
+
+        for(index_t i = 0; i < num_idx; i++)
+        {
+            int64 lo = i > 0 ? idx[i-1] : 0;
+            if(idx[i] < lo || idx[i] > (int64)stream_len)
+            {
+                std::ostringstream oss;
+                oss << "elements/element_index/offsets[" << i << "] = "
+                    << idx[i] << " is out of range [" << lo << ", " 
+                    << stream_len << "]";
+                log_error(info,proto_name,oss.str());
+                res = false;
+                return -1;
+            }
+
+            if(i > 0 && idx[i] - idx[i-1] < (int64)ids_idxs[(size_t)(i-1)])
+            {
+                std::ostringstream oss;
+                oss << "elements/element_index/offsets[" << i - 1 << "] = "
+                    << idx[i-1] << " leaves " << idx[i] - idx[i-1] 
+                    << " stream entries for an element that needs "
+                    << ids_idxs[(size_t)(i-1)];
+                log_error(info,proto_name,oss.str());
+                res = false;
+                return -1;
+            }
+        }
+
+        // without an end offset, the last element ends with the stream
+        if(num_idx == num_ids && num_ids > 0 &&
+           (int64)stream_len - idx[num_ids-1] <
+           (int64)ids_idxs[(size_t)(num_ids-1)])
+        {
+            std::ostringstream oss;
+            oss << "elements/element_index/offsets[" << num_ids - 1 
+                << "] = " << idx[num_ids-1] << " leaves "
+                << (int64)stream_len - idx[num_ids-1] 
+                << " stream entries for an element that needs "
+                << ids_idxs[(size_t)(num_ids-1)];
+            log_error(info,proto_name,oss.str());
+            res = false;
+            return -1;
+        }
+
+        num_elements = num_ids;
+    }
+
+    if(stream_len > 0)
+    {
+        DeepVerifyCheck check;
+        check.values     = &stream;
+        check.min_val    = 0;
+        check.max_val    = (int64)num_points - 1;
+        check.desc       = "elements/stream";
+        check.info       = &info;
+        check.proto_name = proto_name;
+        checks.push_back(check);
+    }
+
+    return num_elements;
+}
+
+//---------------------------------------------------------------------------//
+// checks a (verified) topology against its coordset, returns the number
+// of elements, or -1 if unknown
+//---------------------------------------------------------------------------//
+static index_t
+deep_verify_topology(const Node &topo,
+                     const Node &coordset,
+                     Node &info,
+                     std::vector<DeepVerifyCheck> &checks,
+                     bool &res)
+{
+    const std::string type_name     = topo["type"].as_string();
+    const std::string cs_type_name  = coordset["type"].as_string();
+    const std::string proto_name    = "mesh::topology::" + type_name;
+    index_t num_points = deep_verify_coordset_points(coordset);
+    index_t num_elements = -1;
+
+    if(type_name == "uniform" || type_name == "rectilinear")
+    {
+        if(cs_type_name != type_name)
+        {
+            log_error(info,proto_name,"references a " + cs_type_name
+                      + " coordset, expected a " + type_name + " coordset");
+            res = false;
+        }
+        else
+        {
+            num_elements = deep_verify_implicit_elements(coordset);
+        }
+    }
+    else if(type_name == "structured")
+    {
+        const Node &dims = topo["elements/dims"];
+        index_t topo_points = (index_t)dims["i"].to_int64() + 1;
+        num_elements = (index_t)dims["i"].to_int64();
+        if(dims.has_child("j"))
+        {
+            topo_points  *= (index_t)dims["j"].to_int64() + 1;
+            num_elements *= (index_t)dims["j"].to_int64();
+        }
+        if(dims.has_child("k"))
+        {
+            topo_points  *= (index_t)dims["k"].to_int64() + 1;
+            num_elements *= (index_t)dims["k"].to_int64();
+        }
+
+        if(num_points >= 0 && topo_points != num_points)
+        {
+            std::ostringstream oss;
+            oss << "elements/dims imply " << topo_points << " points, "
+                << "but the coordset has " << num_points << " points";
+            log_error(info,proto_name,oss.str());
+            res = false;
+        }
+    }
+    else if(type_name == "unstructured" && num_points >= 0)
+    {
+        const Node &elements = topo["elements"];
+        if(elements.has_child("shape"))
+        {
+            num_elements = deep_verify_element_group(elements,
+                                                     "elements/connectivity",
+                                                     num_points,
+                                                     info,
+                                                     checks,
+                                                     res);
+        }
+        else if(elements.has_child("element_types"))
+        {
+            num_elements = deep_verify_element_stream(elements,
+                                                      num_points,
+                                                      info,
+                                                      checks,
+                                                      res);
+        }
+        else
+        {
+            num_elements = 0;
+            NodeConstIterator itr = elements.children();
+            while(itr.has_next())
+            {
+                const Node &group = itr.next();
+                std::ostringstream oss;
+                oss << "elements/";
+                if(elements.dtype().is_object())
+                {
+                    oss << itr.name();
+                }
+                else
+                {
+                    oss << "[" << itr.index() << "]";
+                }
+                oss << "/connectivity";
+                num_elements += deep_verify_element_group(group,
+                                                          oss.str(),
+                                                          num_points,
+                                                          info,
+                                                          checks,
+                                                          res);
+            }
+        }
+    }
+
+    return num_elements;
+}
+
+//---------------------------------------------------------------------------//
+// checks the number of values of a (verified) field 
+//---------------------------------------------------------------------------//
+static void
+deep_verify_field(const Node &field,
+                  index_t num_points,
+                  index_t num_elements,
+                  Node &info,
+                  bool &res)
+{
+    if(!field.has_child("association"))
+    {
+        return;
+    }
+
+    const std::string assoc = field["association"].as_string();
+    index_t expected = assoc == "vertex" ? num_points : num_elements;
+
+    if(expected < 0)
+    {
+        return;
+    }
+
+    const Node &vals = field["values"];
+    index_t num_vals = vals.number_of_children() > 0 ?
+                       vals.child(0).dtype().number_of_elements() :
+                       vals.dtype().number_of_elements();
+
+    if(num_vals != expected)
+    {
+        std::ostringstream oss;
+        oss << "values has " << num_vals << " entries, but the "
+            << "topology has " << expected << " "
+            << (assoc == "vertex" ? "points" : "elements");
+        log_error(info,"mesh::field",oss.str());
+        log_verify_result(info,false);
+        res = false;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// checks the data of a (verified) domain, bounds checks are added to 
+// checks and run later
+//---------------------------------------------------------------------------//
+static bool
+deep_verify_domain(const Node &n,
+                   Node &info,
+                   std::vector<DeepVerifyCheck> &checks)
+{
+    bool res = true;
+
+    if(!n.has_child("topologies"))
+    {
+        return res;
+    }
+
+    std::map<std::string,index_t> topo_points;
+    std::map<std::string,index_t> topo_elements;
+
+    NodeConstIterator itr = n["topologies"].children();
+    while(itr.has_next())
+    {
+        const Node &topo = itr.next();
+        const std::string topo_name = itr.name();
+        const std::string topo_path = "topologies/" + topo_name;
+
+        if(!deep_verify_is_valid(info,topo_path))
+        {
+            continue;
+        }
+
+        const std::string cset_name = topo["coordset"].as_string();
+        if(!deep_verify_is_valid(info,"coordsets/" + cset_name))
+        {
+            continue;
+        }
+
+        const Node &coordset = n["coordsets"][cset_name];
+        Node &topo_info = info[topo_path];
+        bool topo_res = true;
+
+        topo_points[topo_name]   = deep_verify_coordset_points(coordset);
+        topo_elements[topo_name] = deep_verify_topology(topo,
+                                                        coordset,
+                                                        topo_info,
+                                                        checks,
+                                                        topo_res);
+        if(!topo_res)
+        {
+            log_verify_result(topo_info,false);
+            res = false;
+        }
+    }
+
+    if(n.has_child("fields"))
+    {
+        itr = n["fields"].children();
+        while(itr.has_next())
+        {
+            const Node &field = itr.next();
+            const std::string field_path = "fields/" + itr.name();
+
+            if(!deep_verify_is_valid(info,field_path))
+            {
+                continue;
+            }
+
+            const std::string topo_name = field["topology"].as_string();
+            if(topo_points.find(topo_name) == topo_points.end())
+            {
+                continue;
+            }
+
+            deep_verify_field(field,
+                              topo_points[topo_name],
+                              topo_elements[topo_name],
+                              info[field_path],
+                              res);
+        }
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+bool
+mesh::verify(const Node &n,
+             const Node &opts,
+             Node &info)
+{
+    info.reset();
+
+    bool    deep        = false;
+    index_t max_errors  = 10;
+    // one thread unless asked, verify is often called on every mpi rank
+    index_t num_threads = 1;
+
+    if(opts.has_child("deep"))
+    {
+        deep = opts["deep"].to_int64() != 0;
+    }
+
+    if(opts.has_child("max_errors"))
+    {
+        max_errors = (index_t)opts["max_errors"].to_int64();
+    }
+
+    if(opts.has_child("num_threads"))
+    {
+        num_threads = (index_t)opts["num_threads"].to_int64();
+    }
+
+    if(num_threads < 1)
+    {
+        num_threads = 1;
+    }
+
+    // a node with domains as children, or a single domain 
+    bool multi_domain = !n.has_child("coordsets") &&
+                        n.number_of_children() > 0;
+
+    NodeConstIterator itr = n.children();
+    while(itr.has_next() && multi_domain)
+    {
+        const Node &dom = itr.next();
+        multi_domain = dom.dtype().is_object() && 
+                       dom.has_child("coordsets");
+    }
+
+    bool res = true;
+    std::vector<const Node*> doms;
+    std::vector<Node*>       doms_info;
+
+    if(multi_domain)
+    {
+        itr = n.children();
+        while(itr.has_next())
+        {
+            const Node &dom = itr.next();
+            Node &dom_info = n.dtype().is_object() ? 
+                             info["domains"][itr.name()] :
+                             info["domains"].append();
+            doms.push_back(&dom);
+            doms_info.push_back(&dom_info);
+        }
+    }
+    else
+    {
+        doms.push_back(&n);
+        doms_info.push_back(&info);
+    }
+
+    // the structural checks
+    for(size_t i=0; i < doms.size(); i++)
+    {
+        if(!verify(*doms[i],*doms_info[i]))
+        {
+            res = false;
+        }
+    }
+
+    if(deep)
+    {
+        // the data checks for all domains are run together
+        std::vector<DeepVerifyCheck> checks;
+        std::vector<bool>            doms_res(doms.size(),true);
+
+        for(size_t i=0; i < doms.size(); i++)
+        {
+            doms_res[i] = deep_verify_domain(*doms[i],
+                                             *doms_info[i],
+                                             checks);
+        }
+
+        deep_verify_run_checks(checks,max_errors,num_threads);
+
+        for(size_t i=0; i < doms.size(); i++)
+        {
+            // bounds checks log to topology info
+            if(doms_info[i]->has_child("topologies"))
+            {
+                NodeIterator t_itr = (*doms_info[i])["topologies"].children();
+                while(t_itr.has_next())
+                {
+                    Node &topo_info = t_itr.next();
+                    if(topo_info["valid"].as_string() != "true")
+                    {
+                        doms_res[i] = false;
+                    }
+                }
+            }
+
+            if(!doms_res[i])
+            {
+                log_verify_result(*doms_info[i],false);
+                res = false;
+            }
+        }
+    }
+
+    if(multi_domain)
+    {
+        log_verify_result(info,res);
+    }
+
+    return res;
+}
+
+
 //-----------------------------------------------------------------------------
 std::string 
 identify_coord_sys_type(const Node &coords)
@@ -99,6 +99,25 @@ bool CONDUIT_BLUEPRINT_API verify(const std::string &protocol,
 bool CONDUIT_BLUEPRINT_API verify(const conduit::Node &n,
                                   conduit::Node &info);
 
+//-----------------------------------------------------------------------------
+/// Verify with options, n can be a single domain mesh or a node 
+/// whose children are domains (info["domains"] holds their results).
+///
+///  opts:
+///    deep:        (int) if 1, also check the mesh data:
+///                  connectivity indices against coordset sizes,
+///                  structured dims against coordset sizes and
+///                  field lengths against point and element counts 
+///                  (default: 0)
+///    max_errors:  (int) max out of range values logged per array 
+///                  (default: 10)
+///    num_threads: (int) threads used for the deep checks 
+///                  (default: 1)
+//-----------------------------------------------------------------------------
+bool CONDUIT_BLUEPRINT_API verify(const conduit::Node &n,
+                                  const conduit::Node &opts,
+                                  conduit::Node &info);
+
 //-------------------------------------------------------------------------
 void CONDUIT_BLUEPRINT_API generate_index(const conduit::Node &mesh,
                                           const std::string &ref_path,
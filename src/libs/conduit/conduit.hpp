@@ -58,6 +58,8 @@
 
 #include "conduit_core.hpp"
 #include "conduit_error.hpp"
+#include "conduit_arena.hpp"
+#include "conduit_path.hpp"
 #include "conduit_endianness.hpp"
 #include "conduit_data_type.hpp"
 #include "conduit_data_array.hpp"
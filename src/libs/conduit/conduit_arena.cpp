@@ -0,0 +1,226 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_arena.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_arena.hpp"
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes -- 
+//-----------------------------------------------------------------------------
+#include <stdlib.h>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes -- 
+//-----------------------------------------------------------------------------
+#include "conduit_error.hpp"
+#include "conduit_utils.hpp"
+
+// all arena allocations are aligned to this many bytes
+#define CONDUIT_ARENA_ALIGNMENT 16
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+const index_t Arena::DEFAULT_BLOCK_BYTES;
+
+//---------------------------------------------------------------------------//
+Arena::Arena(index_t block_bytes)
+: m_block_bytes(block_bytes),
+  m_blocks(),
+  m_block_sizes(),
+  m_curr(NULL),
+  m_end(NULL),
+  m_free_lists(),
+  m_num_live(0)
+{
+    if(m_block_bytes < CONDUIT_ARENA_ALIGNMENT)
+    {
+        m_block_bytes = CONDUIT_ARENA_ALIGNMENT;
+    }
+}
+
+//---------------------------------------------------------------------------//
+Arena::~Arena()
+{
+    release();
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Arena::aligned_bytes(index_t nbytes)
+{
+    if(nbytes <= 0)
+    {
+        return CONDUIT_ARENA_ALIGNMENT;
+    }
+
+    return ((nbytes + CONDUIT_ARENA_ALIGNMENT - 1) / CONDUIT_ARENA_ALIGNMENT)
+            * CONDUIT_ARENA_ALIGNMENT;
+}
+
+//---------------------------------------------------------------------------//
+void
+Arena::add_block(index_t nbytes)
+{
+    index_t bsize = m_block_bytes;
+    if(nbytes > bsize)
+    {
+        bsize = nbytes;
+    }
+
+    // malloc returns memory aligned for any fundamental type, 
+    // which satisfies CONDUIT_ARENA_ALIGNMENT on the platforms we support
+    void *block = malloc((size_t)bsize);
+
+    if(block == NULL)
+    {
+        CONDUIT_ERROR("<Arena::add_block> failed to allocate " 
+                      << bsize << " bytes");
+    }
+
+    m_blocks.push_back(block);
+    m_block_sizes.push_back(bsize);
+
+    m_curr = (uint8*)block;
+    m_end  = m_curr + bsize;
+}
+
+//---------------------------------------------------------------------------//
+void *
+Arena::allocate(index_t nbytes)
+{
+    index_t abytes = aligned_bytes(nbytes);
+    size_t  bucket = (size_t)(abytes / CONDUIT_ARENA_ALIGNMENT);
+
+    void *res = NULL;
+
+    // first try to reuse storage from the free list
+    if(bucket < m_free_lists.size() && m_free_lists[bucket] != NULL)
+    {
+        res = m_free_lists[bucket];
+        // the first word of a free entry holds the next free entry
+        m_free_lists[bucket] = *((void**)res);
+    }
+    else
+    {
+        if(m_curr == NULL || (m_end - m_curr) < abytes)
+        {
+            add_block(abytes);
+        }
+
+        res = m_curr;
+        m_curr += abytes;
+    }
+
+    m_num_live++;
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+Arena::deallocate(void *ptr, index_t nbytes)
+{
+    if(ptr == NULL)
+    {
+        return;
+    }
+
+    index_t abytes = aligned_bytes(nbytes);
+    size_t  bucket = (size_t)(abytes / CONDUIT_ARENA_ALIGNMENT);
+
+    if(bucket >= m_free_lists.size())
+    {
+        m_free_lists.resize(bucket+1,NULL);
+    }
+
+    // push onto the free list for this size
+    *((void**)ptr) = m_free_lists[bucket];
+    m_free_lists[bucket] = ptr;
+
+    m_num_live--;
+}
+
+//---------------------------------------------------------------------------//
+void
+Arena::release()
+{
+    for(size_t i=0; i < m_blocks.size(); i++)
+    {
+        free(m_blocks[i]);
+    }
+
+    m_blocks.clear();
+    m_block_sizes.clear();
+    m_free_lists.clear();
+
+    m_curr = NULL;
+    m_end  = NULL;
+    m_num_live = 0;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Arena::total_bytes_reserved() const
+{
+    index_t res = 0;
+    for(size_t i=0; i < m_block_sizes.size(); i++)
+    {
+        res += m_block_sizes[i];
+    }
+    return res;
+}
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
@@ -0,0 +1,169 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_arena.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_ARENA_HPP
+#define CONDUIT_ARENA_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes -- 
+//-----------------------------------------------------------------------------
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes -- 
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Arena --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::Arena
+///
+/// description:
+///  Block based pool allocator used to hold the Node and Schema objects
+///  that make up a tree. 
+///
+///  Objects are carved out of large blocks with a bump pointer. Storage 
+///  returned via deallocate() is kept on a free list (bucketed by size) 
+///  and reused by later allocations of the same size. release() returns 
+///  all of the blocks at once.
+///
+///  The arena does not construct or destruct objects, callers use 
+///  placement new and explicit destructor calls.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API Arena
+{
+public:
+//-----------------------------------------------------------------------------
+// Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// default size of the blocks requested from the system
+    static const index_t DEFAULT_BLOCK_BYTES = 64 * 1024;
+
+    /// create an arena that allocates blocks of the given size
+    explicit Arena(index_t block_bytes = DEFAULT_BLOCK_BYTES);
+    /// Destructor, frees all blocks
+    ~Arena();
+
+//-----------------------------------------------------------------------------
+// Allocation interface
+//-----------------------------------------------------------------------------
+    /// returns storage for an object of the given size
+    void       *allocate(index_t nbytes);
+    /// returns storage obtained from allocate() to the arena for reuse.
+    /// nbytes must match the size passed to allocate().
+    void        deallocate(void *ptr, index_t nbytes);
+    /// frees all blocks held by the arena
+    void        release();
+
+//-----------------------------------------------------------------------------
+// Information Methods
+//-----------------------------------------------------------------------------
+    /// size of the blocks requested from the system
+    index_t     block_bytes() const
+                    { return m_block_bytes;}
+    /// number of blocks currently held
+    index_t     number_of_blocks() const
+                    { return (index_t)m_blocks.size();}
+    /// total bytes currently held in blocks
+    index_t     total_bytes_reserved() const;
+    /// number of allocations that have not been returned
+    index_t     number_of_live_allocations() const
+                    { return m_num_live;}
+
+private:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::Arena private methods and data members --
+//
+//-----------------------------------------------------------------------------
+    // disable copy and assignment
+    Arena(const Arena &);
+    Arena &operator=(const Arena &);
+
+    // rounds a request up to the arena's alignment
+    static index_t      aligned_bytes(index_t nbytes);
+    // creates a new block, large enough to hold nbytes
+    void                add_block(index_t nbytes);
+
+    /// bytes requested for each new block
+    index_t             m_block_bytes;
+    /// all blocks allocated by the arena
+    std::vector<void*>  m_blocks;
+    /// sizes of each block in m_blocks
+    std::vector<index_t> m_block_sizes;
+    /// bump pointer into the current block
+    uint8              *m_curr;
+    /// end of the current block
+    uint8              *m_end;
+    /// heads of the free lists, indexed by (aligned size / alignment)
+    std::vector<void*>  m_free_lists;
+    /// number of allocations not yet returned
+    index_t             m_num_live;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::Arena --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+
+#endif
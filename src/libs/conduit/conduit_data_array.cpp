@@ -53,6 +53,7 @@
 // -- standard includes -- 
 //-----------------------------------------------------------------------------
 #include <cstring>
+#include <limits>
 
 
 //-----------------------------------------------------------------------------
@@ -151,55 +152,65 @@ template <typename T>
 void            
 DataArray<T>::to_json(std::ostream &os) const 
 { 
+    utils::JSONWriter writer(os);
+    to_json(writer);
+}
+
+//---------------------------------------------------------------------------//
+// json element writers, selected at compile time from the element type
+//---------------------------------------------------------------------------//
+template <typename T>
+static inline void
+write_json_element(utils::JSONWriter &writer, T value)
+{
+    if(std::numeric_limits<T>::is_signed)
+        writer.write_int64((int64)value);
+    else
+        writer.write_uint64((uint64)value);
+}
+
+//---------------------------------------------------------------------------//
+static inline void
+write_json_element(utils::JSONWriter &writer, float32 value)
+{
+    writer.write_float32(value);
+}
+
+//---------------------------------------------------------------------------//
+static inline void
+write_json_element(utils::JSONWriter &writer, float64 value)
+{
+    writer.write_float64(value);
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+void            
+DataArray<T>::to_json(utils::JSONWriter &writer) const 
+{ 
+    if(!m_dtype.is_number())
+    {
+        CONDUIT_ERROR("Leaf type \"" 
+                      <<  m_dtype.name()
+                      << "\"" 
+                      << "is not supported in conduit::DataArray.")
+    }
+
     index_t nele = number_of_elements();
-    if(nele > 1)
-        os << "[";
+    // a single value is written as a scalar, everything else 
+    // (including zero length arrays) as a list
+    if(nele != 1)
+        writer.write('[');
 
-    bool first=true;
     for(index_t idx = 0; idx < nele; idx++)
     {
-        if(!first)
-            os << ", ";
-        switch(m_dtype.id())
-        {
-            // ints 
-            case DataType::INT8_ID:
-            case DataType::INT16_ID: 
-            case DataType::INT32_ID:
-            case DataType::INT64_ID:
-            {
-                 os << (int64) element(idx);
-                 break;
-            }
-            // uints
-            case DataType::UINT8_ID:
-            case DataType::UINT16_ID:
-            case DataType::UINT32_ID:
-            case DataType::UINT64_ID:
-            {
-                os << (uint64) element(idx);
-                break;
-            }
-            // floats 
-            case DataType::FLOAT32_ID: 
-            case DataType::FLOAT64_ID: 
-            {
-                os << utils::float64_to_string((float64) element(idx));
-                break;
-            }
-            default:
-            {
-                CONDUIT_ERROR("Leaf type \"" 
-                              <<  m_dtype.name()
-                              << "\"" 
-                              << "is not supported in conduit::DataArray.")
-            }
-        }
-        first=false;
+        if(idx > 0)
+            writer.write(", ",2);
+        write_json_element(writer,element(idx));
     }
 
-    if(nele > 1)
-        os << "]";
+    if(nele != 1)
+        writer.write(']');
 }
 
 
@@ -457,16 +468,13 @@ void
 DataArray<T>::compact_elements_to(uint8 *data) const
 { 
     // copy all elements 
-    index_t num_ele   = m_dtype.number_of_elements();
     index_t ele_bytes = DataType::default_bytes(m_dtype.id());
-    uint8 *data_ptr = data;
-    for(index_t i=0;i<num_ele;i++)
-    {
-        memcpy(data_ptr,
-               element_ptr(i),
-               (size_t)ele_bytes);
-        data_ptr+=ele_bytes;
-    }
+    utils::strided_copy(data,
+                        ele_bytes,
+                        element_ptr(0),
+                        m_dtype.stride(),
+                        ele_bytes,
+                        m_dtype.number_of_elements());
 }
 
 
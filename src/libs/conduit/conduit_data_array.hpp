@@ -196,6 +196,7 @@ public:
 //-----------------------------------------------------------------------------
     std::string     to_json() const;
     void            to_json(std::ostream &os) const;
+    void            to_json(utils::JSONWriter &writer) const;
     void            compact_elements_to(uint8 *data) const;
     
 //-----------------------------------------------------------------------------
@@ -1020,29 +1020,43 @@ DataType::to_json() const
 void
 DataType::to_json_stream(std::ostream &os) const
 {
-    os << "{\"dtype\":" << "\"" << id_to_name(m_id) << "\"";
+    utils::JSONWriter writer(os);
+    to_json_stream(writer);
+}
+
+//---------------------------------------------------------------------------// 
+void
+DataType::to_json_stream(utils::JSONWriter &writer,
+                         bool close) const
+{
+    writer.write("{\"dtype\":\"");
+    writer.write(id_to_name(m_id));
+    writer.write('"');
 
     if(is_number() || is_string())
     {
-        os << ", \"number_of_elements\": " << m_num_ele;
-        os << ", \"offset\": " << m_offset;
-        os << ", \"stride\": " << m_stride;
-        os << ", \"element_bytes\": " << m_ele_bytes;
-
-        std::string endian_str;
-        if(m_endianness == Endianness::DEFAULT_ID)
+        writer.write(", \"number_of_elements\": ");
+        writer.write_int64(m_num_ele);
+        writer.write(", \"offset\": ");
+        writer.write_int64(m_offset);
+        writer.write(", \"stride\": ");
+        writer.write_int64(m_stride);
+        writer.write(", \"element_bytes\": ");
+        writer.write_int64(m_ele_bytes);
+
+        index_t endian_id = m_endianness;
+        if(endian_id == Endianness::DEFAULT_ID)
         {
             // find this machine's actual endianness
-            endian_str = Endianness::id_to_name(Endianness::machine_default());
-        }
-        else
-        {
-            endian_str = Endianness::id_to_name(m_endianness);
+            endian_id = Endianness::machine_default();
         }
-        os << ", \"endianness\": \"" << endian_str << "\"";
+        writer.write(", \"endianness\": \"");
+        writer.write(Endianness::id_to_name(endian_id));
+        writer.write('"');
     }
 
-    os << "}";
+    if(close)
+        writer.write('}');
 }
 
 //---------------------------------------------------------------------------//
@@ -76,6 +76,12 @@ namespace conduit
 class Schema;
 class Node;
 
+namespace utils
+{
+    // buffered json output, see conduit_utils.hpp
+    class JSONWriter;
+}
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::DataType --
 //-----------------------------------------------------------------------------
@@ -448,6 +454,11 @@ public:
 //-----------------------------------------------------------------------------
     std::string         to_json() const;  
     void                to_json_stream(std::ostream &os) const;
+    /// writes the json for this dtype. When close is false, the final "}"
+    /// is omitted so callers can append more entries (used for detailed
+    /// node json, which adds the "value")
+    void                to_json_stream(utils::JSONWriter &writer,
+                                       bool close = true) const;
 
     void                compact_to(DataType &dtype) const;
 
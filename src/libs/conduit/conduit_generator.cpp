@@ -54,6 +54,10 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <stdio.h>
+#include <string.h>
+#include <istream>
+#include <iterator>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // -- rapidjson includes -- 
@@ -147,6 +151,18 @@ public:
                                          Schema *schema,
                                          const rapidjson::Value &jvalue);
 
+    static bool    walk_pure_json_schema(Schema *schema,
+                                         const rapidjson::Value &jvalue,
+                                         index_t curr_offset);
+
+    static void    parse_pure_json_values(Node &node,
+                                          const rapidjson::Value &jvalue);
+
+    static bool    check_json_schema_references(const rapidjson::Value &jvalue);
+
+    static void    parse_inline_values(Node &node,
+                                       const rapidjson::Value &jvalue);
+
     static void    walk_json_schema(Node   *node,
                                     Schema *schema,
                                     void   *data,
@@ -156,6 +172,18 @@ public:
     static void    parse_base64(Node *node,
                                 const rapidjson::Value &jvalue);
 
+    static void    parse_json(const std::string &json,
+                              rapidjson::Document &document);
+
+    static bool    walk_json_stream(std::istream &is,
+                                    bool conduit_json,
+                                    Node &node);
+
+    // streaming (SAX) reader support
+    class IStreamReadStream;
+    class SAXSchemaBuilder;
+    class SAXValueWriter;
+
 };
 
 //---------------------------------------------------------------------------//
@@ -711,6 +739,11 @@ Generator::Parser::parse_inline_value(const rapidjson::Value &jvalue,
 {
     if(jvalue.IsArray())
     {
+        // zero length arrays (written for zero length leaves)
+        // have no values to set
+        if(jvalue.Size() == 0)
+            return;
+
         // we assume a "value" is a leaf or list of compatible leafs
         index_t hval_type = check_homogenous_json_array(jvalue);
         
@@ -878,9 +911,7 @@ Generator::Parser::walk_pure_json_schema(Node  *node,
         {
             std::string entry_name(itr->name.GetString());
             Schema *curr_schema = schema->fetch_ptr(entry_name);
-            Node *curr_node  = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
+            Node *curr_node = node->create_child(curr_schema);
             walk_pure_json_schema(curr_node,curr_schema,itr->value);
             node->append_node_ptr(curr_node);
 
@@ -913,9 +944,7 @@ Generator::Parser::walk_pure_json_schema(Node  *node,
             {
                 schema->append();
                 Schema *curr_schema = schema->child_ptr(i);
-                Node * curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
+                Node *curr_node = node->create_child(curr_schema);
                 walk_pure_json_schema(curr_node,curr_schema,jvalue[i]);
                 node->append_node_ptr(curr_node);
             }
@@ -970,6 +999,281 @@ Generator::Parser::walk_pure_json_schema(Node  *node,
 }
 
 
+//---------------------------------------------------------------------------//
+// Builds the compact schema for a pure json document, packing leaves 
+// back to back starting at curr_offset. Returns false for documents
+// with object keys containing '/', which expand into nested children
+// and need the general node walk.
+//---------------------------------------------------------------------------//
+bool
+Generator::Parser::walk_pure_json_schema(Schema *schema,
+                                         const rapidjson::Value &jvalue,
+                                         index_t curr_offset)
+{
+    if(jvalue.IsObject())
+    {
+        schema->set(DataType::object());
+        for (rapidjson::Value::ConstMemberIterator itr = jvalue.MemberBegin(); 
+             itr != jvalue.MemberEnd(); ++itr)
+        {
+            std::string entry_name(itr->name.GetString());
+            if(entry_name.find('/') != std::string::npos)
+            {
+                return false;
+            }
+
+            if(schema->has_child(entry_name))
+            {
+                CONDUIT_ERROR("JSON Generator error:\n"
+                              << "duplicate object key: "
+                              << "\"" << entry_name << "\"");
+            }
+
+            Schema &curr_schema = schema->fetch(entry_name);
+            if(!walk_pure_json_schema(&curr_schema,itr->value,curr_offset))
+            {
+                return false;
+            }
+            curr_offset += curr_schema.total_strided_bytes();
+        }
+    }
+    else if(jvalue.IsArray())
+    {
+        index_t hval_type = check_homogenous_json_array(jvalue);
+        index_t num_ele   = (index_t) jvalue.Size();
+        if(hval_type == DataType::INT64_ID)
+        {
+            schema->set(DataType::int64(num_ele,curr_offset));
+        }
+        else if(hval_type == DataType::FLOAT64_ID)
+        {
+            schema->set(DataType::float64(num_ele,curr_offset));
+        }
+        else // not numeric array
+        {
+            schema->set(DataType::list());
+            for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
+            {
+                Schema &curr_schema = schema->append();
+                if(!walk_pure_json_schema(&curr_schema,jvalue[i],curr_offset))
+                {
+                    return false;
+                }
+                curr_offset += curr_schema.total_strided_bytes();
+            }
+        }
+    }
+    else if(jvalue.IsString())
+    {
+        // size including the null term
+        index_t str_size_with_term = (index_t) strlen(jvalue.GetString()) + 1;
+        schema->set(DataType::char8_str(str_size_with_term,curr_offset));
+    }
+    else if(jvalue.IsNull())
+    {
+        schema->set(DataType::empty());
+    }
+    else if(jvalue.IsBool())
+    {
+        // we store bools as uint8s
+        schema->set(DataType::uint8(1,curr_offset));
+    }
+    else if(jvalue.IsNumber())
+    {
+        // use 64bit types by default ... 
+        if(jvalue.IsInt() || jvalue.IsInt64())
+        {
+            schema->set(DataType::int64(1,curr_offset));
+        }
+        else if(jvalue.IsUint() || jvalue.IsUint64())
+        {
+            schema->set(DataType::uint64(1,curr_offset));
+        }
+        else  // double case
+        {
+            schema->set(DataType::float64(1,curr_offset));
+        }
+    }
+    else
+    {
+        CONDUIT_ERROR("JSON Generator error:\n"
+                      << "Invalid JSON type for parsing Node from pure JSON."
+                      << " Expected: JSON Object, Array, String, Null,"
+                      << " Boolean, or Number");
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Writes the values of a pure json document into a node allocated from
+// the schema built by walk_pure_json_schema(Schema*, ...).
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::parse_pure_json_values(Node &node,
+                                          const rapidjson::Value &jvalue)
+{
+    if(jvalue.IsObject())
+    {
+        index_t idx = 0;
+        for (rapidjson::Value::ConstMemberIterator itr = jvalue.MemberBegin(); 
+             itr != jvalue.MemberEnd(); ++itr, ++idx)
+        {
+            parse_pure_json_values(node.child(idx),itr->value);
+        }
+    }
+    else if(jvalue.IsArray())
+    {
+        index_t dtype_id = node.dtype().id();
+        if(dtype_id == DataType::INT64_ID)
+        {
+            int64 *vals_ptr = (int64*)node.element_ptr(0);
+            for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
+            {
+                vals_ptr[i] = jvalue[i].GetInt64();
+            }
+        }
+        else if(dtype_id == DataType::FLOAT64_ID)
+        {
+            float64 *vals_ptr = (float64*)node.element_ptr(0);
+            for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
+            {
+                vals_ptr[i] = jvalue[i].GetDouble();
+            }
+        }
+        else
+        {
+            for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
+            {
+                parse_pure_json_values(node.child(i),jvalue[i]);
+            }
+        }
+    }
+    else if(jvalue.IsString())
+    {
+        memcpy(node.element_ptr(0),
+               jvalue.GetString(),
+               (size_t)node.dtype().number_of_elements());
+    }
+    else if(jvalue.IsBool())
+    {
+        *(uint8*)node.element_ptr(0) = jvalue.IsTrue() ? 1 : 0;
+    }
+    else if(jvalue.IsNumber())
+    {
+        switch(node.dtype().id())
+        {
+            case DataType::INT64_ID:
+                *(int64*)node.element_ptr(0) = jvalue.GetInt64();
+                break;
+            case DataType::UINT64_ID:
+                *(uint64*)node.element_ptr(0) = jvalue.GetUint64();
+                break;
+            default: // FLOAT64_ID
+                *(float64*)node.element_ptr(0) = jvalue.GetDouble();
+                break;
+        }
+    }
+    // null: nothing to write
+}
+
+//---------------------------------------------------------------------------//
+// Returns true if a conduit json schema uses a list_of "length" 
+// reference, which needs the data of the node being built.
+//---------------------------------------------------------------------------//
+bool
+Generator::Parser::check_json_schema_references(const rapidjson::Value &jvalue)
+{
+    if(jvalue.IsObject())
+    {
+        if(jvalue.HasMember("dtype"))
+        {
+            const rapidjson::Value &dt_value = jvalue["dtype"];
+            if(!dt_value.IsObject())
+            {
+                return false;
+            }
+
+            if(jvalue.HasMember("length") &&
+               jvalue["length"].IsObject() &&
+               jvalue["length"].HasMember("reference"))
+            {
+                return true;
+            }
+            return check_json_schema_references(dt_value);
+        }
+
+        for (rapidjson::Value::ConstMemberIterator itr = jvalue.MemberBegin(); 
+             itr != jvalue.MemberEnd(); ++itr)
+        {
+            if(check_json_schema_references(itr->value))
+            {
+                return true;
+            }
+        }
+    }
+    else if(jvalue.IsArray())
+    {
+        for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
+        {
+            if(check_json_schema_references(jvalue[i]))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+// Writes the inline "value" entries of a conduit json schema into a node
+// allocated from the (compacted) schema built by 
+// walk_json_schema(Schema*, ...).
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::parse_inline_values(Node &node,
+                                       const rapidjson::Value &jvalue)
+{
+    if(jvalue.IsObject())
+    {
+        if(jvalue.HasMember("dtype"))
+        {
+            const rapidjson::Value &dt_value = jvalue["dtype"];
+            if(dt_value.IsObject())
+            {
+                // list_of case
+                index_t num_children = node.number_of_children();
+                for(index_t i=0; i < num_children; i++)
+                {
+                    parse_inline_values(node.child(i),dt_value);
+                }
+            }
+            else if(jvalue.HasMember("value"))
+            {
+                parse_inline_value(jvalue["value"],node);
+            }
+        }
+        else
+        {
+            for (rapidjson::Value::ConstMemberIterator itr = 
+                 jvalue.MemberBegin(); 
+                 itr != jvalue.MemberEnd(); ++itr)
+            {
+                std::string entry_name(itr->name.GetString());
+                parse_inline_values(node.fetch(entry_name),itr->value);
+            }
+        }
+    }
+    else if(jvalue.IsArray())
+    {
+        for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
+        {
+            parse_inline_values(node.child(i),jvalue[i]);
+        }
+    }
+    // strings are leaf dtypes without inline values
+}
+
 //---------------------------------------------------------------------------//
 void 
 Generator::Parser::walk_json_schema(Node   *node,
@@ -1018,9 +1322,7 @@ Generator::Parser::walk_json_schema(Node   *node,
                 {
                     schema->append();
                     Schema *curr_schema = schema->child_ptr(i);
-                    Node *curr_node = new Node();
-                    curr_node->set_schema_ptr(curr_schema);
-                    curr_node->set_parent(node);
+                    Node *curr_node = node->create_child(curr_schema);
                     walk_json_schema(curr_node,
                                      curr_schema,
                                      data,
@@ -1071,9 +1373,7 @@ Generator::Parser::walk_json_schema(Node   *node,
             {
                 std::string entry_name(itr->name.GetString());
                 Schema *curr_schema = schema->fetch_ptr(entry_name);
-                Node *curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
+                Node *curr_node = node->create_child(curr_schema);
                 walk_json_schema(curr_node,
                                  curr_schema,
                                  data,
@@ -1096,9 +1396,7 @@ Generator::Parser::walk_json_schema(Node   *node,
         {
             schema->append();
             Schema *curr_schema = schema->child_ptr(i);
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
+            Node *curr_node = node->create_child(curr_schema);
             walk_json_schema(curr_node,
                              curr_schema,
                              data,
@@ -1145,21 +1443,18 @@ Generator::Parser::parse_base64(Node *node,
                                 const rapidjson::Value &jvalue)
 {
     // object case
-
-    std::string base64_str = "";
-    
     if(jvalue.IsObject())
     {
-        Schema s;
-        if (jvalue.HasMember("data") && jvalue["data"].HasMember("base64"))
-        {
-            base64_str = jvalue["data"]["base64"].GetString();
-        }
-        else
+        if( !jvalue.HasMember("data") || 
+            !jvalue["data"].HasMember("base64") ||
+            !jvalue["data"]["base64"].IsString())
         {
             CONDUIT_ERROR("conduit_base64_json protocol error: missing data/base64");
         }
-        
+
+        const rapidjson::Value &b64_value = jvalue["data"]["base64"];
+
+        Schema s;
         if (jvalue.HasMember("schema"))
         {
             // parse schema
@@ -1170,23 +1465,18 @@ Generator::Parser::parse_base64(Node *node,
         {
             CONDUIT_ERROR("conduit_base64_json protocol error: missing schema");
         }
-        
-        const char *src_ptr = base64_str.c_str();
-        index_t encoded_len = (index_t) base64_str.length();
-        index_t dec_buff_size = utils::base64_decode_buffer_size(encoded_len);
-
-        // decode buffer
-        Node bb64_decode;
-        bb64_decode.set(DataType::char8_str(dec_buff_size));
-        char *decode_ptr = (char*)bb64_decode.data_ptr();
-        memset(decode_ptr,0,dec_buff_size);
-
-        utils::base64_decode(src_ptr,
-                             encoded_len,
-                             decode_ptr);
-
-        node->set(s,decode_ptr);
 
+        // allocate (zero filled) and decode from the json string directly 
+        // into the node's data
+        node->set(s);
+        index_t nbytes = node->allocated_bytes();
+        if(nbytes > 0)
+        {
+            utils::base64_decode(b64_value.GetString(),
+                                 (index_t)b64_value.GetStringLength(),
+                                 node->data_ptr(),
+                                 nbytes);
+        }
     }
     else
     {
@@ -1195,6 +1485,725 @@ Generator::Parser::parse_base64(Node *node,
 }
 
 
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::parse_json(const std::string &json,
+                              rapidjson::Document &document)
+{
+    // most inputs are strict json (with optional comments), which 
+    // rapidjson can parse directly from the source string. only inputs
+    // that use quoteless ids need the extra json_sanitize pass.
+    if(!document.Parse<rapidjson::kParseCommentsFlag>(json.c_str())
+                .HasParseError())
+    {
+        return;
+    }
+
+    std::string res = utils::json_sanitize(json);
+    if(document.Parse<rapidjson::kParseCommentsFlag>(res.c_str())
+                .HasParseError())
+    {
+        CONDUIT_JSON_PARSE_ERROR(document);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// rapidjson input stream that reads a std::istream in fixed size chunks
+// (follows rapidjson::FileReadStream)
+//---------------------------------------------------------------------------//
+class Generator::Parser::IStreamReadStream
+{
+public:
+    typedef char Ch;
+
+    IStreamReadStream(std::istream &is)
+    : m_is(is),
+      m_buffer(CHUNK_SIZE),
+      m_curr(&m_buffer[0]),
+      m_last(&m_buffer[0]),
+      m_read_count(0),
+      m_count(0),
+      m_eof(false)
+    {
+        m_buffer[0] = '\0';
+        read();
+    }
+
+    Ch      Peek() const { return *m_curr; }
+    Ch      Take() { Ch c = *m_curr; read(); return c; }
+    size_t  Tell() const { return m_count + (size_t)(m_curr - &m_buffer[0]); }
+
+    // write interface, not supported
+    void    Put(Ch) { RAPIDJSON_ASSERT(false); }
+    void    Flush() { RAPIDJSON_ASSERT(false); }
+    Ch     *PutBegin() { RAPIDJSON_ASSERT(false); return 0; }
+    size_t  PutEnd(Ch*) { RAPIDJSON_ASSERT(false); return 0; }
+
+private:
+    static const size_t CHUNK_SIZE = 64 * 1024;
+
+    void read()
+    {
+        if(m_curr < m_last)
+        {
+            ++m_curr;
+        }
+        else if(!m_eof)
+        {
+            m_count += m_read_count;
+            m_is.read(&m_buffer[0],(std::streamsize)CHUNK_SIZE);
+            m_read_count = (size_t)m_is.gcount();
+            m_curr = &m_buffer[0];
+            m_last = m_curr + m_read_count - 1;
+
+            if(m_read_count < CHUNK_SIZE)
+            {
+                m_buffer[m_read_count] = '\0';
+                ++m_last;
+                m_eof = true;
+            }
+        }
+    }
+
+    std::istream      &m_is;
+    std::vector<char>  m_buffer;
+    Ch                *m_curr;
+    Ch                *m_last;
+    size_t             m_read_count;
+    size_t             m_count;
+    bool               m_eof;
+};
+
+//---------------------------------------------------------------------------//
+// Frame types shared by the SAX handlers.
+//---------------------------------------------------------------------------//
+enum SAXFrameType
+{
+    SAX_OBJECT,          // json object holding children
+    SAX_LIST,            // json array holding children
+    SAX_NUMERIC_ARRAY,   // (json) array that may be a numeric leaf
+    SAX_UNKNOWN_OBJECT,  // (conduit_json) object before its first key
+    SAX_LEAF,            // (conduit_json) leaf dtype object
+    SAX_VALUE_ARRAY      // (conduit_json) leaf inline value array
+};
+
+//---------------------------------------------------------------------------//
+// SAX handler for the first streaming pass: builds the schema.
+//
+// Returns false (which stops the parse) for input the streaming reader
+// doesn't handle, so the caller can fall back to the DOM based walk:
+// duplicate keys, and for conduit_json, list_of schemas, "dtype" that 
+// isn't the first key of a leaf, and inline value arrays that aren't
+// numeric.
+//---------------------------------------------------------------------------//
+class Generator::Parser::SAXSchemaBuilder
+{
+public:
+    SAXSchemaBuilder(Schema &schema,
+                     bool conduit_json)
+    : m_schema(&schema),
+      m_conduit_json(conduit_json),
+      m_leaf_alloc(m_leaf_buffer,sizeof(m_leaf_buffer)),
+      m_leaf(rapidjson::kObjectType),
+      m_value_count(0)
+    {}
+
+    bool Null()
+    {
+        if(m_conduit_json)
+        {
+            return add_leaf_member(rapidjson::Value());
+        }
+        Schema *s = next_schema();
+        if(s == NULL)
+            return false;
+        s->set(DataType::empty());
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if(m_conduit_json)
+        {
+            return add_leaf_member(rapidjson::Value(b));
+        }
+        Schema *s = next_schema();
+        if(s == NULL)
+            return false;
+        // we store bools as uint8s
+        s->set(DataType::uint8(1));
+        return true;
+    }
+
+    bool Int(int v)          { return number(rapidjson::Value(v));}
+    bool Uint(unsigned v)    { return number(rapidjson::Value(v));}
+    bool Int64(int64_t v)    { return number(rapidjson::Value(v));}
+    bool Uint64(uint64_t v)  { return number(rapidjson::Value(v));}
+    bool Double(double v)    { return number(rapidjson::Value(v));}
+
+    bool String(const char *str,
+                rapidjson::SizeType len,
+                bool)
+    {
+        if(m_conduit_json)
+        {
+            if(!m_stack.empty() && m_stack.back().type == SAX_LEAF)
+            {
+                rapidjson::Value v(str,len,m_leaf_alloc);
+                return add_leaf_member(v);
+            }
+            // a leaf dtype name ("float64", etc)
+            Schema *s = next_schema();
+            if(s == NULL)
+                return false;
+            DataType dtype;
+            parse_leaf_dtype(rapidjson::Value(rapidjson::StringRef(str,len)),
+                             0,
+                             dtype);
+            s->set(dtype);
+            return true;
+        }
+
+        Schema *s = next_schema();
+        if(s == NULL)
+            return false;
+        // size including the null term
+        s->set(DataType::char8_str((index_t)strlen(str) + 1));
+        return true;
+    }
+
+    bool StartObject()
+    {
+        if(m_conduit_json)
+        {
+            Schema *s = next_schema();
+            if(s == NULL)
+                return false;
+            push(SAX_UNKNOWN_OBJECT,s);
+            return true;
+        }
+
+        Schema *s = next_schema();
+        if(s == NULL)
+            return false;
+        s->set(DataType::object());
+        push(SAX_OBJECT,s);
+        return true;
+    }
+
+    bool Key(const char *str,
+             rapidjson::SizeType len,
+             bool)
+    {
+        Frame &f = m_stack.back();
+        std::string key(str,len);
+        if(f.type == SAX_UNKNOWN_OBJECT)
+        {
+            if(key == "dtype")
+            {
+                f.type = SAX_LEAF;
+                m_leaf_alloc.Clear();
+                m_leaf.SetObject();
+                m_value_count = 0;
+            }
+            else
+            {
+                f.type = SAX_OBJECT;
+                f.schema->set(DataType::object());
+            }
+        }
+        else if(m_conduit_json && f.type == SAX_OBJECT && key == "dtype")
+        {
+            return false;
+        }
+        f.key = key;
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType)
+    {
+        Frame &f = m_stack.back();
+        if(f.type == SAX_UNKNOWN_OBJECT)
+        {
+            f.schema->set(DataType::object());
+        }
+        else if(f.type == SAX_LEAF)
+        {
+            DataType dtype;
+            parse_leaf_dtype(m_leaf,0,dtype);
+            // the "value" member holds an empty placeholder array,
+            // use the streamed count for length
+            if(dtype.number_of_elements() == 0 &&
+               m_leaf.HasMember("value") &&
+               m_leaf["value"].IsArray())
+            {
+                dtype.set_number_of_elements(m_value_count);
+            }
+            // a null inline value resets the node
+            else if(m_leaf.HasMember("value") &&
+                    m_leaf["value"].IsNull())
+            {
+                dtype.reset();
+            }
+            f.schema->set(dtype);
+        }
+        m_stack.pop_back();
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if(m_conduit_json)
+        {
+            if(!m_stack.empty() && m_stack.back().type == SAX_LEAF)
+            {
+                if(m_stack.back().key != "value")
+                    return false;
+                rapidjson::Value v(rapidjson::kArrayType);
+                if(!add_leaf_member(v))
+                    return false;
+                push(SAX_VALUE_ARRAY,m_stack.back().schema);
+                return true;
+            }
+            Schema *s = next_schema();
+            if(s == NULL)
+                return false;
+            s->set(DataType::list());
+            push(SAX_LIST,s);
+            return true;
+        }
+
+        Schema *s = next_schema();
+        if(s == NULL)
+            return false;
+        push(SAX_NUMERIC_ARRAY,s);
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType)
+    {
+        Frame &f = m_stack.back();
+        if(f.type == SAX_NUMERIC_ARRAY)
+        {
+            if(f.num_count == 0)
+            {
+                f.schema->set(DataType::list());
+            }
+            else if(f.has_float)
+            {
+                f.schema->set(DataType::float64(f.num_count));
+            }
+            else
+            {
+                f.schema->set(DataType::int64(f.num_count));
+            }
+        }
+        m_stack.pop_back();
+        return true;
+    }
+
+private:
+
+    // a run of consecutive numbers with the same json number type
+    struct NumberRun
+    {
+        index_t dtype_id;
+        index_t count;
+    };
+
+    struct Frame
+    {
+        SAXFrameType            type;
+        Schema                 *schema;
+        std::string             key;
+        // numeric array state: the number of elements, and the runs of
+        // json number types (kept to build scalar children if the array
+        // isn't numeric). Most arrays are a single run.
+        index_t                 num_count;
+        std::vector<NumberRun>  num_runs;
+        bool                    has_float;
+    };
+
+    void push(SAXFrameType type, Schema *schema)
+    {
+        m_stack.push_back(Frame());
+        Frame &f    = m_stack.back();
+        f.type      = type;
+        f.schema    = schema;
+        f.num_count = 0;
+        f.has_float = false;
+    }
+
+    // returns the dtype id the pure json walk uses for a number
+    static index_t number_dtype_id(const rapidjson::Value &v)
+    {
+        if(v.IsInt() || v.IsInt64())
+            return DataType::INT64_ID;
+        else if(v.IsUint() || v.IsUint64())
+            return DataType::UINT64_ID;
+        return DataType::FLOAT64_ID;
+    }
+
+    static DataType scalar_dtype(index_t dtype_id)
+    {
+        if(dtype_id == DataType::INT64_ID)
+            return DataType::int64(1);
+        else if(dtype_id == DataType::UINT64_ID)
+            return DataType::uint64(1);
+        return DataType::float64(1);
+    }
+
+    // returns the schema for the next value, or NULL for input we 
+    // don't handle
+    Schema *next_schema()
+    {
+        if(m_stack.empty())
+            return m_schema;
+
+        Frame &f = m_stack.back();
+        if(f.type == SAX_OBJECT)
+        {
+            if(f.schema->has_path(f.key))
+                return NULL;
+            return &f.schema->fetch(f.key);
+        }
+        else if(f.type == SAX_NUMERIC_ARRAY)
+        {
+            // not a numeric array: switch to a list, with a scalar child
+            // for each number we have already seen
+            f.schema->set(DataType::list());
+            for(size_t i=0; i < f.num_runs.size(); i++)
+            {
+                DataType dtype = scalar_dtype(f.num_runs[i].dtype_id);
+                for(index_t j=0; j < f.num_runs[i].count; j++)
+                {
+                    f.schema->append().set(dtype);
+                }
+            }
+            f.num_runs.clear();
+            f.num_count = 0;
+            f.type = SAX_LIST;
+            return &f.schema->append();
+        }
+        else if(f.type == SAX_LIST)
+        {
+            return &f.schema->append();
+        }
+        return NULL;
+    }
+
+    bool number(const rapidjson::Value &v)
+    {
+        if(m_conduit_json)
+        {
+            if(!m_stack.empty() && m_stack.back().type == SAX_VALUE_ARRAY)
+            {
+                m_value_count++;
+                return true;
+            }
+            return add_leaf_member(v);
+        }
+
+        if(!m_stack.empty() && m_stack.back().type == SAX_NUMERIC_ARRAY)
+        {
+            Frame &f = m_stack.back();
+            index_t dtype_id = number_dtype_id(v);
+            if(f.num_runs.empty() || f.num_runs.back().dtype_id != dtype_id)
+            {
+                NumberRun run;
+                run.dtype_id = dtype_id;
+                run.count    = 0;
+                f.num_runs.push_back(run);
+            }
+            f.num_runs.back().count++;
+            f.num_count++;
+            f.has_float = f.has_float || (dtype_id == DataType::FLOAT64_ID);
+            return true;
+        }
+
+        Schema *s = next_schema();
+        if(s == NULL)
+            return false;
+        s->set(scalar_dtype(number_dtype_id(v)));
+        return true;
+    }
+
+    // records a member of the conduit_json leaf being parsed
+    bool add_leaf_member(const rapidjson::Value &v)
+    {
+        if(m_stack.empty() || m_stack.back().type != SAX_LEAF)
+            return false;
+        rapidjson::Value key(m_stack.back().key.c_str(),
+                             (rapidjson::SizeType)m_stack.back().key.size(),
+                             m_leaf_alloc);
+        rapidjson::Value val(v,m_leaf_alloc);
+        m_leaf.AddMember(key,val,m_leaf_alloc);
+        return true;
+    }
+
+    Schema                              *m_schema;
+    bool                                 m_conduit_json;
+    std::vector<Frame>                   m_stack;
+    // holds the members of the conduit_json leaf being parsed
+    char                                 m_leaf_buffer[1024];
+    rapidjson::MemoryPoolAllocator<>     m_leaf_alloc;
+    rapidjson::Value                     m_leaf;
+    index_t                              m_value_count;
+};
+
+//---------------------------------------------------------------------------//
+// SAX handler for the second streaming pass: writes values into a node 
+// allocated from the schema built by SAXSchemaBuilder.
+//---------------------------------------------------------------------------//
+class Generator::Parser::SAXValueWriter
+{
+public:
+    SAXValueWriter(Node &node,
+                   bool conduit_json)
+    : m_node(&node),
+      m_conduit_json(conduit_json)
+    {}
+
+    bool Null()
+    {
+        // (conduit_json null inline values were applied to the schema)
+        if(!in_leaf())
+            next_node();
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        if(in_leaf())
+        {
+            if(m_stack.back().key == "value")
+                parse_inline_leaf(rapidjson::Value(b),*m_stack.back().node);
+            return true;
+        }
+        Node *n = next_node();
+        *(uint8*)n->element_ptr(0) = b ? 1 : 0;
+        return true;
+    }
+
+    bool Int(int v)          { return number((int64)v,rapidjson::Value(v));}
+    bool Uint(unsigned v)    { return number((int64)v,rapidjson::Value(v));}
+    bool Int64(int64_t v)    { return number((int64)v,rapidjson::Value(v));}
+    bool Uint64(uint64_t v)  { return number((uint64)v,rapidjson::Value(v));}
+    bool Double(double v)    { return number((float64)v,rapidjson::Value(v));}
+
+    bool String(const char *str,
+                rapidjson::SizeType len,
+                bool)
+    {
+        if(in_leaf())
+        {
+            if(m_stack.back().key == "value")
+                parse_inline_leaf(rapidjson::Value(rapidjson::StringRef(str,len)),
+                                  *m_stack.back().node);
+            return true;
+        }
+
+        Node *n = next_node();
+        // conduit_json strings are leaf dtype names, without values
+        if(!m_conduit_json)
+        {
+            memcpy(n->element_ptr(0),
+                   str,
+                   (size_t)n->dtype().number_of_elements());
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        push(m_conduit_json ? SAX_UNKNOWN_OBJECT : SAX_OBJECT, next_node());
+        return true;
+    }
+
+    bool Key(const char *str,
+             rapidjson::SizeType len,
+             bool)
+    {
+        Frame &f = m_stack.back();
+        f.key.assign(str,len);
+        if(f.type == SAX_UNKNOWN_OBJECT)
+        {
+            f.type = (f.key == "dtype") ? SAX_LEAF : SAX_OBJECT;
+        }
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType)
+    {
+        m_stack.pop_back();
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if(in_leaf())
+        {
+            // inline value array
+            push(SAX_VALUE_ARRAY,m_stack.back().node);
+            return true;
+        }
+
+        Node *n = next_node();
+        index_t dtype_id = n->dtype().id();
+        if(dtype_id == DataType::LIST_ID || dtype_id == DataType::EMPTY_ID)
+        {
+            push(SAX_LIST,n);
+        }
+        else
+        {
+            push(SAX_VALUE_ARRAY,n);
+        }
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType)
+    {
+        m_stack.pop_back();
+        return true;
+    }
+
+private:
+
+    struct Frame
+    {
+        SAXFrameType  type;
+        Node         *node;
+        std::string   key;
+        index_t       idx;
+    };
+
+    void push(SAXFrameType type, Node *node)
+    {
+        m_stack.push_back(Frame());
+        Frame &f = m_stack.back();
+        f.type   = type;
+        f.node   = node;
+        f.idx    = 0;
+    }
+
+    bool in_leaf() const
+    {
+        return !m_stack.empty() && m_stack.back().type == SAX_LEAF;
+    }
+
+    Node *next_node()
+    {
+        if(m_stack.empty())
+            return m_node;
+
+        Frame &f = m_stack.back();
+        if(f.type == SAX_OBJECT)
+            return &f.node->fetch(f.key);
+        // list
+        return &f.node->child(f.idx++);
+    }
+
+    template<typename T>
+    bool number(T v, const rapidjson::Value &jvalue)
+    {
+        if(in_leaf())
+        {
+            if(m_stack.back().key == "value")
+                parse_inline_leaf(jvalue,*m_stack.back().node);
+            return true;
+        }
+
+        if(!m_stack.empty() && m_stack.back().type == SAX_VALUE_ARRAY)
+        {
+            Frame &f = m_stack.back();
+            CONDUIT_ASSERT( (f.idx < f.node->dtype().number_of_elements() ),
+                           "JSON Generator error:\n" 
+                            << "number of elements in JSON array is more"
+                            << "than dtype can hold");
+            set_element(*f.node,f.idx++,v);
+            return true;
+        }
+
+        set_element(*next_node(),0,v);
+        return true;
+    }
+
+    template<typename T>
+    static void set_element(Node &node, index_t idx, T v)
+    {
+        void *ptr = node.element_ptr(idx);
+        switch(node.dtype().id())
+        {
+            // signed ints
+            case DataType::INT8_ID:    *(int8*)ptr    = (int8)v;    break;
+            case DataType::INT16_ID:   *(int16*)ptr   = (int16)v;   break;
+            case DataType::INT32_ID:   *(int32*)ptr   = (int32)v;   break;
+            case DataType::INT64_ID:   *(int64*)ptr   = (int64)v;   break;
+            // unsigned ints
+            case DataType::UINT8_ID:   *(uint8*)ptr   = (uint8)v;   break;
+            case DataType::UINT16_ID:  *(uint16*)ptr  = (uint16)v;  break;
+            case DataType::UINT32_ID:  *(uint32*)ptr  = (uint32)v;  break;
+            case DataType::UINT64_ID:  *(uint64*)ptr  = (uint64)v;  break;
+            // floats
+            case DataType::FLOAT32_ID: *(float32*)ptr = (float32)v; break;
+            case DataType::FLOAT64_ID: *(float64*)ptr = (float64)v; break;
+            default:
+                CONDUIT_ERROR("JSON Generator error:\n"
+                               << "attempting to set non-numeric Node with"
+                               << " a numeric array");
+                break;
+        }
+    }
+
+    Node               *m_node;
+    bool                m_conduit_json;
+    std::vector<Frame>  m_stack;
+};
+
+//---------------------------------------------------------------------------//
+bool
+Generator::Parser::walk_json_stream(std::istream &is,
+                                    bool conduit_json,
+                                    Node &node)
+{
+    std::streampos start = is.tellg();
+
+    // first pass: schema
+    Schema s;
+    {
+        IStreamReadStream istream(is);
+        SAXSchemaBuilder builder(s,conduit_json);
+        rapidjson::Reader reader;
+        if(reader.Parse<rapidjson::kParseCommentsFlag>(istream,builder)
+                 .IsError())
+        {
+            return false;
+        }
+    }
+
+    Schema s_compact;
+    s.compact_to(s_compact);
+    node.reset();
+    node.set(s_compact);
+
+    // second pass: values
+    is.clear();
+    is.seekg(start);
+    IStreamReadStream istream(is);
+    SAXValueWriter writer(node,conduit_json);
+    rapidjson::Reader reader;
+    if(reader.Parse<rapidjson::kParseCommentsFlag>(istream,writer).IsError())
+    {
+        CONDUIT_ERROR("JSON parse error: \n"
+                      << " offset: " << reader.GetErrorOffset()
+                      << "\n"
+                      << " message:\n"
+                      << GetParseError_En(reader.GetParseErrorCode())
+                      << "\n");
+    }
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // -- end conduit::Generator::Parser --
 //-----------------------------------------------------------------------------
@@ -1278,12 +2287,7 @@ Generator::walk(Schema &schema) const
 {
     schema.reset();
     rapidjson::Document document;
-    std::string res = utils::json_sanitize(m_json_schema);
-
-    if(document.Parse<0>(res.c_str()).HasParseError())
-    {
-        CONDUIT_JSON_PARSE_ERROR(document);
-    }
+    Parser::parse_json(m_json_schema,document);
     index_t curr_offset = 0;
     Parser::walk_json_schema(&schema,document,curr_offset);
 }
@@ -1292,10 +2296,87 @@ Generator::walk(Schema &schema) const
 void 
 Generator::walk(Node &node) const
 {
-    /// TODO: This is an inefficient code path, need better solution?
-    Node n;
-    walk_external(n);
-    n.compact_to(node);
+    // when we own the data, we build the compact schema from the 
+    // document, allocate once, and write the values in place.
+    // other cases use walk_external + compact_to.
+    if(m_protocol == "json")
+    {
+        rapidjson::Document document;
+        Parser::parse_json(m_json_schema,document);
+
+        Schema s;
+        if(Parser::walk_pure_json_schema(&s,document,0))
+        {
+            node.reset();
+            node.set(s);
+            Parser::parse_pure_json_values(node,document);
+        }
+        else
+        {
+            Node n;
+            Parser::walk_pure_json_schema(&n,
+                                          n.schema_ptr(),
+                                          document);
+            n.compact_to(node);
+        }
+    }
+    else if(m_protocol == "conduit_json" && m_data == NULL)
+    {
+        rapidjson::Document document;
+        Parser::parse_json(m_json_schema,document);
+
+        if(!Parser::check_json_schema_references(document))
+        {
+            Schema s;
+            Parser::walk_json_schema(&s,document,0);
+            Schema s_compact;
+            s.compact_to(s_compact);
+            node.reset();
+            node.set(s_compact);
+            Parser::parse_inline_values(node,document);
+        }
+        else
+        {
+            Node n;
+            Parser::walk_json_schema(&n,
+                                     n.schema_ptr(),
+                                     m_data,
+                                     document,
+                                     0);
+            n.compact_to(node);
+        }
+    }
+    else
+    {
+        Node n;
+        walk_external(n);
+        n.compact_to(node);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void 
+Generator::walk(std::istream &is, Node &node) const
+{
+    std::streampos start = is.tellg();
+
+    if( (m_protocol == "json" ||
+        (m_protocol == "conduit_json" && m_data == NULL)) &&
+        start != std::streampos(-1))
+    {
+        if(Parser::walk_json_stream(is,m_protocol == "conduit_json",node))
+        {
+            return;
+        }
+        // not handled by the streaming reader, rewind for the fallback
+        is.clear();
+        is.seekg(start);
+    }
+
+    std::string json((std::istreambuf_iterator<char>(is)),
+                     std::istreambuf_iterator<char>());
+    Generator g(json,m_protocol,m_data);
+    g.walk(node);
 }
 
 //---------------------------------------------------------------------------//
@@ -1307,12 +2388,7 @@ Generator::walk_external(Node &node) const
     if(m_protocol == "json")
     {
         rapidjson::Document document;
-        std::string res = utils::json_sanitize(m_json_schema);
-                
-        if(document.Parse<0>(res.c_str()).HasParseError())
-        {
-            CONDUIT_JSON_PARSE_ERROR(document);
-        }
+        Parser::parse_json(m_json_schema,document);
 
         Parser::walk_pure_json_schema(&node,
                                       node.schema_ptr(),
@@ -1321,26 +2397,17 @@ Generator::walk_external(Node &node) const
     else if( m_protocol == "conduit_base64_json")
     {
         rapidjson::Document document;
-        std::string res = utils::json_sanitize(m_json_schema);
-        
-        if(document.Parse<0>(res.c_str()).HasParseError())
-        {
-            CONDUIT_JSON_PARSE_ERROR(document);
-        }
+        Parser::parse_json(m_json_schema,document);
+
         Parser::parse_base64(&node,
                              document);
     }
     else if( m_protocol == "conduit_json")
     {
         rapidjson::Document document;
-        std::string res = utils::json_sanitize(m_json_schema);
-        
-        if(document.Parse<0>(res.c_str()).HasParseError())
-        {
-            CONDUIT_JSON_PARSE_ERROR(document);
-        }
-        index_t curr_offset = 0;
+        Parser::parse_json(m_json_schema,document);
 
+        index_t curr_offset = 0;
         Parser::walk_json_schema(&node,
                                  node.schema_ptr(),
                                  m_data,
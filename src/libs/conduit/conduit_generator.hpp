@@ -51,6 +51,11 @@
 #ifndef CONDUIT_GENERATOR_HPP
 #define CONDUIT_GENERATOR_HPP
 
+//-----------------------------------------------------------------------------
+// -- standard lib includes -- 
+//-----------------------------------------------------------------------------
+#include <iosfwd>
+
 //-----------------------------------------------------------------------------
 // -- conduit includes -- 
 //-----------------------------------------------------------------------------
@@ -126,6 +131,19 @@ public:
     void walk(Node &ndest) const;
     void walk_external(Node &ndest) const;
 
+    /// parse json read from a stream to a Node object, using this 
+    /// generator's protocol (the json schema string is not used).
+    ///
+    /// "json" and "conduit_json" (without a data pointer) inputs are 
+    /// parsed with a streaming (SAX) reader in two passes over the 
+    /// stream: the first builds the compact schema, the second writes
+    /// values straight into the node's single allocation. No json DOM
+    /// or copy of the stream is held in memory. Other protocols, 
+    /// non-seekable streams, and inputs the streaming reader does not 
+    /// handle (quoteless json, list_of schemas, etc) are read into 
+    /// memory and parsed via walk(Node&).
+    void walk(std::istream &is, Node &ndest) const;
+
     // private class used to encapsulate RapidJSON logic. 
     class Parser;
 
@@ -54,6 +54,7 @@
 //-----------------------------------------------------------------------------
 #include <iostream>
 #include <map>
+#include <new>
 
 //-----------------------------------------------------------------------------
 // -- standard c lib includes -- 
@@ -157,6 +158,41 @@ Node::reset()
 {
     release();
     m_schema->set(DataType::EMPTY_ID);
+
+    // all objects carved from the arena have been destroyed at this point,
+    // hand the blocks back in one shot
+    if(m_owns_arena)
+    {
+        m_arena->release();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::enable_arena(index_t block_bytes)
+{
+    if(m_arena != NULL)
+    {
+        // already enabled
+        return;
+    }
+
+    if(!is_root())
+    {
+        CONDUIT_ERROR("<Node::enable_arena> arena allocation can only be "
+                      "enabled on a root node. Node(" << path() << ")"
+                      " is not a root node.");
+    }
+
+    if(number_of_children() > 0)
+    {
+        CONDUIT_ERROR("<Node::enable_arena> arena allocation can only be "
+                      "enabled on a node without children.");
+    }
+
+    m_arena = new Arena(block_bytes);
+    m_owns_arena = true;
+    m_schema->m_arena = m_arena;
 }
 
 //-----------------------------------------------------------------------------
@@ -352,7 +388,12 @@ void
 Node::load(const std::string &ibase,
            const std::string &protocol)
 {
-    if(protocol == "conduit_bin")
+    if(protocol == "conduit_sbin" ||
+       (protocol == "conduit_bin" && is_sbin_file(ibase)))
+    {
+        load_sbin(ibase);
+    }
+    else if(protocol == "conduit_bin")
     {
         // TODO: use generator?
         Schema s;
@@ -368,11 +409,12 @@ Node::load(const std::string &ibase,
         ifile.open(ibase.c_str());
         if(!ifile.is_open())
             CONDUIT_ERROR("<Node::load> failed to open: " << ibase);
-        std::string json_data((std::istreambuf_iterator<char>(ifile)),
-                               std::istreambuf_iterator<char>());
-        
-        Generator g(json_data,protocol);
-        g.walk(*this);
+
+        // stream the file through the generator, rather than reading
+        // it into memory
+        Generator g;
+        g.set_protocol(protocol);
+        g.walk(ifile,*this);
     }
         
 }
@@ -382,7 +424,11 @@ void
 Node::save(const std::string &obase,
            const std::string &protocol) const
 {
-    if(protocol == "conduit_bin")
+    if(protocol == "conduit_sbin")
+    {
+        save_sbin(obase);
+    }
+    else if(protocol == "conduit_bin")
     {
         Node res;
         compact_to(res);
@@ -402,6 +448,12 @@ Node::save(const std::string &obase,
 void
 Node::mmap(const std::string &stream_path)
 {
+    if(is_sbin_file(stream_path))
+    {
+        mmap_sbin(stream_path);
+        return;
+    }
+
     std::string ifschema = stream_path + "_json";
 
 
@@ -438,6 +490,423 @@ Node::mmap(const std::string &stream_path,
     m_mmaped = true;
 }
 
+
+//-----------------------------------------------------------------------------
+// -- "conduit_sbin" single file protocol --
+//
+// layout:
+//  [header (64 bytes)][binary schema][pad][data]
+//
+// header (all fields little endian):
+//   0: magic (8 bytes)
+//   8: uint32 format version
+//  12: uint32 header bytes
+//  16: uint64 schema offset
+//  24: uint64 schema bytes
+//  32: uint64 data offset
+//  40: uint64 data bytes
+//  48: uint64 schema checksum
+//  56: uint64 data checksum
+//
+// Leaf offsets in the stored schema are relative to the data offset, and 
+// both the data offset and every leaf offset are aligned to 
+// CONDUIT_SBIN_ALIGNMENT bytes, so a mmaped file can be used in place.
+//
+// A data checksum of zero means the data is not checked. mmap does not
+// verify the data checksum. While a file is mapped its data checksum is
+// zero, since writes through the map would invalidate it, and the 
+// checksum of the mapped data is written back when the map is released.
+//-----------------------------------------------------------------------------
+#define CONDUIT_SBIN_VERSION       1
+#define CONDUIT_SBIN_HEADER_BYTES  64
+#define CONDUIT_SBIN_ALIGNMENT     64
+
+static const char CONDUIT_SBIN_MAGIC[8] = {'C','O','N','D','S','B','I','N'};
+
+//---------------------------------------------------------------------------//
+static index_t
+sbin_align(index_t v)
+{
+    return ((v + CONDUIT_SBIN_ALIGNMENT - 1) / CONDUIT_SBIN_ALIGNMENT)
+            * CONDUIT_SBIN_ALIGNMENT;
+}
+
+//---------------------------------------------------------------------------//
+static void
+sbin_write_uint(uint8 *dest, uint64 v, int nbytes)
+{
+    for(int i=0; i < nbytes; i++)
+    {
+        dest[i] = (uint8)(v >> (8*i));
+    }
+}
+
+//---------------------------------------------------------------------------//
+static uint64
+sbin_read_uint(const uint8 *src, int nbytes)
+{
+    uint64 res = 0;
+    for(int i=0; i < nbytes; i++)
+    {
+        res |= ((uint64)src[i]) << (8*i);
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+// assigns aligned offsets (relative to the start of the data section) to 
+// the leaves of a compact schema and makes default endianness explicit, 
+// since the file may be read on another machine. 
+// returns the end offset of the last leaf.
+//---------------------------------------------------------------------------//
+static index_t
+sbin_layout_schema(Schema &s, index_t curr_offset)
+{
+    index_t dtype_id = s.dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        index_t nchildren = s.number_of_children();
+        for(index_t i=0; i < nchildren; i++)
+        {
+            curr_offset = sbin_layout_schema(s.child(i),curr_offset);
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        DataType &dt = s.dtype();
+        curr_offset = sbin_align(curr_offset);
+        dt.set_offset(curr_offset);
+        if(dt.endianness() == Endianness::DEFAULT_ID)
+        {
+            dt.set_endianness(Endianness::machine_default());
+        }
+        curr_offset += dt.number_of_elements() * dt.element_bytes();
+    }
+    return curr_offset;
+}
+
+//---------------------------------------------------------------------------//
+struct SBinHeader
+{
+    uint64 schema_offset;
+    uint64 schema_bytes;
+    uint64 data_offset;
+    uint64 data_bytes;
+    uint64 schema_checksum;
+    uint64 data_checksum;
+};
+
+//---------------------------------------------------------------------------//
+// reads and validates the header and the schema of a "conduit_sbin" file
+//---------------------------------------------------------------------------//
+static void
+sbin_read_header_and_schema(std::ifstream &ifs,
+                            const std::string &stream_path,
+                            SBinHeader &hdr,
+                            Schema &s)
+{
+    uint8 hbuff[CONDUIT_SBIN_HEADER_BYTES];
+    ifs.read((char*)hbuff,CONDUIT_SBIN_HEADER_BYTES);
+
+    if(!ifs || memcmp(hbuff,CONDUIT_SBIN_MAGIC,8) != 0)
+    {
+        CONDUIT_ERROR("<Node::load> " << stream_path
+                      << " is not a conduit_sbin file");
+    }
+
+    uint64 version = sbin_read_uint(&hbuff[8],4);
+    if(version != CONDUIT_SBIN_VERSION)
+    {
+        CONDUIT_ERROR("<Node::load> unsupported conduit_sbin version "
+                      << version << " in " << stream_path);
+    }
+
+    hdr.schema_offset   = sbin_read_uint(&hbuff[16],8);
+    hdr.schema_bytes    = sbin_read_uint(&hbuff[24],8);
+    hdr.data_offset     = sbin_read_uint(&hbuff[32],8);
+    hdr.data_bytes      = sbin_read_uint(&hbuff[40],8);
+    hdr.schema_checksum = sbin_read_uint(&hbuff[48],8);
+    hdr.data_checksum   = sbin_read_uint(&hbuff[56],8);
+
+    ifs.seekg(0,std::ios_base::end);
+    uint64 file_bytes = (uint64)ifs.tellg();
+
+    if(hdr.schema_offset < CONDUIT_SBIN_HEADER_BYTES ||
+       hdr.schema_offset + hdr.schema_bytes > hdr.data_offset ||
+       hdr.data_offset + hdr.data_bytes > file_bytes ||
+       hdr.data_offset % CONDUIT_SBIN_ALIGNMENT != 0)
+    {
+        CONDUIT_ERROR("<Node::load> corrupt conduit_sbin header in "
+                      << stream_path);
+    }
+
+    std::vector<uint8> sbuff((size_t)hdr.schema_bytes);
+    ifs.seekg((std::streamoff)hdr.schema_offset,std::ios_base::beg);
+    if(!sbuff.empty())
+    {
+        ifs.read((char*)&sbuff[0],(std::streamsize)sbuff.size());
+    }
+
+    if(!ifs ||
+       utils::hash_bytes(sbuff.empty() ? NULL : &sbuff[0],
+                         (index_t)sbuff.size()) != hdr.schema_checksum)
+    {
+        CONDUIT_ERROR("<Node::load> conduit_sbin schema checksum mismatch in "
+                      << stream_path);
+    }
+
+    s.deserialize(sbuff);
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::is_sbin_file(const std::string &stream_path)
+{
+    std::ifstream ifs;
+    ifs.open(stream_path.c_str(), std::ios_base::binary);
+    if(!ifs.is_open())
+        return false;
+
+    char magic[8];
+    ifs.read(magic,8);
+    return ifs && memcmp(magic,CONDUIT_SBIN_MAGIC,8) == 0;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::serialize_sbin(std::vector<uint8> &buff) const
+{
+    Schema s_file;
+    m_schema->compact_to(s_file);
+    index_t data_bytes = sbin_layout_schema(s_file,0);
+
+    std::vector<uint8> schema_data;
+    s_file.serialize(schema_data);
+
+    index_t schema_bytes = (index_t)schema_data.size();
+    index_t data_offset  = sbin_align(CONDUIT_SBIN_HEADER_BYTES + 
+                                      schema_bytes);
+
+    // zero init, so the alignment padding is deterministic
+    buff.assign((size_t)(data_offset + data_bytes),0);
+    uint8 *data_ptr = &buff[0] + data_offset;
+
+    memcpy(&buff[CONDUIT_SBIN_HEADER_BYTES],
+           &schema_data[0],
+           (size_t)schema_bytes);
+
+    pack_to(data_ptr,s_file);
+
+    uint8 *hdr = &buff[0];
+    memcpy(hdr,CONDUIT_SBIN_MAGIC,8);
+    sbin_write_uint(&hdr[8], CONDUIT_SBIN_VERSION,4);
+    sbin_write_uint(&hdr[12],CONDUIT_SBIN_HEADER_BYTES,4);
+    sbin_write_uint(&hdr[16],CONDUIT_SBIN_HEADER_BYTES,8);
+    sbin_write_uint(&hdr[24],(uint64)schema_bytes,8);
+    sbin_write_uint(&hdr[32],(uint64)data_offset,8);
+    sbin_write_uint(&hdr[40],(uint64)data_bytes,8);
+    sbin_write_uint(&hdr[48],
+                    utils::hash_bytes(&schema_data[0],schema_bytes),
+                    8);
+    sbin_write_uint(&hdr[56],
+                    utils::hash_bytes(data_ptr,data_bytes),
+                    8);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::save_sbin(const std::string &stream_path) const
+{
+    Schema s_file;
+    m_schema->compact_to(s_file);
+    index_t data_bytes = sbin_layout_schema(s_file,0);
+
+    std::vector<uint8> schema_data;
+    s_file.serialize(schema_data);
+
+    index_t schema_bytes = (index_t)schema_data.size();
+    index_t data_offset  = sbin_align(CONDUIT_SBIN_HEADER_BYTES + 
+                                      schema_bytes);
+
+    std::ofstream ofs;
+    ofs.open(stream_path.c_str(), std::ios_base::binary);
+    if(!ofs.is_open())
+        CONDUIT_ERROR("<Node::save> failed to open: " << stream_path);
+
+    // the header is written last, once the data checksum is known.
+    // the header and padding are zeros so the file is deterministic
+    uint8 hdr[CONDUIT_SBIN_ALIGNMENT];
+    memset(hdr,0,CONDUIT_SBIN_ALIGNMENT);
+    ofs.write((const char*)hdr,CONDUIT_SBIN_HEADER_BYTES);
+    ofs.write((const char*)&schema_data[0],(std::streamsize)schema_bytes);
+    ofs.write((const char*)hdr,
+              (std::streamsize)(data_offset - CONDUIT_SBIN_HEADER_BYTES -
+                                schema_bytes));
+
+    // leaves are streamed one at a time, so no copy of the whole file
+    // is made
+    utils::Hasher data_hash;
+    index_t curr_offset = 0;
+    write_sbin_data(ofs,s_file,data_hash,curr_offset);
+
+    memcpy(hdr,CONDUIT_SBIN_MAGIC,8);
+    sbin_write_uint(&hdr[8], CONDUIT_SBIN_VERSION,4);
+    sbin_write_uint(&hdr[12],CONDUIT_SBIN_HEADER_BYTES,4);
+    sbin_write_uint(&hdr[16],CONDUIT_SBIN_HEADER_BYTES,8);
+    sbin_write_uint(&hdr[24],(uint64)schema_bytes,8);
+    sbin_write_uint(&hdr[32],(uint64)data_offset,8);
+    sbin_write_uint(&hdr[40],(uint64)data_bytes,8);
+    sbin_write_uint(&hdr[48],
+                    utils::hash_bytes(&schema_data[0],schema_bytes),
+                    8);
+    sbin_write_uint(&hdr[56],data_hash.digest(),8);
+
+    ofs.seekp(0,std::ios_base::beg);
+    ofs.write((const char*)hdr,CONDUIT_SBIN_HEADER_BYTES);
+
+    if(!ofs)
+        CONDUIT_ERROR("<Node::save> failed to write: " << stream_path);
+    ofs.close();
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::write_sbin_data(std::ostream &os,
+                      const Schema &file_schema,
+                      utils::Hasher &hasher,
+                      index_t &curr_offset) const
+{
+    index_t dtype_id = dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        for(size_t i=0; i < m_children.size(); i++)
+        {
+            m_children[i]->write_sbin_data(os,
+                                           file_schema.child((index_t)i),
+                                           hasher,
+                                           curr_offset);
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        const DataType &f_dt = file_schema.dtype();
+
+        // alignment padding
+        static const uint8 zeros[CONDUIT_SBIN_ALIGNMENT] = {0};
+        index_t pad_bytes = f_dt.offset() - curr_offset;
+        os.write((const char*)zeros,(std::streamsize)pad_bytes);
+        hasher.update(zeros,pad_bytes);
+
+        index_t num_bytes = f_dt.number_of_elements() * f_dt.element_bytes();
+        if(num_bytes == 0)
+        {
+            // nothing to write
+        }
+        else if(dtype().is_compact())
+        {
+            const uint8 *src = (const uint8*)element_ptr(0);
+            os.write((const char*)src,(std::streamsize)num_bytes);
+            hasher.update(src,num_bytes);
+        }
+        else
+        {
+            // strided leaves are compacted one at a time
+            std::vector<uint8> leaf((size_t)num_bytes);
+            compact_elements_to(&leaf[0]);
+            os.write((const char*)&leaf[0],(std::streamsize)num_bytes);
+            hasher.update(&leaf[0],num_bytes);
+        }
+
+        curr_offset = f_dt.offset() + num_bytes;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::load_sbin(const std::string &stream_path)
+{
+    std::ifstream ifs;
+    ifs.open(stream_path.c_str(), std::ios_base::binary);
+    if(!ifs.is_open())
+        CONDUIT_ERROR("<Node::load> failed to open: " << stream_path);
+
+    SBinHeader hdr;
+    Schema s;
+    sbin_read_header_and_schema(ifs,stream_path,hdr,s);
+
+    if((uint64)s.spanned_bytes() > hdr.data_bytes)
+    {
+        CONDUIT_ERROR("<Node::load> conduit_sbin schema spans past the end "
+                      "of the data in " << stream_path);
+    }
+
+    reset();
+    allocate((index_t)hdr.data_bytes);
+    ifs.seekg((std::streamoff)hdr.data_offset,std::ios_base::beg);
+    ifs.read((char *)m_data,(std::streamsize)hdr.data_bytes);
+    ifs.close();
+
+    if(hdr.data_checksum != 0 &&
+       utils::hash_bytes(m_data,(index_t)hdr.data_bytes) != hdr.data_checksum)
+    {
+        release();
+        CONDUIT_ERROR("<Node::load> conduit_sbin data checksum mismatch in "
+                      << stream_path);
+    }
+
+    // see Node::load(stream_path,schema) 
+    m_alloced = false;
+
+    m_schema->set(s);
+    walk_schema(this,m_schema,m_data);
+
+    m_alloced = true;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::mmap_sbin(const std::string &stream_path)
+{
+    SBinHeader hdr;
+    Schema s;
+    {
+        std::ifstream ifs;
+        ifs.open(stream_path.c_str(), std::ios_base::binary);
+        if(!ifs.is_open())
+            CONDUIT_ERROR("<Node::mmap> failed to open: " << stream_path);
+        sbin_read_header_and_schema(ifs,stream_path,hdr,s);
+    }
+
+    if((uint64)s.spanned_bytes() > hdr.data_bytes)
+    {
+        CONDUIT_ERROR("<Node::mmap> conduit_sbin schema spans past the end "
+                      "of the data in " << stream_path);
+    }
+
+    // note: the data checksum is not verified here, doing so would
+    // touch every page of the map.
+    reset();
+    Node::mmap(stream_path,
+               (index_t)hdr.data_bytes,
+               (index_t)hdr.data_offset);
+
+    if(hdr.data_checksum != 0)
+    {
+        mmap_sbin_track_checksum((index_t)hdr.data_offset,
+                                 (index_t)hdr.data_bytes);
+    }
+
+    // see Node::mmap(stream_path,schema) 
+    m_mmaped = false;
+
+    m_schema->set(s);
+    walk_schema(this,m_schema,m_data);
+
+    m_mmaped = true;
+}
+
 //-----------------------------------------------------------------------------
 //
 // -- end definition of Node basic i/o methods --
@@ -469,9 +938,7 @@ Node::set_node(const Node &node)
         {
             Schema *curr_schema = this->m_schema->fetch_ptr(*itr);
             size_t idx = (size_t) this->m_schema->child_index(*itr);
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(this);
+            Node *curr_node = create_child(curr_schema);
             curr_node->set(*node.m_children[idx]);
             this->append_node_ptr(curr_node);       
         }        
@@ -483,9 +950,7 @@ Node::set_node(const Node &node)
         {
             this->m_schema->append();
             Schema *curr_schema = this->m_schema->child_ptr(i);
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(this);
+            Node *curr_node = create_child(curr_schema);
             curr_node->set(*node.m_children[i]);
             this->append_node_ptr(curr_node);
         }
@@ -1165,7 +1630,8 @@ Node::set_string(const std::string &data)
                    sizeof(char),
                    Endianness::DEFAULT_ID);
     init(str_t);
-    memcpy(m_data,data.c_str(),sizeof(char)*str_size_with_term);
+    // init keeps a compatible dtype, which may carry an offset
+    memcpy(element_ptr(0),data.c_str(),sizeof(char)*str_size_with_term);
 }
 
 //---------------------------------------------------------------------------//
@@ -1188,7 +1654,7 @@ Node::set_char8_str(const char *data)
                    sizeof(char),
                    Endianness::DEFAULT_ID);
     init(str_t);
-    memcpy(m_data,data,sizeof(char)*str_size_with_term);
+    memcpy(element_ptr(0),data,sizeof(char)*str_size_with_term);
 }
 
 
@@ -6887,8 +7353,13 @@ Node::operator=(const std::vector<double> &data)
 void
 Node::serialize(std::vector<uint8> &data) const
 {
-    data = std::vector<uint8>((size_t)total_bytes_compact(),0);
-    serialize(&data[0],0);
+    // every byte is written by serialize, so an existing buffer 
+    // can be reused without clearing it
+    data.resize((size_t)total_bytes_compact());
+    if(!data.empty())
+    {
+        serialize(&data[0],0);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -7020,14 +7491,12 @@ Node::update(const Node &n_src)
                  (this->dtype().number_of_elements() >=  
                    n_src.dtype().number_of_elements())) 
         {
-            for(index_t idx = 0;
-                idx < n_src.dtype().number_of_elements();
-                idx++)
-            {
-                memcpy(element_ptr(idx),
-                       n_src.element_ptr(idx), 
-                       (size_t)this->dtype().element_bytes());
-            }
+            utils::strided_copy(element_ptr(0),
+                                this->dtype().stride(),
+                                n_src.element_ptr(0),
+                                n_src.dtype().stride(),
+                                this->dtype().element_bytes(),
+                                n_src.dtype().number_of_elements());
         }
         else // not compatible
         {
@@ -7084,14 +7553,12 @@ Node::update_compatible(const Node &n_src)
                  (this->dtype().number_of_elements() >=  
                    n_src.dtype().number_of_elements())) 
         {
-            for(index_t idx = 0;
-                idx < n_src.dtype().number_of_elements();
-                idx++)
-            {
-                memcpy(element_ptr(idx),
-                       n_src.element_ptr(idx), 
-                       (size_t)this->dtype().element_bytes());
-            }
+            utils::strided_copy(element_ptr(0),
+                                this->dtype().stride(),
+                                n_src.element_ptr(0),
+                                n_src.dtype().stride(),
+                                this->dtype().element_bytes(),
+                                n_src.dtype().number_of_elements());
         }
     }
 }
@@ -10359,116 +10826,121 @@ Node::to_json_generic(std::ostream &os,
                       const std::string &pad,
                       const std::string &eoe) const
 {
-    std::ios_base::fmtflags prev_stream_flags(os.flags());
-    os.precision(15);
+    utils::JSONWriter writer(os);
+    to_json_generic(writer,detailed,indent,depth,pad,eoe);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::to_json_generic(utils::JSONWriter &writer,
+                      bool detailed, 
+                      index_t indent, 
+                      index_t depth,
+                      const std::string &pad,
+                      const std::string &eoe) const
+{
     if(dtype().id() == DataType::OBJECT_ID)
     {
-        os << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "{" << eoe;
+        writer.write(eoe);
+        writer.indent(indent,depth,pad);
+        writer.write('{');
+        writer.write(eoe);
     
         size_t nchildren = m_children.size();
         for(size_t i=0; i <  nchildren;i++)
         {
-            utils::indent(os,indent,depth+1,pad);
-            os << "\""<< m_schema->object_order()[i] << "\": ";
-            m_children[i]->to_json_generic(os,
+            writer.indent(indent,depth+1,pad);
+            writer.write('"');
+            writer.write(m_schema->object_order()[i]);
+            writer.write("\": ",3);
+            m_children[i]->to_json_generic(writer,
                                            detailed,
                                            indent,
                                            depth+1,
                                            pad,
                                            eoe);
             if(i < nchildren-1)
-                os << ",";
-            os << eoe;
+                writer.write(',');
+            writer.write(eoe);
         }
-        utils::indent(os,indent,depth,pad);
-        os << "}";
+        writer.indent(indent,depth,pad);
+        writer.write('}');
     }
     else if(dtype().id() == DataType::LIST_ID)
     {
-        os << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "[" << eoe;
+        writer.write(eoe);
+        writer.indent(indent,depth,pad);
+        writer.write('[');
+        writer.write(eoe);
         
         size_t nchildren = m_children.size();
         for(size_t i=0; i < nchildren;i++)
         {
-            utils::indent(os,indent,depth+1,pad);
-            m_children[i]->to_json_generic(os,
+            writer.indent(indent,depth+1,pad);
+            m_children[i]->to_json_generic(writer,
                                            detailed,
                                            indent,
                                            depth+1,
                                            pad,
                                            eoe);
             if(i < nchildren-1)
-                os << ",";
-            os << eoe;
+                writer.write(',');
+            writer.write(eoe);
         }
-        utils::indent(os,indent,depth,pad);
-        os << "]";      
+        writer.indent(indent,depth,pad);
+        writer.write(']');
     }
     else // assume leaf data type
     {
         if(detailed)
         {
-            std::string dtype_json = dtype().to_json();
-            std::string dtype_open;
-            std::string dtype_rest;
-
-            // trim the last "}"
-            utils::split_string(dtype_json,
-                                "}",
-                                dtype_open,
-                                dtype_rest);
-            os<< dtype_open;
-            os << ", \"value\": ";
+            // dtype entries, without the closing "}"
+            dtype().to_json_stream(writer,false);
+            writer.write(", \"value\": ");
         }
 
         switch(dtype().id())
         {
             // ints 
             case DataType::INT8_ID:
-                as_int8_array().to_json(os);
+                as_int8_array().to_json(writer);
                 break;
             case DataType::INT16_ID:
-                as_int16_array().to_json(os);
+                as_int16_array().to_json(writer);
                 break;
             case DataType::INT32_ID:
-                as_int32_array().to_json(os);
+                as_int32_array().to_json(writer);
                 break;
             case DataType::INT64_ID:
-                as_int64_array().to_json(os);
+                as_int64_array().to_json(writer);
                 break;
             // uints 
             case DataType::UINT8_ID:
-                as_uint8_array().to_json(os);
+                as_uint8_array().to_json(writer);
                 break;
             case DataType::UINT16_ID: 
-                as_uint16_array().to_json(os);
+                as_uint16_array().to_json(writer);
                 break;
             case DataType::UINT32_ID:
-                as_uint32_array().to_json(os);
+                as_uint32_array().to_json(writer);
                 break;
             case DataType::UINT64_ID:
-                as_uint64_array().to_json(os);
+                as_uint64_array().to_json(writer);
                 break;
             // floats 
             case DataType::FLOAT32_ID:
-                as_float32_array().to_json(os);
+                as_float32_array().to_json(writer);
                 break;
             case DataType::FLOAT64_ID:
-                as_float64_array().to_json(os);
+                as_float64_array().to_json(writer);
                 break;
             // char8_str
             case DataType::CHAR8_STR_ID: 
-                os << "\"" 
-                   << utils::escape_special_chars(as_string())
-                   << "\""; 
+                writer.write_string(as_string());
                 break;
             // empty
             case DataType::EMPTY_ID: 
-                os << "null";
+                writer.write("null",4);
                 break;
 
         }
@@ -10476,11 +10948,9 @@ Node::to_json_generic(std::ostream &os,
         if(detailed)
         {
             // complete json entry 
-            os << "}";
+            writer.write('}');
         }
     }  
-    
-    os.flags(prev_stream_flags);
 }
 
 //---------------------------------------------------------------------------//
@@ -10595,54 +11065,101 @@ Node::to_base64_json(std::ostream &os,
                      const std::string &pad,
                      const std::string &eoe) const
 {
-    std::ios_base::fmtflags prev_stream_flags(os.flags());
-    os.precision(15);
-        
-    // we need compact data
-    Node n;
-    compact_to(n);
-    
-    // use libb64 to encode the data
-    index_t nbytes = n.schema().spanned_bytes();
-    index_t enc_buff_size =  utils::base64_encode_buffer_size(nbytes);
-    Node bb64_data;
-    bb64_data.set(DataType::char8_str(enc_buff_size));
-    
-    const char *src_ptr = (const char*)n.data_ptr();
-    char *dest_ptr       = (char*)bb64_data.data_ptr();
-    memset(dest_ptr,0,(size_t)enc_buff_size);
+    // the data is encoded from the leaves as we write, we only
+    // need the compact schema
+    Schema s_compact;
+    m_schema->compact_to(s_compact);
 
-    utils::base64_encode(src_ptr,nbytes,dest_ptr);
-    
     // create the resulting json
-    
-    os << eoe;
-    utils::indent(os,indent,depth,pad);
-    os << "{" << eoe;
-    utils::indent(os,indent,depth+1,pad);
-    os << "\"schema\": ";
+    utils::JSONWriter writer(os);
 
-    n.schema().to_json_stream(os,true,indent,depth+1,pad,eoe);
+    writer.write(eoe);
+    writer.indent(indent,depth,pad);
+    writer.write('{');
+    writer.write(eoe);
+    writer.indent(indent,depth+1,pad);
+    writer.write("\"schema\": ");
 
-    os  << "," << eoe;
-    
-    utils::indent(os,indent,depth+1,pad);
-    os << "\"data\": " << eoe;
-    utils::indent(os,indent,depth+1,pad);
-    os << "{" << eoe;
-    utils::indent(os,indent,depth+2,pad);
-    os << "\"base64\": ";
-    bb64_data.to_pure_json(os,0,0,"","");
-    os << eoe;
-    utils::indent(os,indent,depth+1,pad);
-    os << "}" << eoe;
-    utils::indent(os,indent,depth,pad);
-    os << "}";
+    s_compact.to_json_stream(writer,true,indent,depth+1,pad,eoe);
+
+    writer.write(',');
+    writer.write(eoe);
     
-    os.flags(prev_stream_flags);
+    writer.indent(indent,depth+1,pad);
+    writer.write("\"data\": ");
+    writer.write(eoe);
+    writer.indent(indent,depth+1,pad);
+    writer.write('{');
+    writer.write(eoe);
+    writer.indent(indent,depth+2,pad);
+    writer.write("\"base64\": ");
+    writer.begin_base64();
+    write_base64_data(writer);
+    writer.end_base64();
+    writer.write(eoe);
+    writer.indent(indent,depth+1,pad);
+    writer.write('}');
+    writer.write(eoe);
+    writer.indent(indent,depth,pad);
+    writer.write('}');
 }
 
 
+//---------------------------------------------------------------------------//
+void
+Node::write_base64_data(utils::JSONWriter &writer) const
+{
+    index_t dtype_id = dtype().id();
+    if( dtype_id == DataType::OBJECT_ID ||
+        dtype_id == DataType::LIST_ID)
+    {
+        std::vector<Node*>::const_iterator itr;
+        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
+        {
+            (*itr)->write_base64_data(writer);
+        }
+    }
+    else if( dtype_id != DataType::EMPTY_ID)
+    {
+        if(is_compact())
+        {
+            writer.write_base64_bytes(element_ptr(0),
+                                      total_bytes_compact());
+        }
+        else
+        {
+            // gather strided elements in small chunks 
+            index_t ele_bytes = dtype().element_bytes();
+            index_t num_ele   = dtype().number_of_elements();
+            uint8 chunk[4096];
+            index_t chunk_num_ele = 4096 / ele_bytes;
+            if(chunk_num_ele == 0)
+            {
+                // very wide elements, encode them one at a time
+                for(index_t i=0; i < num_ele; i++)
+                {
+                    writer.write_base64_bytes(element_ptr(i),ele_bytes);
+                }
+                return;
+            }
+
+            for(index_t i=0; i < num_ele; i+= chunk_num_ele)
+            {
+                index_t curr_num_ele = num_ele - i;
+                if(curr_num_ele > chunk_num_ele)
+                    curr_num_ele = chunk_num_ele;
+                utils::strided_copy(chunk,
+                                    ele_bytes,
+                                    element_ptr(i),
+                                    dtype().stride(),
+                                    ele_bytes,
+                                    curr_num_ele);
+                writer.write_base64_bytes(chunk,curr_num_ele * ele_bytes);
+            }
+        }
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 //
@@ -10862,9 +11379,7 @@ Node::fetch(const std::string &path)
     if(!m_schema->has_child(p_curr))
     {
         Schema *schema_ptr = m_schema->fetch_ptr(p_curr);
-        Node *curr_node = new Node();
-        curr_node->set_schema_ptr(schema_ptr);
-        curr_node->m_parent = this;
+        Node *curr_node = create_child(schema_ptr);
         m_children.push_back(curr_node);
         idx = m_children.size() - 1;
     }
@@ -10891,6 +11406,108 @@ Node::fetch(const std::string &path) const
     return fetch_child(path);
 }
 
+//---------------------------------------------------------------------------//
+Node&
+Node::fetch(const Path &path)
+{
+    Node *curr = this;
+    size_t num_comps = path.m_components.size();
+
+    for(size_t i=0; i < num_comps; i++)
+    {
+        if(path.is_parent(i))
+        {
+            if(curr->m_parent == NULL)
+            {
+                CONDUIT_ERROR("Cannot fetch from NULL parent" 
+                              << path.to_string());
+            }
+            curr = curr->m_parent;
+            continue;
+        }
+
+        index_t idx = -1;
+        if(curr->dtype().is_object())
+        {
+            idx = curr->m_schema->find_child_index(path,i);
+        }
+
+        if(idx < 0)
+        {
+            // the child doesn't exist yet, the string fetch creates it
+            // (as the last child) and links it to a schema
+            Node *parent = curr;
+            curr = &parent->fetch(path.m_components[i]);
+            path.m_indices[i] = parent->number_of_children() - 1;
+        }
+        else
+        {
+            curr = curr->m_children[(size_t)idx];
+        }
+    }
+
+    return *curr;
+}
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::fetch(const Path &path) const
+{
+    return fetch_child(path);
+}
+
+//---------------------------------------------------------------------------//
+Node&
+Node::fetch_child(const Path &path)
+{
+    const Node *res = &static_cast<const Node*>(this)->fetch_child(path);
+    return *const_cast<Node*>(res);
+}
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::fetch_child(const Path &path) const
+{
+    const Node *curr = this;
+    size_t num_comps = path.m_components.size();
+
+    for(size_t i=0; i < num_comps; i++)
+    {
+        if(path.is_parent(i))
+        {
+            if(curr->m_parent == NULL)
+            {
+                CONDUIT_ERROR("Cannot const fetch from NULL parent" 
+                              << path.to_string());
+            }
+            curr = curr->m_parent;
+            continue;
+        }
+
+        // const fetch w/ path requires object role
+        if(!curr->dtype().is_object())
+        {
+            CONDUIT_ERROR("Cannot const fetch_child, Node(" << curr->path()
+                          << ") is not an object");
+        }
+
+        index_t idx = curr->m_schema->find_child_index(path,i);
+
+        if(idx < 0)
+        {
+            CONDUIT_ERROR("Cannot const fetch non-existent " 
+                          << "child " << path.m_components[i]
+                          << " from Node("
+                          << curr->path()
+                          << ")");
+        }
+
+        curr = curr->m_children[(size_t)idx];
+    }
+
+    return *curr;
+}
+
 
 //---------------------------------------------------------------------------//
 Node&
@@ -10930,6 +11547,27 @@ Node::fetch_ptr(const std::string &path) const
     }
 }
 
+//---------------------------------------------------------------------------//
+Node *
+Node::fetch_ptr(const Path &path)
+{
+    return &fetch(path);
+}
+
+//---------------------------------------------------------------------------//
+const Node *
+Node::fetch_ptr(const Path &path) const
+{
+    if(has_path(path))
+    {
+        return &fetch(path);
+    }
+    else
+    {
+        return NULL;
+    }
+}
+
 //---------------------------------------------------------------------------//
 Node *
 Node::child_ptr(index_t idx)
@@ -10958,6 +11596,20 @@ Node::operator[](const std::string &path) const
     return fetch(path);
 }
 
+//---------------------------------------------------------------------------//
+Node&
+Node::operator[](const Path &path)
+{
+    return fetch(path);
+}
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::operator[](const Path &path) const
+{
+    return fetch(path);
+}
+
 //---------------------------------------------------------------------------//
 Node&
 Node::operator[](index_t idx)
@@ -11000,6 +11652,13 @@ Node::has_path(const std::string &path) const
     return m_schema->has_path(path);
 }
 
+//---------------------------------------------------------------------------//
+bool
+Node::has_path(const Path &path) const
+{
+    return m_schema->has_path(path);
+}
+
 //---------------------------------------------------------------------------//
 const std::vector<std::string>&
 Node::child_names() const
@@ -11019,9 +11678,7 @@ Node::append()
     m_schema->append();
     Schema *schema_ptr = m_schema->child_ptr(idx);
 
-    Node *res_node = new Node();
-    res_node->set_schema_ptr(schema_ptr);
-    res_node->m_parent=this;
+    Node *res_node = create_child(schema_ptr);
     m_children.push_back(res_node);
     return *res_node;
 }
@@ -11035,7 +11692,7 @@ Node::remove(index_t idx)
     // to cleanup
     
     // remove the proper list entry
-    delete m_children[(size_t)idx];
+    destroy_child(m_children[(size_t)idx]);
     m_schema->remove(idx);
     m_children.erase(m_children.begin() + (size_t)idx);
 }
@@ -11060,7 +11717,7 @@ Node::remove(const std::string &path)
         // schema. b/c the child pointer uses the schema
         // to cleanup
         
-        delete m_children[idx];
+        destroy_child(m_children[idx]);
         m_schema->remove(p_curr);
         m_children.erase(m_children.begin() + idx);
     }
@@ -12775,9 +13432,17 @@ class Node::MMap
       void *data_ptr() const
           { return m_data; }
 
+      //----------------------------------------------------------------------
+      // for "conduit_sbin" files: clears the data checksum while the map 
+      // is open, and writes the checksum of the data when it is closed
+      void  track_sbin_checksum(index_t data_offset,
+                                index_t data_bytes);
+
   private:
       void      *m_data;
       int        m_data_size;
+      index_t    m_sbin_data_offset;
+      index_t    m_sbin_data_bytes;
 
 #if !defined(CONDUIT_PLATFORM_WINDOWS)
       // memory-map file descriptor
@@ -12794,6 +13459,8 @@ class Node::MMap
 Node::MMap::MMap()
 : m_data(NULL),
   m_data_size(0),
+  m_sbin_data_offset(0),
+  m_sbin_data_bytes(0),
 #if !defined(CONDUIT_PLATFORM_WINDOWS)
   m_mmap_fd(-1)
 #else
@@ -12879,6 +13546,16 @@ Node::MMap::open(const std::string &path,
 #endif
 }
 
+//-----------------------------------------------------------------------------
+void
+Node::MMap::track_sbin_checksum(index_t data_offset,
+                                index_t data_bytes)
+{
+    m_sbin_data_offset = data_offset;
+    m_sbin_data_bytes  = data_bytes;
+    sbin_write_uint(((uint8*)m_data) + 56,0,8);
+}
+
 //-----------------------------------------------------------------------------
 void
 Node::MMap::close()
@@ -12886,6 +13563,17 @@ Node::MMap::close()
     // simple return if the mmap isn't active
     if(m_data == NULL)
         return;
+
+    if(m_sbin_data_offset > 0)
+    {
+        uint8 *base = (uint8*)m_data;
+        sbin_write_uint(base + 56,
+                        utils::hash_bytes(base + m_sbin_data_offset,
+                                          m_sbin_data_bytes),
+                        8);
+        m_sbin_data_offset = 0;
+        m_sbin_data_bytes  = 0;
+    }
     
 #if !defined(CONDUIT_PLATFORM_WINDOWS)
     
@@ -12972,17 +13660,29 @@ Node::allocate(index_t dsize)
 
 //---------------------------------------------------------------------------//
 void
-Node::mmap(const std::string &stream_path, index_t data_size)
+Node::mmap(const std::string &stream_path,
+           index_t data_size,
+           index_t data_offset)
 {
+    // the map always starts at the beginning of the file, data_offset 
+    // selects where our data starts within it
     m_mmap = new MMap();
-    m_mmap->open(stream_path,data_size);
-    m_data = m_mmap->data_ptr();
+    m_mmap->open(stream_path,data_offset + data_size);
+    m_data = ((uint8*)m_mmap->data_ptr()) + data_offset;
     m_data_size = data_size;
     m_alloced = false;
     m_mmaped  = true;
 }
 
 
+//---------------------------------------------------------------------------//
+void
+Node::mmap_sbin_track_checksum(index_t data_offset,
+                               index_t data_bytes)
+{
+    m_mmap->track_sbin_checksum(data_offset,data_bytes);
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::release()
@@ -12990,8 +13690,7 @@ Node::release()
     // delete all children
     for (size_t i = 0; i < m_children.size(); i++)
     {
-        Node* node = m_children[i];
-        delete node;
+        destroy_child(m_children[i]);
     }
     m_children.clear();
 
@@ -13036,6 +13735,15 @@ Node::cleanup()
     {
         m_schema->set(DataType::EMPTY_ID);
     }
+
+    // the arena must outlive all of the nodes and schemas 
+    // allocated from it, so it is cleaned up last.
+    if(m_owns_arena)
+    {
+        delete m_arena;
+        m_arena = NULL;
+        m_owns_arena = false;
+    }
 }
 
 
@@ -13071,6 +13779,59 @@ Node::init_defaults()
     m_owns_schema = true;
     
     m_parent = NULL;
+
+    m_arena = NULL;
+    m_owns_arena = false;
+}
+
+
+//---------------------------------------------------------------------------//
+Node::Node(Node *parent,
+           Schema *schema_ptr)
+{
+    m_data = NULL;
+    m_data_size = 0;
+    m_alloced = false;
+
+    m_mmaped    = false;
+    m_mmap      = NULL;
+
+    m_schema = schema_ptr;
+    m_owns_schema = false;
+
+    m_parent = parent;
+
+    m_arena = parent->m_arena;
+    m_owns_arena = false;
+}
+
+//---------------------------------------------------------------------------//
+Node *
+Node::create_child(Schema *schema_ptr)
+{
+    if(m_arena != NULL)
+    {
+        return new (m_arena->allocate(sizeof(Node))) Node(this,schema_ptr);
+    }
+    else
+    {
+        return new Node(this,schema_ptr);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::destroy_child(Node *node)
+{
+    if(m_arena != NULL)
+    {
+        node->~Node();
+        m_arena->deallocate(node,sizeof(Node));
+    }
+    else
+    {
+        delete node;
+    }
 }
 
 
@@ -13094,11 +13855,8 @@ Node::walk_schema(Node   *node,
         for(size_t i=0;i< schema->children().size(); i++)
         {
     
-            std::string curr_name = schema->object_order()[i];
-            Schema *curr_schema   = schema->fetch_ptr(curr_name);
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
+            Schema *curr_schema = schema->child_ptr(i);
+            Node *curr_node = node->create_child(curr_schema);
             walk_schema(curr_node,curr_schema,data);
             node->append_node_ptr(curr_node);
         }                   
@@ -13109,9 +13867,7 @@ Node::walk_schema(Node   *node,
         for(index_t i=0;i<num_entries;i++)
         {
             Schema *curr_schema = schema->child_ptr(i);
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
+            Node *curr_node = node->create_child(curr_schema);
             walk_schema(curr_node,curr_schema,data);
             node->append_node_ptr(curr_node);
         }
@@ -13134,12 +13890,9 @@ Node::mirror_node(Node   *node,
         for(size_t i=0;i< schema->children().size(); i++)
         {
     
-            std::string curr_name = schema->object_order()[i];
-            Schema *curr_schema   = schema->fetch_ptr(curr_name);
-            Node *curr_node = new Node();
+            Schema *curr_schema = schema->child_ptr(i);
+            Node *curr_node = node->create_child(curr_schema);
             const Node *curr_src = src->child_ptr(i);
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
             mirror_node(curr_node,curr_schema,curr_src);
             node->append_node_ptr(curr_node);
         }                   
@@ -13150,10 +13903,8 @@ Node::mirror_node(Node   *node,
         for(index_t i=0;i<num_entries;i++)
         {
             Schema *curr_schema = schema->child_ptr(i);
-            Node *curr_node = new Node();
+            Node *curr_node = node->create_child(curr_schema);
             const Node *curr_src = src->child_ptr(i);
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
             mirror_node(curr_node,curr_schema,curr_src);
             node->append_node_ptr(curr_node);
         }
@@ -13206,16 +13957,13 @@ Node::compact_elements_to(uint8 *data) const
     else
     {
         // copy all elements 
-        index_t num_ele   = dtype().number_of_elements();
         index_t ele_bytes = DataType::default_bytes(dtype_id);
-        uint8 *data_ptr = data;
-        for(index_t i=0;i<num_ele;i++)
-        {
-            memcpy(data_ptr,
-                   element_ptr(i),
-                   (size_t)ele_bytes);
-            data_ptr+=ele_bytes;
-        }
+        utils::strided_copy(data,
+                            ele_bytes,
+                            element_ptr(0),
+                            dtype().stride(),
+                            ele_bytes,
+                            dtype().number_of_elements());
     }
 }
 
@@ -13231,7 +13979,8 @@ Node::serialize(uint8 *data,index_t curr_offset) const
         for(itr = m_children.begin(); itr < m_children.end(); ++itr)
         {
             (*itr)->serialize(&data[0],curr_offset);
-            curr_offset+=(*itr)->total_strided_bytes();
+            // serialize writes compact data
+            curr_offset+=(*itr)->total_bytes_compact();
         }
     }
     else
@@ -13239,7 +13988,7 @@ Node::serialize(uint8 *data,index_t curr_offset) const
         if(is_compact())
         {
             memcpy(&data[curr_offset],
-                   m_data,
+                   element_ptr(0),
                    (size_t)total_bytes_compact());
         }
         else // ser as is. This copies stride * num_ele bytes
@@ -13252,6 +14001,25 @@ Node::serialize(uint8 *data,index_t curr_offset) const
 }
 
 
+//---------------------------------------------------------------------------//
+void
+Node::pack_to(uint8 *data, const Schema &file_schema) const
+{
+    index_t dtype_id = dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        for(size_t i=0; i < m_children.size(); i++)
+        {
+            m_children[i]->pack_to(data,file_schema.child((index_t)i));
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        compact_elements_to(data + file_schema.dtype().offset());
+    }
+}
+
 //---------------------------------------------------------------------------//
 index_t
 Node::total_bytes_allocated() const
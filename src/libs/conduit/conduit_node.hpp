@@ -84,6 +84,10 @@ namespace conduit
 class Generator;
 class NodeIterator;
 class NodeConstIterator;
+namespace utils
+{
+    class Hasher;
+}
 
 //-----------------------------------------------------------------------------
 // -- begin conduit::Node --
@@ -142,6 +146,17 @@ public:
 
     // returns any node to the empty state
     void reset();
+
+    /// Enables arena allocation for this tree. 
+    ///
+    /// Once enabled, the Node and Schema objects of all descendants are 
+    /// allocated from blocks owned by this node instead of individual 
+    /// heap allocations. The blocks are freed in one shot when this node 
+    /// is reset or destroyed.
+    ///
+    /// Arena allocation can only be enabled on a root node that has no 
+    /// children.
+    void enable_arena(index_t block_bytes = Arena::DEFAULT_BLOCK_BYTES);
     
 //-----------------------------------------------------------------------------
 // -- constructors for generic types --
@@ -230,7 +245,13 @@ public:
 ///@{
 //-----------------------------------------------------------------------------
 /// description:
+///  The "conduit_bin" protocol uses a raw data file paired with a 
+///  "_json" schema file. The "conduit_sbin" protocol writes a single
+///  self-describing file: a fixed header, a binary schema, and data
+///  with each leaf aligned to 64 bytes.
 ///
+///  load(path) and mmap(path) detect "conduit_sbin" files by their 
+///  magic, regardless of the requested protocol.
 //-----------------------------------------------------------------------------
     void load(const std::string &stream_path,
               const std::string &protocol="conduit_bin");
@@ -246,6 +267,8 @@ public:
     void mmap(const std::string &stream_path,
               const Schema &schema);
 
+    /// returns true if the given file starts with the "conduit_sbin" magic
+    static bool is_sbin_file(const std::string &stream_path);
 
 
 //-----------------------------------------------------------------------------
@@ -793,6 +816,16 @@ public:
 ///    an explicit path for the destination.
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+// -- set_path using a pre-parsed Path --
+//-----------------------------------------------------------------------------
+    /// fetches the node at the given path (creating it if necessary)
+    /// and calls set() with the passed data
+    template<typename T>
+    void set_path(const Path &path,
+                  const T &data)
+        { fetch(path).set(data); }
+
 //-----------------------------------------------------------------------------
 // -- set_path for generic types --
 //-----------------------------------------------------------------------------
@@ -2696,6 +2729,10 @@ public:
     void        serialize(const std::string &stream_path) const;
     /// serialize to an output stream
     void        serialize(std::ofstream &ofs) const;
+    /// serialize to a byte vector using the self-describing 
+    /// "conduit_sbin" layout (header, binary schema and aligned data),
+    /// the in memory equivalent of save(path,"conduit_sbin")
+    void        serialize_sbin(std::vector<uint8> &data) const;
 
 //-----------------------------------------------------------------------------
 // -- compaction methods ---
@@ -3116,11 +3153,16 @@ public:
                         { return *m_schema;}   
 
     const DataType   &dtype() const       
-                        { return m_schema->dtype();}
+                        { return schema().dtype();}
 
     Schema          *schema_ptr() 
                         {return m_schema;}
 
+    // arena used to allocate the objects in this tree 
+    // (NULL if arena allocation is not enabled)
+    const Arena     *arena() const
+                        {return m_arena;}
+
     // check if data owned by this node is externally
     // allocated.
     bool             is_data_external() const
@@ -3247,6 +3289,13 @@ public:
     Node             &fetch_child(const std::string &path);
     const Node       &fetch_child(const std::string &path) const;
 
+    /// fetch variants that use a pre-parsed Path, see conduit::Path
+    Node             &fetch(const Path &path);
+    const Node       &fetch(const Path &path) const;
+
+    Node             &fetch_child(const Path &path);
+    const Node       &fetch_child(const Path &path) const;
+
     /// fetch the node at the given index
     Node             &child(index_t idx);
     const Node       &child(index_t idx) const;
@@ -3255,6 +3304,10 @@ public:
     Node             *fetch_ptr(const std::string &path);
     const Node       *fetch_ptr(const std::string &path) const;
 
+    /// the const variant returns NULL if the path does not exist
+    Node             *fetch_ptr(const Path &path);
+    const Node       *fetch_ptr(const Path &path) const;
+
     /// fetch a pointer to the node at the given index
     Node             *child_ptr(index_t idx);
     const Node       *child_ptr(index_t idx) const;
@@ -3263,6 +3316,9 @@ public:
     Node             &operator[](const std::string &path);
     const Node       &operator[](const std::string &path) const;
 
+    Node             &operator[](const Path &path);
+    const Node       &operator[](const Path &path) const;
+
     /// access child node via index (equivalent to fetch via index)
     Node             &operator[](index_t idx);
     const Node       &operator[](index_t idx) const;
@@ -3278,6 +3334,7 @@ public:
     bool        has_child(const std::string &name) const;
     /// checks if given path exists in the Node hierarchy 
     bool        has_path(const std::string &path) const;
+    bool        has_path(const Path &path) const;
     /// returns the direct child names for this node
     const std::vector<std::string> &child_names() const;
 
@@ -3546,6 +3603,18 @@ private:
     void             set_parent(Node *parent) 
                         { m_parent = parent;}
 
+    /// constructor used to create a child node bound to a schema owned by 
+    /// the parent's schema. This avoids allocating a schema that would
+    /// immediately be replaced via set_schema_ptr.
+    Node(Node *parent,
+         Schema *schema_ptr);
+
+    /// creates a new child node bound to the given schema, using this 
+    /// node's arena if present. The result is not added to m_children.
+    Node            *create_child(Schema *schema_ptr);
+    /// destroys a node created via create_child()
+    void             destroy_child(Node *node);
+
 
 //-----------------------------------------------------------------------------
 ///@}
@@ -3691,7 +3760,8 @@ private:
     void             allocate(index_t dsize);
     void             allocate(const DataType &dtype);
     void             mmap(const std::string &stream_path,
-                          index_t dsize);
+                          index_t dsize,
+                          index_t data_offset = 0);
     // release any alloced or memory mapped data
     void             release();
     // clean up everything (used by destructor)
@@ -3732,6 +3802,26 @@ private:
     void              serialize(uint8 *data,
                                 index_t curr_offset) const;
 
+    /// packs leaf data into the offsets described by a file schema
+    /// (used by the "conduit_sbin" protocol)
+    void              pack_to(uint8 *data,
+                              const Schema &file_schema) const;
+
+    /// writes leaf data to a stream at the offsets described by a file
+    /// schema, zero filling the gaps (used by the "conduit_sbin" protocol)
+    void              write_sbin_data(std::ostream &os,
+                                      const Schema &file_schema,
+                                      utils::Hasher &hasher,
+                                      index_t &curr_offset) const;
+
+    /// "conduit_sbin" single file protocol helpers
+    void              save_sbin(const std::string &stream_path) const;
+    void              load_sbin(const std::string &stream_path);
+    void              mmap_sbin(const std::string &stream_path);
+    /// keeps the data checksum of a mmaped "conduit_sbin" file in sync
+    void              mmap_sbin_track_checksum(index_t data_offset,
+                                               index_t data_bytes);
+
     /// Implements recursive check for if node is contiguous to the 
     /// passed start address. If contiguous, returns true and the 
     /// last address of the contiguous block.
@@ -3784,6 +3874,13 @@ private:
                                         index_t depth=0,
                                         const std::string &pad=" ",
                                         const std::string &eoe="\n") const;
+
+    void                to_json_generic(utils::JSONWriter &writer,
+                                        bool detailed, 
+                                        index_t indent=2, 
+                                        index_t depth=0,
+                                        const std::string &pad=" ",
+                                        const std::string &eoe="\n") const;
    
     //-------------------------------------------------------------------------
     // transforms the node to json without any conduit schema constructs
@@ -3845,6 +3942,10 @@ private:
                                     const std::string &pad=" ",
                                     const std::string &eoe="\n") const;
 
+    // streams the compact data of this node's leaves to the writer's 
+    // base64 encoder (between begin_base64() and end_base64())
+    void             write_base64_data(utils::JSONWriter &writer) const;
+
 
 //-----------------------------------------------------------------------------
 //
@@ -3881,6 +3982,12 @@ private:
     // initializing nodes using memory maps, so it is still needed apart from 
     // simply knowing if this pointer is valid.
     MMap     *m_mmap;
+
+    /// arena used to allocate descendant Node and Schema objects 
+    /// (shared with all nodes in the tree)
+    Arena    *m_arena;
+    /// flag that indicates this node created m_arena
+    bool      m_owns_arena;
 };
 //-----------------------------------------------------------------------------
 // -- end conduit::Node --
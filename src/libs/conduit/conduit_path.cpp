@@ -0,0 +1,193 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_path.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_path.hpp"
+
+//-----------------------------------------------------------------------------
+// -- conduit includes -- 
+//-----------------------------------------------------------------------------
+#include "conduit_error.hpp"
+#include "conduit_schema.hpp"
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//---------------------------------------------------------------------------//
+Path::Path()
+: m_components(),
+  m_hashes(),
+  m_indices()
+{}
+
+//---------------------------------------------------------------------------//
+Path::Path(const std::string &path)
+: m_components(),
+  m_hashes(),
+  m_indices()
+{
+    set(path);
+}
+
+//---------------------------------------------------------------------------//
+Path::Path(const Path &path)
+: m_components(path.m_components),
+  m_hashes(path.m_hashes),
+  m_indices(path.m_indices)
+{}
+
+//---------------------------------------------------------------------------//
+Path::~Path()
+{}
+
+//---------------------------------------------------------------------------//
+Path &
+Path::operator=(const Path &path)
+{
+    if(this != &path)
+    {
+        m_components = path.m_components;
+        m_hashes     = path.m_hashes;
+        m_indices    = path.m_indices;
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+void
+Path::set(const std::string &path)
+{
+    m_components.clear();
+    m_hashes.clear();
+    m_indices.clear();
+
+    // an empty path refers to the node (or schema) itself
+    if(path.empty())
+    {
+        return;
+    }
+
+    // split the same way as repeated calls to utils::split_path:
+    // a trailing "/" does not add an empty component
+    size_t start = 0;
+    while(true)
+    {
+        size_t found = path.find('/',start);
+        if(found == std::string::npos)
+        {
+            m_components.push_back(path.substr(start));
+            break;
+        }
+
+        m_components.push_back(path.substr(start,found - start));
+
+        if(found == path.size() - 1)
+        {
+            break;
+        }
+
+        start = found + 1;
+    }
+
+    m_hashes.resize(m_components.size());
+    m_indices.resize(m_components.size(),-1);
+
+    for(size_t i=0; i < m_components.size(); i++)
+    {
+        const std::string &comp = m_components[i];
+        m_hashes[i] = Schema::hash_child_name(comp.c_str(),comp.size());
+    }
+}
+
+//---------------------------------------------------------------------------//
+std::string
+Path::to_string() const
+{
+    std::string res;
+    for(size_t i=0; i < m_components.size(); i++)
+    {
+        if(i > 0)
+        {
+            res += "/";
+        }
+        res += m_components[i];
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+const std::string &
+Path::component(index_t idx) const
+{
+    if(idx < 0 || (size_t)idx >= m_components.size())
+    {
+        CONDUIT_ERROR("<Path::component> Invalid component index: "
+                      << idx << " (path has " << m_components.size()
+                      << " components)");
+    }
+
+    return m_components[(size_t)idx];
+}
+
+//---------------------------------------------------------------------------//
+bool
+Path::is_parent(size_t idx) const
+{
+    const std::string &comp = m_components[idx];
+    return comp.size() == 2 && comp[0] == '.' && comp[1] == '.';
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
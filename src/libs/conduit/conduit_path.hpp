@@ -0,0 +1,160 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_path.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_PATH_HPP
+#define CONDUIT_PATH_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes -- 
+//-----------------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes -- 
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Path --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::Path
+///
+/// description:
+///  A pre-parsed path for repeated lookups via Node::fetch, Node::has_path,
+///  Node::set_path, and Schema::fetch_child.
+///
+///  The path string is split into its components once. Each component 
+///  keeps the hash of its name and the index of the child it resolved to
+///  on the last lookup. On each use the cached index is checked against 
+///  the child name at that index, so a lookup against an unchanged layout
+///  does not split strings or allocate. If the layout changed, the child
+///  is found by name and the cached index is updated.
+///
+///  Paths can be used with any Node or Schema, the cached indices are 
+///  only hints. Since lookups update the hints, a single Path instance 
+///  should not be shared across threads.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API Path
+{
+public:
+
+//-----------------------------------------------------------------------------
+//
+// -- friends of Path --
+//
+//-----------------------------------------------------------------------------
+    friend class Node;
+    friend class Schema;
+
+//-----------------------------------------------------------------------------
+// Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// create an empty path
+    Path();
+    /// create from a path string (ex: "a/b/c")
+    explicit Path(const std::string &path);
+    /// copy constructor
+    Path(const Path &path);
+    /// Destructor
+    ~Path();
+
+    /// assignment operator
+    Path &operator=(const Path &path);
+
+    /// parse a new path string, clearing any cached indices
+    void                set(const std::string &path);
+
+//-----------------------------------------------------------------------------
+// Information Methods
+//-----------------------------------------------------------------------------
+    /// returns the path string
+    std::string         to_string() const;
+    /// returns the number of components
+    index_t             number_of_components() const
+                            { return (index_t)m_components.size();}
+    /// returns the name of the given component
+    const std::string  &component(index_t idx) const;
+
+private:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::Path private methods and data members --
+//
+//-----------------------------------------------------------------------------
+    // true if the given component refers to the parent ("..")
+    bool                is_parent(size_t idx) const;
+
+    /// component names
+    std::vector<std::string>        m_components;
+    /// hash of each component name
+    std::vector<uint64>             m_hashes;
+    /// child index each component resolved to on the last lookup
+    mutable std::vector<index_t>    m_indices;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::Path --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+
+#endif
@@ -53,6 +53,7 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <stdio.h>
+#include <new>
 
 //-----------------------------------------------------------------------------
 // -- conduit includes -- 
@@ -158,8 +159,12 @@ Schema::set(const Schema &schema)
        init_object();
        init_children = true;
 
-       object_map()   = schema.object_map();
-       object_order() = schema.object_order();
+       // the name table can be copied as is, since child indices match
+       const Schema_Object_Hierarchy *their_h = schema.object_hierarchy();
+       Schema_Object_Hierarchy *my_h = object_hierarchy();
+       my_h->object_order  = their_h->object_order;
+       my_h->object_hashes = their_h->object_hashes;
+       my_h->object_index  = their_h->object_index;
     } 
     else if (dt_id == DataType::LIST_ID)
     {
@@ -178,8 +183,8 @@ Schema::set(const Schema &schema)
        const std::vector<Schema*> &their_children = schema.children();
        for (size_t i = 0; i < their_children.size(); i++) 
        {
-           Schema *child_schema = new Schema(*their_children[i]);
-           child_schema->m_parent = this;
+           Schema *child_schema = create_child();
+           child_schema->set(*their_children[i]);
            my_children.push_back(child_schema);
        }
     }
@@ -262,44 +267,16 @@ Schema::operator=(const std::string &json_schema)
 index_t
 Schema::total_strided_bytes() const
 {
-    index_t res = 0;
-    index_t dt_id = m_dtype.id();
-    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
-    {
-        const std::vector<Schema*> &lst = children();
-        for (std::vector<Schema*>::const_iterator itr = lst.begin();
-             itr < lst.end(); ++itr)
-        {
-            res += (*itr)->total_strided_bytes();
-        }
-    }
-    else if (dt_id != DataType::EMPTY_ID)
-    {
-        res = m_dtype.strided_bytes();
-    }
-    return res;
+    update_cached_sizes();
+    return m_cached_total_strided_bytes;
 }
 
 //---------------------------------------------------------------------------//
 index_t
 Schema::total_bytes_compact() const
 {
-    index_t res = 0;
-    index_t dt_id = m_dtype.id();
-    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
-    {
-        const std::vector<Schema*> &lst = children();
-        for (std::vector<Schema*>::const_iterator itr = lst.begin();
-             itr < lst.end(); ++itr)
-        {
-            res += (*itr)->total_bytes_compact();
-        }
-    }
-    else if (dt_id != DataType::EMPTY_ID)
-    {
-        res = m_dtype.bytes_compact();
-    }
-    return res;
+    update_cached_sizes();
+    return m_cached_total_bytes_compact;
 }
 
 //---------------------------------------------------------------------------//
@@ -313,29 +290,8 @@ Schema::is_compact() const
 index_t
 Schema::spanned_bytes() const
 {
-    index_t res = 0;
-
-    index_t dt_id = m_dtype.id();
-    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
-    {
-        const std::vector<Schema*> &lst = children();
-        for (std::vector<Schema*>::const_iterator itr = lst.begin();
-             itr < lst.end(); ++itr)
-        {
-            // spanned bytes is the max of the spanned bytes of 
-            // all children
-            index_t curr_span = (*itr)->spanned_bytes();
-            if(curr_span > res)
-            {
-                res = curr_span;
-            }
-        }
-    }
-    else
-    {
-        res = m_dtype.spanned_bytes();
-    }
-    return res;
+    update_cached_sizes();
+    return m_cached_spanned_bytes;
 }
 
 
@@ -355,19 +311,18 @@ Schema::compatible(const Schema &s) const
     {
         // each of s's entries that match paths must have dtypes that match
         
-        std::map<std::string, index_t>::const_iterator itr;
+        const std::vector<std::string> &s_names = s.object_order();
         
-        for(itr  = s.object_map().begin(); 
-            itr != s.object_map().end() && res;
-            itr++)
+        for(size_t i=0; i < s_names.size() && res; i++)
         {
             // make sure we actually have the path
-            if(has_path(itr->first))
+            index_t idx = find_child_index(s_names[i]);
+            if(idx >= 0)
             {
                 // use index to fetch the child from the other schema
-                const Schema &s_chld = s.child(itr->second);
-                // fetch our child by name
-                const Schema &chld = fetch_child(itr->first);
+                const Schema &s_chld = s.child((index_t)i);
+                // fetch our child by index
+                const Schema &chld = child(idx);
                 // do compat check
                 res = chld.compatible(s_chld);
             }
@@ -413,16 +368,14 @@ Schema::equals(const Schema &s) const
     {
         // all entries must be equal
         
-        std::map<std::string, index_t>::const_iterator itr;
+        const std::vector<std::string> &s_names = s.object_order();
         
-        for(itr  = s.object_map().begin(); 
-            itr != s.object_map().end() && res;
-            itr++)
+        for(size_t i=0; i < s_names.size() && res; i++)
         {
-            if(has_path(itr->first))
+            index_t idx = find_child_index(s_names[i]);
+            if(idx >= 0)
             {
-                size_t s_idx = (size_t) itr->second;
-                res = s.children()[s_idx]->equals(fetch_child(itr->first));
+                res = s.children()[i]->equals(child(idx));
             }
             else
             {
@@ -430,14 +383,14 @@ Schema::equals(const Schema &s) const
             }
         }
         
-        for(itr  = object_map().begin(); 
-            itr != object_map().end() && res;
-            itr++)
+        const std::vector<std::string> &names = object_order();
+        
+        for(size_t i=0; i < names.size() && res; i++)
         {
-            if(s.has_path(itr->first))
+            index_t s_idx = s.find_child_index(names[i]);
+            if(s_idx >= 0)
             {
-                size_t idx = (size_t) itr->second;
-                res = children()[idx]->equals(s.fetch_child(itr->first));
+                res = children()[i]->equals(s.child(s_idx));
             }
             else
             {
@@ -507,47 +460,344 @@ Schema::to_json_stream(std::ostream &os,
                        index_t depth,
                        const std::string &pad,
                        const std::string &eoe) const
+{
+    utils::JSONWriter writer(os);
+    to_json_stream(writer,detailed,indent,depth,pad,eoe);
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::to_json_stream(utils::JSONWriter &writer,
+                       bool detailed, 
+                       index_t indent, 
+                       index_t depth,
+                       const std::string &pad,
+                       const std::string &eoe) const
 {
     if(m_dtype.id() == DataType::OBJECT_ID)
     {
-        os << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "{" << eoe;
+        writer.write(eoe);
+        writer.indent(indent,depth,pad);
+        writer.write('{');
+        writer.write(eoe);
     
         size_t nchildren = children().size();
         for(size_t i=0; i < nchildren;i++)
         {
-            utils::indent(os,indent,depth+1,pad);
-            os << "\""<< object_order()[i] << "\": ";
-            children()[i]->to_json_stream(os,detailed,indent,depth+1,pad,eoe);
+            writer.indent(indent,depth+1,pad);
+            writer.write('"');
+            writer.write(object_order()[i]);
+            writer.write("\": ",3);
+            children()[i]->to_json_stream(writer,
+                                          detailed,
+                                          indent,
+                                          depth+1,
+                                          pad,
+                                          eoe);
             if(i < nchildren-1)
-                os << ",";
-            os << eoe;
+                writer.write(',');
+            writer.write(eoe);
         }
-        utils::indent(os,indent,depth,pad);
-        os << "}";
+        writer.indent(indent,depth,pad);
+        writer.write('}');
     }
     else if(m_dtype.id() == DataType::LIST_ID)
     {
-        os << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "[" << eoe;
+        writer.write(eoe);
+        writer.indent(indent,depth,pad);
+        writer.write('[');
+        writer.write(eoe);
         
         size_t nchildren = children().size();
         for(size_t i=0; i < nchildren;i++)
         {
-            utils::indent(os,indent,depth+1,pad);
-            children()[i]->to_json_stream(os,detailed,indent,depth+1,pad,eoe);
+            writer.indent(indent,depth+1,pad);
+            children()[i]->to_json_stream(writer,
+                                          detailed,
+                                          indent,
+                                          depth+1,
+                                          pad,
+                                          eoe);
             if(i < nchildren-1)
-                os << ",";
-            os << eoe;
+                writer.write(',');
+            writer.write(eoe);
         }
-        utils::indent(os,indent,depth,pad);
-        os << "]";      
+        writer.indent(indent,depth,pad);
+        writer.write(']');
     }
     else // assume leaf data type
     {
-        m_dtype.to_json_stream(os);
+        m_dtype.to_json_stream(writer);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// helpers for the binary schema encoding
+//---------------------------------------------------------------------------//
+
+// current version of the binary schema encoding
+#define CONDUIT_SCHEMA_BINARY_VERSION 1
+
+//---------------------------------------------------------------------------//
+static void
+binary_write_varint(std::vector<uint8> &data,
+                    uint64 val)
+{
+    // LEB128: 7 bits per byte, high bit marks continuation
+    while(val >= 0x80)
+    {
+        data.push_back((uint8)(val | 0x80));
+        val >>= 7;
+    }
+    data.push_back((uint8)val);
+}
+
+//---------------------------------------------------------------------------//
+static void
+binary_write_svarint(std::vector<uint8> &data,
+                     index_t val)
+{
+    // zigzag encoding keeps small negative values small
+    uint64 uval = ((uint64)val << 1) ^ (uint64)(val >> 63);
+    binary_write_varint(data,uval);
+}
+
+//---------------------------------------------------------------------------//
+static uint64
+binary_read_varint(const uint8 *&data,
+                   const uint8 *data_end)
+{
+    uint64 res = 0;
+    int shift  = 0;
+    while(true)
+    {
+        if(data >= data_end || shift > 63)
+        {
+            CONDUIT_ERROR("<Schema::deserialize> truncated or invalid "
+                          "binary schema");
+        }
+        uint8 byte = *data++;
+        res |= ((uint64)(byte & 0x7f)) << shift;
+        if( (byte & 0x80) == 0)
+        {
+            break;
+        }
+        shift += 7;
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+static index_t
+binary_read_svarint(const uint8 *&data,
+                    const uint8 *data_end)
+{
+    uint64 uval = binary_read_varint(data,data_end);
+    return (index_t)((uval >> 1) ^ (~(uval & 1) + 1));
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::serialize(std::vector<uint8> &data) const
+{
+    // encode the tree first, collecting the distinct child names
+    std::map<std::string,index_t> names;
+    std::vector<std::string>      names_order;
+    std::vector<uint8>            tree_data;
+    index_t next_offset = 0;
+    serialize(tree_data,names,names_order,next_offset);
+
+    // layout: version, name table, tree
+    data.clear();
+    data.push_back((uint8)CONDUIT_SCHEMA_BINARY_VERSION);
+    binary_write_varint(data,(uint64)names_order.size());
+    for(size_t i=0; i < names_order.size(); i++)
+    {
+        const std::string &name = names_order[i];
+        binary_write_varint(data,(uint64)name.size());
+        data.insert(data.end(),name.begin(),name.end());
+    }
+    data.insert(data.end(),tree_data.begin(),tree_data.end());
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::serialize(std::vector<uint8> &data,
+                  std::map<std::string,index_t> &names,
+                  std::vector<std::string> &names_order,
+                  index_t &next_offset) const
+{
+    index_t dt_id = m_dtype.id();
+    binary_write_varint(data,(uint64)dt_id);
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        const std::vector<std::string> &obj_order = object_order();
+        const std::vector<Schema*> &chld = children();
+        binary_write_varint(data,(uint64)chld.size());
+        for(size_t i=0; i < chld.size(); i++)
+        {
+            const std::string &name = obj_order[i];
+            std::map<std::string,index_t>::iterator itr = names.find(name);
+            index_t name_id = 0;
+            if(itr == names.end())
+            {
+                name_id = (index_t)names_order.size();
+                names[name] = name_id;
+                names_order.push_back(name);
+            }
+            else
+            {
+                name_id = itr->second;
+            }
+            binary_write_varint(data,(uint64)name_id);
+            chld[i]->serialize(data,names,names_order,next_offset);
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        const std::vector<Schema*> &chld = children();
+        binary_write_varint(data,(uint64)chld.size());
+        for(size_t i=0; i < chld.size(); i++)
+        {
+            chld[i]->serialize(data,names,names_order,next_offset);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        // offsets, strides and element sizes are stored relative to 
+        // the values of a compact layout, so they are usually zero
+        index_t ele_bytes = m_dtype.element_bytes();
+        binary_write_varint(data,(uint64)m_dtype.number_of_elements());
+        binary_write_svarint(data,m_dtype.offset() - next_offset);
+        binary_write_svarint(data,m_dtype.stride() - ele_bytes);
+        binary_write_svarint(data,ele_bytes - 
+                                  DataType::default_bytes(dt_id));
+        binary_write_varint(data,(uint64)m_dtype.endianness());
+        next_offset = m_dtype.offset() + m_dtype.strided_bytes();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::deserialize(const std::vector<uint8> &data)
+{
+    if(data.empty())
+    {
+        CONDUIT_ERROR("<Schema::deserialize> empty binary schema");
+    }
+    deserialize(&data[0],(index_t)data.size());
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::deserialize(const uint8 *data,
+                    index_t data_nbytes)
+{
+    reset();
+
+    const uint8 *data_end = data + data_nbytes;
+
+    if(data_nbytes < 1 || data[0] != CONDUIT_SCHEMA_BINARY_VERSION)
+    {
+        CONDUIT_ERROR("<Schema::deserialize> unsupported binary schema "
+                      "version");
+    }
+    data++;
+
+    uint64 num_names = binary_read_varint(data,data_end);
+    // each name takes at least one byte
+    if(num_names > (uint64)(data_end - data))
+    {
+        CONDUIT_ERROR("<Schema::deserialize> invalid name table");
+    }
+
+    std::vector<std::string> names((size_t)num_names);
+    for(size_t i=0; i < names.size(); i++)
+    {
+        uint64 len = binary_read_varint(data,data_end);
+        if(len > (uint64)(data_end - data))
+        {
+            CONDUIT_ERROR("<Schema::deserialize> invalid name table");
+        }
+        names[i].assign((const char*)data,(size_t)len);
+        data += len;
+    }
+
+    index_t next_offset = 0;
+    deserialize(data,data_end,names,next_offset);
+
+    if(data != data_end)
+    {
+        CONDUIT_ERROR("<Schema::deserialize> unexpected trailing bytes");
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::deserialize(const uint8 *&data,
+                    const uint8 *data_end,
+                    const std::vector<std::string> &names,
+                    index_t &next_offset)
+{
+    index_t dt_id = (index_t)binary_read_varint(data,data_end);
+
+    if(dt_id != DataType::EMPTY_ID &&
+       DataType::id_to_name(dt_id) == "empty")
+    {
+        CONDUIT_ERROR("<Schema::deserialize> invalid dtype id: " << dt_id);
+    }
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        init_object();
+        uint64 num_chld = binary_read_varint(data,data_end);
+        for(uint64 i=0; i < num_chld; i++)
+        {
+            uint64 name_id = binary_read_varint(data,data_end);
+            if(name_id >= (uint64)names.size())
+            {
+                CONDUIT_ERROR("<Schema::deserialize> invalid name id: "
+                              << name_id);
+            }
+            const std::string &name = names[(size_t)name_id];
+            if(find_child_index(name) >= 0)
+            {
+                CONDUIT_ERROR("<Schema::deserialize> duplicate child name: "
+                              << name);
+            }
+            Schema *chld = create_child();
+            add_object_child(name,chld);
+            chld->deserialize(data,data_end,names,next_offset);
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        init_list();
+        uint64 num_chld = binary_read_varint(data,data_end);
+        for(uint64 i=0; i < num_chld; i++)
+        {
+            append().deserialize(data,data_end,names,next_offset);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        index_t num_ele    = (index_t)binary_read_varint(data,data_end);
+        index_t offset     = next_offset + binary_read_svarint(data,data_end);
+        index_t stride     = binary_read_svarint(data,data_end);
+        index_t ele_bytes  = DataType::default_bytes(dt_id) +
+                             binary_read_svarint(data,data_end);
+        index_t endianness = (index_t)binary_read_varint(data,data_end);
+        stride += ele_bytes;
+
+        invalidate_cached_sizes();
+        m_dtype.set(dt_id,
+                    num_ele,
+                    offset,
+                    stride,
+                    ele_bytes,
+                    endianness);
+        next_offset = offset + m_dtype.strided_bytes();
     }
 }
 
@@ -659,21 +909,19 @@ Schema::remove(index_t idx)
                     << idx << ">" << chldrn.size() <<  "(list_size)");
     }
 
-    if(dtype_id == DataType::OBJECT_ID)
-    {
-        // any index above the current needs to shift down by one
-        for (size_t i = (size_t)idx; i < object_order().size(); i++)
-        {
-            object_map()[object_order()[i]]--;
-        }
-        
-        object_map().erase(object_order()[(size_t)idx]);
-        object_order().erase(object_order().begin() + (size_t)idx);
-    }
+    invalidate_cached_sizes();
 
     Schema* child = chldrn[(size_t)idx];
-    delete child;
+    destroy_child(child);
     chldrn.erase(chldrn.begin() + (size_t)idx);
+
+    if(dtype_id == DataType::OBJECT_ID)
+    {
+        remove_object_child_index((size_t)idx);
+        Schema_Object_Hierarchy *h = object_hierarchy();
+        h->object_order.erase(h->object_order.begin() + (size_t)idx);
+        h->object_hashes.erase(h->object_hashes.begin() + (size_t)idx);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -765,18 +1013,61 @@ Schema::fetch_child(const std::string &path) const
     }
 }
 
+//---------------------------------------------------------------------------//
+Schema &
+Schema::fetch_child(const Path &path)
+{
+    const Schema *res = &static_cast<const Schema*>(this)->fetch_child(path);
+    return *const_cast<Schema*>(res);
+}
+
+//---------------------------------------------------------------------------//
+const Schema &
+Schema::fetch_child(const Path &path) const
+{
+    const Schema *curr = this;
+    size_t num_comps = path.m_components.size();
+
+    for(size_t i=0; i < num_comps; i++)
+    {
+        if(path.is_parent(i))
+        {
+            if(curr->m_parent == NULL)
+            {
+                CONDUIT_ERROR("Tried to fetch non-existent parent Schema.");
+            }
+            curr = curr->m_parent;
+            continue;
+        }
+
+        if(curr->m_dtype.id() != DataType::OBJECT_ID)
+        {
+            CONDUIT_ERROR("<Schema::child[OBJECT_ID]>: Schema is not OBJECT_ID");
+        }
+
+        index_t idx = curr->find_child_index(path,i);
+
+        if(idx < 0)
+        {
+            CONDUIT_ERROR("<Schema::child_index[OBJECT_ID]>"
+                          << "Attempt to access invalid child:"
+                          << path.m_components[i]);
+        }
+
+        curr = curr->children()[(size_t)idx];
+    }
+
+    return *curr;
+}
+
 //---------------------------------------------------------------------------//
 index_t
 Schema::child_index(const std::string &path) const
 {
-    index_t res=0;
-
-    // find p_curr with an iterator
-    std::map<std::string, index_t>::const_iterator itr;
-    itr = object_map().find(path);
+    index_t res = find_child_index(path);
 
     // error if child does not exist. 
-    if(itr == object_map().end())
+    if(res < 0)
     {
         ///
         /// TODO: Full path errors would be nice here. 
@@ -784,10 +1075,6 @@ Schema::child_index(const std::string &path) const
         CONDUIT_ERROR("<Schema::child_index[OBJECT_ID]>"
                     << "Attempt to access invalid child:" << path);
     }
-    else
-    {
-        res = itr->second;
-    }
 
     return res;
 }
@@ -829,16 +1116,15 @@ Schema::fetch(const std::string &path)
            return m_parent->fetch(p_next);
     }
     
-    if (!has_path(p_curr)) 
+    index_t c_idx = find_child_index(p_curr);
+    if(c_idx < 0) 
     {
-        Schema* my_schema = new Schema();
-        my_schema->m_parent = this;
-        children().push_back(my_schema);
-        object_map()[p_curr] = children().size() - 1;
-        object_order().push_back(p_curr);
+        Schema* my_schema = create_child();
+        add_object_child(p_curr,my_schema);
+        c_idx = (index_t)children().size() - 1;
     }
 
-    size_t idx = (size_t) child_index(p_curr);
+    size_t idx = (size_t) c_idx;
     if(p_next.empty())
     {
         return *children()[idx];
@@ -936,16 +1222,7 @@ Schema::has_child(const std::string &name) const
     if(m_dtype.id() != DataType::OBJECT_ID)
         return false;
 
-    const std::map<std::string,index_t> &ents = object_map();
-
-    if(ents.find(name) == ents.end())
-    {
-        return false;
-    }
-    else
-    {
-        return true;
-    }
+    return find_child_index(name) >= 0;
 }
 
 
@@ -963,17 +1240,16 @@ Schema::has_path(const std::string &path) const
     
     // handle parent case (..)
     
-    const std::map<std::string,index_t> &ents = object_map();
+    index_t idx = find_child_index(p_curr);
 
-    if(ents.find(p_curr) == ents.end())
+    if(idx < 0)
     {
         return false;
     }
 
     if(!p_next.empty())
     {
-        size_t idx = (size_t) ents.find(p_curr)->second;
-        return children()[idx]->has_path(p_next);
+        return children()[(size_t)idx]->has_path(p_next);
     }
     else
     {
@@ -981,6 +1257,44 @@ Schema::has_path(const std::string &path) const
     }
 }
 
+//---------------------------------------------------------------------------//
+bool
+Schema::has_path(const Path &path) const
+{
+    const Schema *curr = this;
+    size_t num_comps = path.m_components.size();
+
+    for(size_t i=0; i < num_comps; i++)
+    {
+        if(path.is_parent(i))
+        {
+            curr = curr->m_parent;
+            if(curr == NULL)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        // for the non-object case, has_path simply returns false
+        if(curr->m_dtype.id() != DataType::OBJECT_ID)
+        {
+            return false;
+        }
+
+        index_t idx = curr->find_child_index(path,i);
+
+        if(idx < 0)
+        {
+            return false;
+        }
+
+        curr = curr->children()[(size_t)idx];
+    }
+
+    return true;
+}
+
 
 //---------------------------------------------------------------------------//
 const std::vector<std::string>&
@@ -1015,15 +1329,14 @@ Schema::remove(const std::string &path)
     }
     else
     {
-        // any index above the current needs to shift down by one
-        for (size_t i = idx; i < object_order().size(); i++)
-        {
-            object_map()[object_order()[i]]--;
-        }
-        object_map().erase(p_curr);
-        object_order().erase(object_order().begin() + idx);
+        invalidate_cached_sizes();
+
+        remove_object_child_index(idx);
+        Schema_Object_Hierarchy *h = object_hierarchy();
+        h->object_order.erase(h->object_order.begin() + idx);
+        h->object_hashes.erase(h->object_hashes.begin() + idx);
         children().erase(children().begin() + idx);
-        delete child;
+        destroy_child(child);
     }    
 }
 
@@ -1032,8 +1345,8 @@ Schema &
 Schema::append()
 {
     init_list();
-    Schema *sch = new Schema();
-    sch->m_parent = this;
+    invalidate_cached_sizes();
+    Schema *sch = create_child();
     children().push_back(sch);
     return *sch;
 }
@@ -1063,17 +1376,30 @@ Schema::init_defaults()
     m_dtype  = DataType::empty();
     m_hierarchy_data = NULL;
     m_parent = NULL;
+    m_arena  = NULL;
+    m_cached_total_strided_bytes = 0;
+    m_cached_total_bytes_compact = 0;
+    m_cached_spanned_bytes       = 0;
+    m_cached_sizes_valid         = false;
 }
 
 //---------------------------------------------------------------------------//
 void
 Schema::init_object()
 {
-    if(dtype().id() != DataType::OBJECT_ID)
+    if(m_dtype.id() != DataType::OBJECT_ID)
     {
         reset();
         m_dtype  = DataType::object();
-        m_hierarchy_data = new Schema_Object_Hierarchy();
+        if(m_arena != NULL)
+        {
+            void *h_data = m_arena->allocate(sizeof(Schema_Object_Hierarchy));
+            m_hierarchy_data = new (h_data) Schema_Object_Hierarchy();
+        }
+        else
+        {
+            m_hierarchy_data = new Schema_Object_Hierarchy();
+        }
     }
 }
 
@@ -1081,11 +1407,19 @@ Schema::init_object()
 void
 Schema::init_list()
 {
-    if(dtype().id() != DataType::LIST_ID)
+    if(m_dtype.id() != DataType::LIST_ID)
     {
         reset();
         m_dtype  = DataType::list();
-        m_hierarchy_data = new Schema_List_Hierarchy();
+        if(m_arena != NULL)
+        {
+            void *h_data = m_arena->allocate(sizeof(Schema_List_Hierarchy));
+            m_hierarchy_data = new (h_data) Schema_List_Hierarchy();
+        }
+        else
+        {
+            m_hierarchy_data = new Schema_List_Hierarchy();
+        }
     }
 }
 
@@ -1094,29 +1428,144 @@ Schema::init_list()
 void
 Schema::release()
 {
-    if(dtype().id() == DataType::OBJECT_ID ||
-       dtype().id() == DataType::LIST_ID)
+    invalidate_cached_sizes();
+
+    if(m_dtype.id() == DataType::OBJECT_ID ||
+       m_dtype.id() == DataType::LIST_ID)
     {
-        std::vector<Schema*> chld = children();
+        std::vector<Schema*> &chld = children();
         for(size_t i=0; i< chld.size(); i++)
         {
-            delete chld[i];
+            destroy_child(chld[i]);
         }
     }
     
-    if(dtype().id() == DataType::OBJECT_ID)
+    if(m_dtype.id() == DataType::OBJECT_ID)
     { 
-        delete object_hierarchy();
+        Schema_Object_Hierarchy *h_data = object_hierarchy();
+        if(m_arena != NULL)
+        {
+            h_data->~Schema_Object_Hierarchy();
+            m_arena->deallocate(h_data,sizeof(Schema_Object_Hierarchy));
+        }
+        else
+        {
+            delete h_data;
+        }
     }
-    else if(dtype().id() == DataType::LIST_ID)
+    else if(m_dtype.id() == DataType::LIST_ID)
     { 
-        delete list_hierarchy();
+        Schema_List_Hierarchy *h_data = list_hierarchy();
+        if(m_arena != NULL)
+        {
+            h_data->~Schema_List_Hierarchy();
+            m_arena->deallocate(h_data,sizeof(Schema_List_Hierarchy));
+        }
+        else
+        {
+            delete h_data;
+        }
     }
 
     m_dtype  = DataType::empty();
     m_hierarchy_data = NULL;
 }
 
+//---------------------------------------------------------------------------//
+void
+Schema::update_cached_sizes() const
+{
+    if(m_cached_sizes_valid)
+    {
+        return;
+    }
+
+    index_t strided_bytes = 0;
+    index_t bytes_compact = 0;
+    index_t span_bytes    = 0;
+
+    index_t dt_id = m_dtype.id();
+    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+    {
+        const std::vector<Schema*> &lst = children();
+        for (std::vector<Schema*>::const_iterator itr = lst.begin();
+             itr < lst.end(); ++itr)
+        {
+            const Schema *chld = *itr;
+            chld->update_cached_sizes();
+            strided_bytes += chld->m_cached_total_strided_bytes;
+            bytes_compact += chld->m_cached_total_bytes_compact;
+            // spanned bytes is the max of the spanned bytes of 
+            // all children
+            if(chld->m_cached_spanned_bytes > span_bytes)
+            {
+                span_bytes = chld->m_cached_spanned_bytes;
+            }
+        }
+    }
+    else 
+    {
+        if(dt_id != DataType::EMPTY_ID)
+        {
+            strided_bytes = m_dtype.strided_bytes();
+            bytes_compact = m_dtype.bytes_compact();
+        }
+        span_bytes = m_dtype.spanned_bytes();
+    }
+
+    m_cached_total_strided_bytes = strided_bytes;
+    m_cached_total_bytes_compact = bytes_compact;
+    m_cached_spanned_bytes       = span_bytes;
+    m_cached_sizes_valid         = true;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::invalidate_cached_sizes()
+{
+    // valid totals imply valid totals for all descendants, so we can 
+    // stop at the first ancestor that is already invalid
+    Schema *curr = this;
+    while(curr != NULL && curr->m_cached_sizes_valid)
+    {
+        curr->m_cached_sizes_valid = false;
+        curr = curr->m_parent;
+    }
+}
+
+//---------------------------------------------------------------------------//
+Schema *
+Schema::create_child()
+{
+    Schema *res = NULL;
+    if(m_arena != NULL)
+    {
+        res = new (m_arena->allocate(sizeof(Schema))) Schema();
+        res->m_arena = m_arena;
+    }
+    else
+    {
+        res = new Schema();
+    }
+    res->m_parent = this;
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::destroy_child(Schema *schema)
+{
+    if(m_arena != NULL)
+    {
+        schema->~Schema();
+        m_arena->deallocate(schema,sizeof(Schema));
+    }
+    else
+    {
+        delete schema;
+    }
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -1140,9 +1589,10 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
         for(size_t i=0; i < nchildren;i++)
         {
             Schema  *cld_src = children()[i];
-            Schema &cld_dest = s_dest.fetch(object_order()[i]);
-            cld_src->compact_to(cld_dest,curr_offset);
-            curr_offset += cld_dest.total_bytes_compact();
+            Schema  *cld_dest = s_dest.create_child();
+            s_dest.add_object_child(object_order()[i],cld_dest);
+            cld_src->compact_to(*cld_dest,curr_offset);
+            curr_offset += cld_src->total_bytes_compact();
         }
     }
     else if(dtype_id == DataType::LIST_ID)
@@ -1154,7 +1604,7 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
             Schema  *cld_src = children()[i];
             Schema &cld_dest = s_dest.append();
             cld_src->compact_to(cld_dest,curr_offset);
-            curr_offset += cld_dest.total_bytes_compact();
+            curr_offset += cld_src->total_bytes_compact();
         }
     }
     else if (dtype_id != DataType::EMPTY_ID)
@@ -1162,6 +1612,7 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
         // create a compact data type
         m_dtype.compact_to(s_dest.m_dtype);
         s_dest.m_dtype.set_offset(curr_offset);
+        s_dest.invalidate_cached_sizes();
     }
 }
 
@@ -1233,13 +1684,6 @@ Schema::children()
     }
 }
 
-//---------------------------------------------------------------------------//
-std::map<std::string, index_t> &
-Schema::object_map()
-{
-    return object_hierarchy()->object_map;
-}
-
 
 //---------------------------------------------------------------------------//
 std::vector<std::string> &
@@ -1262,13 +1706,6 @@ Schema::children() const
     }
 }
 
-//---------------------------------------------------------------------------//
-const std::map<std::string, index_t> &
-Schema::object_map() const
-{
-    return object_hierarchy()->object_map;
-}
-
 
 //---------------------------------------------------------------------------//
 const std::vector<std::string> &
@@ -1294,15 +1731,215 @@ Schema::object_map_print() const
 void
 Schema::object_order_print() const
 {
+    // names in sorted order, with their indices
+    std::map<std::string, index_t> object_map;
+    size_t sz = object_order().size();
+    for(size_t i=0;i<sz;i++)
+    {
+        object_map[object_order()[i]] = (index_t)i;
+    }
+
     std::map<std::string, index_t>::const_iterator itr; 
         
-    for(itr = object_map().begin(); itr != object_map().end();itr++)
+    for(itr = object_map.begin(); itr != object_map.end();itr++)
     {
        std::cout << itr->first << ":" << itr->second << " ";
     }
     std::cout << std::endl;
 }
 
+//-----------------------------------------------------------------------------
+//
+/// -- Private methods that implement the object child name hash table. --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+uint64
+Schema::hash_child_name(const char *name,
+                        size_t len)
+{
+    // 64-bit FNV-1a
+    uint64 res = 14695981039346656037ULL;
+    for(size_t i=0; i < len; i++)
+    {
+        res ^= (uint64)(uint8)name[i];
+        res *= 1099511628211ULL;
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::find_child_index(const char *name,
+                         size_t len) const
+{
+    const Schema_Object_Hierarchy *h = object_hierarchy();
+    const std::vector<index_t> &table = h->object_index;
+
+    if(table.empty())
+    {
+        return -1;
+    }
+
+    uint64 hval = hash_child_name(name,len);
+    size_t mask = table.size() - 1;
+    size_t slot = (size_t)hval & mask;
+
+    // the table is never full, so we always find an empty slot
+    while(table[slot] >= 0)
+    {
+        size_t idx = (size_t)table[slot];
+        if(h->object_hashes[idx] == hval)
+        {
+            const std::string &cname = h->object_order[idx];
+            if(cname.size() == len && 
+               cname.compare(0,len,name,len) == 0)
+            {
+                return (index_t)idx;
+            }
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return -1;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::find_child_index(const std::string &name) const
+{
+    return find_child_index(name.c_str(),name.size());
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::find_child_index(const Path &path,
+                         size_t comp) const
+{
+    const Schema_Object_Hierarchy *h = object_hierarchy();
+    const std::string &name = path.m_components[comp];
+    index_t idx = path.m_indices[comp];
+
+    // check the cached index first, this avoids probing the hash table
+    if(idx >= 0 && 
+       (size_t)idx < h->object_order.size() &&
+       h->object_hashes[(size_t)idx] == path.m_hashes[comp] &&
+       h->object_order[(size_t)idx] == name)
+    {
+        return idx;
+    }
+
+    idx = find_child_index(name.c_str(),name.size());
+    path.m_indices[comp] = idx;
+    return idx;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::add_object_child(const std::string &name,
+                         Schema *child)
+{
+    invalidate_cached_sizes();
+
+    Schema_Object_Hierarchy *h = object_hierarchy();
+
+    h->children.push_back(child);
+    h->object_order.push_back(name);
+    h->object_hashes.push_back(hash_child_name(name.c_str(),name.size()));
+
+    // keep the load factor at or below 1/2
+    size_t num_children = h->children.size();
+    if(h->object_index.size() < 2 * num_children)
+    {
+        rebuild_object_index();
+    }
+    else
+    {
+        std::vector<index_t> &table = h->object_index;
+        size_t mask = table.size() - 1;
+        size_t slot = (size_t)h->object_hashes.back() & mask;
+        while(table[slot] >= 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        table[slot] = (index_t)(num_children - 1);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::rebuild_object_index()
+{
+    Schema_Object_Hierarchy *h = object_hierarchy();
+
+    size_t num_children = h->object_order.size();
+    size_t table_size = 8;
+    while(table_size < 2 * num_children)
+    {
+        table_size *= 2;
+    }
+
+    std::vector<index_t> &table = h->object_index;
+    table.assign(table_size,-1);
+
+    size_t mask = table_size - 1;
+    for(size_t i=0; i < num_children; i++)
+    {
+        size_t slot = (size_t)h->object_hashes[i] & mask;
+        while(table[slot] >= 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        table[slot] = (index_t)i;
+    }
+}
+
+
+//---------------------------------------------------------------------------//
+void
+Schema::remove_object_child_index(size_t idx)
+{
+    Schema_Object_Hierarchy *h = object_hierarchy();
+    std::vector<index_t> &table = h->object_index;
+    size_t mask = table.size() - 1;
+
+    // find the slot that holds idx
+    size_t hole = (size_t)h->object_hashes[idx] & mask;
+    while(table[hole] != (index_t)idx)
+    {
+        hole = (hole + 1) & mask;
+    }
+
+    // backward shift deletion: move later entries of the probe run into
+    // the hole when their home slot is at or before it, so lookups never
+    // stop early on an empty slot
+    size_t slot = (hole + 1) & mask;
+    while(table[slot] >= 0)
+    {
+        size_t home = (size_t)h->object_hashes[(size_t)table[slot]] & mask;
+        if( ((slot - home) & mask) >= ((slot - hole) & mask) )
+        {
+            table[hole] = table[slot];
+            hole = slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+    table[hole] = -1;
+
+    // the children after idx shift down by one. Done in increasing order,
+    // so the index we look for is always unique in the table.
+    size_t num_children = h->object_order.size();
+    for(size_t i = idx + 1; i < num_children; i++)
+    {
+        slot = (size_t)h->object_hashes[i] & mask;
+        while(table[slot] != (index_t)i)
+        {
+            slot = (slot + 1) & mask;
+        }
+        table[slot] = (index_t)(i - 1);
+    }
+}
 
 }
 //-----------------------------------------------------------------------------
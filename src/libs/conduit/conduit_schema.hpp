@@ -65,6 +65,8 @@
 #include "conduit_core.hpp"
 #include "conduit_endianness.hpp"
 #include "conduit_data_type.hpp"
+#include "conduit_arena.hpp"
+#include "conduit_path.hpp"
 
 
 //-----------------------------------------------------------------------------
@@ -92,6 +94,7 @@ public:
     friend class Node;
     friend class NodeIterator;
     friend class NodeConstIterator;
+    friend class Path;
 
 //----------------------------------------------------------------------------
 //
@@ -154,8 +157,10 @@ public:
     const DataType &dtype() const 
                         {return m_dtype;}
 
+    /// the non-const variant clears the cached byte totals, since the
+    /// caller may modify the data type
     DataType       &dtype() 
-                        {return m_dtype;}
+                        {invalidate_cached_sizes(); return m_dtype;}
 
     index_t         element_index(index_t idx) const 
                         {return m_dtype.element_index(idx);}
@@ -208,6 +213,23 @@ public:
                                    const std::string &pad=" ",
                                    const std::string &eoe="\n") const;
 
+    void            to_json_stream(utils::JSONWriter &writer,
+                                   bool detailed=true, 
+                                   index_t indent=2, 
+                                   index_t depth=0,
+                                   const std::string &pad=" ",
+                                   const std::string &eoe="\n") const;
+
+    /// compact binary encoding of the schema. Data type fields are 
+    /// stored as varints and each distinct child name is stored once.
+    void            serialize(std::vector<uint8> &data) const;
+
+    /// resets this schema and sets it from the binary encoding 
+    /// created by serialize()
+    void            deserialize(const uint8 *data,
+                                index_t data_nbytes);
+    void            deserialize(const std::vector<uint8> &data);
+
 //-----------------------------------------------------------------------------
 //
 /// Basic I/O methods
@@ -255,6 +277,10 @@ public:
     Schema           &fetch_child(const std::string &path);
     const Schema     &fetch_child(const std::string &path) const;
 
+    /// fetch_child variants that use a pre-parsed Path
+    Schema           &fetch_child(const Path &path);
+    const Schema     &fetch_child(const Path &path) const;
+
     /// non-const fetch with a path arg methods do modify map 
     // structure if a path doesn't exist
     Schema           &fetch(const std::string &path);
@@ -280,6 +306,7 @@ public:
     
     bool              has_child(const std::string &name) const;
     bool              has_path(const std::string &path) const;
+    bool              has_path(const Path &path) const;
     const std::vector<std::string> &child_names() const;
     void              remove(const std::string &path);
     
@@ -305,6 +332,17 @@ private:
     // cleanup any allocated memory.
     void        release();
 
+    /// creates a new child schema, using this schema's arena if present
+    Schema     *create_child();
+    /// destroys a schema created via create_child()
+    void        destroy_child(Schema *schema);
+
+    /// computes the cached byte totals for this schema and its 
+    /// descendants, if they are not already valid
+    void        update_cached_sizes() const;
+    /// clears the cached byte totals of this schema and its ancestors
+    void        invalidate_cached_sizes();
+
     /// helps with proper alloc size for:
     /// Node::set_using_schema()and Node::set_data_using_schema
     ///
@@ -322,6 +360,16 @@ private:
 //-----------------------------------------------------------------------------
     void        compact_to(Schema &s_dest, index_t curr_offset) const ;
     void        walk_schema(const std::string &json_schema);
+
+    // helpers for the binary encoding, see serialize() and deserialize()
+    void        serialize(std::vector<uint8> &data,
+                          std::map<std::string,index_t> &names,
+                          std::vector<std::string> &names_order,
+                          index_t &next_offset) const;
+    void        deserialize(const uint8 *&data,
+                            const uint8 *data_end,
+                            const std::vector<std::string> &names,
+                            index_t &next_offset);
 //-----------------------------------------------------------------------------
 //
 // -- conduit::Schema::Schema_Object_Hierarchy --
@@ -335,7 +383,14 @@ private:
     {
         std::vector<Schema*>            children;
         std::vector<std::string>        object_order;
-        std::map<std::string, index_t>  object_map;
+        /// hash of each child name (parallel to object_order)
+        std::vector<uint64>             object_hashes;
+        /// open addressing (linear probing) hash table that maps child 
+        /// names to child indices. The table size is always a power of two,
+        /// empty slots hold -1. Names are only stored in object_order,
+        /// slots are resolved by comparing the cached hash and then the
+        /// name.
+        std::vector<index_t>            object_index;
     };
 
     // this is used to return a ref to an empty list of strings as 
@@ -362,15 +417,42 @@ private:
 //-----------------------------------------------------------------------------
     // for obj and list interfaces
     std::vector<Schema*>                   &children();
-    std::map<std::string, index_t>         &object_map();
     std::vector<std::string>               &object_order();
 
     const std::vector<Schema*>             &children()  const;    
-    const std::map<std::string, index_t>   &object_map()   const;
     const std::vector<std::string>         &object_order() const;
 
     void                                   object_map_print()   const;
     void                                   object_order_print() const;
+
+//-----------------------------------------------------------------------------
+/// Helpers for the object child name hash table.
+//-----------------------------------------------------------------------------
+    /// hash used for child names
+    static uint64                          hash_child_name(const char *name,
+                                                           size_t len);
+    /// returns the index of the child with the given name, or -1 if
+    /// no such child exists. 
+    index_t                                find_child_index(const char *name,
+                                                            size_t len) const;
+    index_t                                find_child_index(
+                                                const std::string &name) const;
+    /// returns the index of the child named by the given path component,
+    /// checking the index cached in the path first and updating it on 
+    /// a miss. Returns -1 if no such child exists.
+    index_t                                find_child_index(const Path &path,
+                                                            size_t comp) const;
+    /// adds a new named child to an object schema
+    void                                   add_object_child(
+                                                const std::string &name,
+                                                Schema *child);
+    /// rebuilds the hash table from object_order (used when it grows)
+    void                                   rebuild_object_index();
+    /// removes child idx from the hash table and shifts the indices of
+    /// the following children down by one. Call before erasing the
+    /// child's name and hash.
+    void                                   remove_object_child_index(
+                                                size_t idx);
 //-----------------------------------------------------------------------------
 /// Cast helpers for hierarchy data.
 //-----------------------------------------------------------------------------
@@ -389,7 +471,7 @@ private:
     DataType    m_dtype;
     /// holds the schema hierarchy data.
     /// Instead of accessing this directly, use the private methods:
-    ///   children(), object_map(), object_order
+    ///   children(), object_order(), find_child_index()
     /// concretely, this will be:
     /// - NULL for leaf type
     /// - A Schema_Object_Hierarchy instance for schemas describing an object
@@ -398,7 +480,20 @@ private:
     /// if this schema instance has a parent, this holds the pointer to that
     /// parent
     Schema     *m_parent;
-
+    /// optional arena used to allocate child schemas and hierarchy data.
+    /// The arena is owned by the Node at the root of the tree, children 
+    /// inherit the arena of their parent.
+    Arena      *m_arena;
+
+    /// cached byte totals for the subtree rooted at this schema. 
+    /// These are computed on demand by update_cached_sizes() and cleared
+    /// by any change to this schema or its descendants.
+    /// If the totals of a schema are valid, the totals of all of its 
+    /// descendants are valid as well.
+    mutable index_t m_cached_total_strided_bytes;
+    mutable index_t m_cached_total_bytes_compact;
+    mutable index_t m_cached_spanned_bytes;
+    mutable bool    m_cached_sizes_valid;
 
 };
 //-----------------------------------------------------------------------------
@@ -82,12 +82,10 @@ static const std::string file_path_sep_string(CONDUIT_UTILS_FILE_PATH_SEPARATOR)
 
 
 //-----------------------------------------------------------------------------
-// -- libb64 includes -- 
+// -- rapidjson includes (number formatting) -- 
 //-----------------------------------------------------------------------------
-#define BUFFERSIZE 65536
-#include "b64/encode.h"
-#include "b64/decode.h"
-using namespace base64;
+#include "rapidjson/internal/dtoa.h"
+#include "rapidjson/internal/itoa.h"
 
 
 //-----------------------------------------------------------------------------
@@ -571,6 +569,43 @@ sleep(index_t milliseconds)
 
 }
 
+//-----------------------------------------------------------------------------
+Timer::Timer()
+{
+    reset();
+}
+
+//-----------------------------------------------------------------------------
+void
+Timer::reset()
+{
+    m_start = now();
+}
+
+//-----------------------------------------------------------------------------
+float64
+Timer::elapsed() const
+{
+    return now() - m_start;
+}
+
+//-----------------------------------------------------------------------------
+float64
+Timer::now()
+{
+#if defined(CONDUIT_PLATFORM_WINDOWS)
+    LARGE_INTEGER freq;
+    LARGE_INTEGER count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return ((float64)count.QuadPart) / ((float64)freq.QuadPart);
+#else // unix, etc
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((float64)ts.tv_sec) + ((float64)ts.tv_nsec) * 1.0e-9;
+#endif
+}
+
 
 //-----------------------------------------------------------------------------
 std::string
@@ -718,29 +753,96 @@ unescape_special_chars(const std::string &input)
 }
 
 
+//-----------------------------------------------------------------------------
+// helpers for base64 encoding and decoding
+//
+// The encoder maps 12 bits at a time through a table of char pairs and the 
+// decoder maps each char through a table of 6 bit values, so both handle 
+// a full 3 byte <-> 4 char group per step without any per char state.
+//-----------------------------------------------------------------------------
+static const char BASE64_CHARS[] = 
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// value used for chars outside of the base64 alphabet
+static const uint8 BASE64_INVALID = 0xFF;
+
+//-----------------------------------------------------------------------------
+struct Base64Tables
+{
+    Base64Tables()
+    {
+        for(int i=0; i < 4096; i++)
+        {
+            enc_pairs[2*i]   = BASE64_CHARS[i >> 6];
+            enc_pairs[2*i+1] = BASE64_CHARS[i & 0x3F];
+        }
+
+        memset(dec,BASE64_INVALID,256);
+        for(int i=0; i < 64; i++)
+        {
+            dec[(uint8)BASE64_CHARS[i]] = (uint8)i;
+        }
+    }
+
+    char  enc_pairs[8192];
+    uint8 dec[256];
+};
+
+static const Base64Tables base64_tables;
+
+//-----------------------------------------------------------------------------
+// encodes src_nbytes bytes into dest (with padding), returns the number
+// of chars written. Does not null terminate.
+//-----------------------------------------------------------------------------
+static index_t
+base64_encode_chars(const uint8 *src,
+                    index_t src_nbytes,
+                    char *dest)
+{
+    const char *pairs = base64_tables.enc_pairs;
+    char *dest_start  = dest;
+
+    index_t num_groups = src_nbytes / 3;
+    for(index_t i=0; i < num_groups; i++)
+    {
+        uint32 val = ((uint32)src[0] << 16) | 
+                     ((uint32)src[1] <<  8) | 
+                      (uint32)src[2];
+        memcpy(dest,     pairs + 2 * (val >> 12),   2);
+        memcpy(dest + 2, pairs + 2 * (val & 0xFFF), 2);
+        src  += 3;
+        dest += 4;
+    }
+
+    index_t rem = src_nbytes - num_groups * 3;
+    if(rem > 0)
+    {
+        uint32 val = (uint32)src[0] << 16;
+        if(rem == 2)
+        {
+            val |= (uint32)src[1] << 8;
+        }
+        dest[0] = BASE64_CHARS[(val >> 18) & 0x3F];
+        dest[1] = BASE64_CHARS[(val >> 12) & 0x3F];
+        dest[2] = (rem == 2) ? BASE64_CHARS[(val >> 6) & 0x3F] : '=';
+        dest[3] = '=';
+        dest += 4;
+    }
+
+    return (index_t)(dest - dest_start);
+}
+
 //-----------------------------------------------------------------------------
 void
 base64_encode(const void *src,
               index_t src_nbytes,
               void *dest)
 {
-    int nbytes = (int)src_nbytes;
-    base64_encodestate enc_state;
-    base64_init_encodestate(&enc_state);
-    const char *src_ptr = (const char*)src;
-    char *des_ptr       = (char*)dest;
-    memset(des_ptr,0,(size_t)base64_encode_buffer_size(src_nbytes));
-    
-    int code_len = base64_encode_block(src_ptr,
-                                       nbytes,
-                                       des_ptr,
-                                       &enc_state);
-    des_ptr += code_len;
-    code_len = base64_encode_blockend(des_ptr, &enc_state);
-    des_ptr += code_len;
-
-    // for some reason libb64 adds a newline
-    des_ptr[-1] = 0;
+    char *des_ptr = (char*)dest;
+    index_t code_len = base64_encode_chars((const uint8*)src,
+                                           src_nbytes,
+                                           des_ptr);
+    des_ptr[code_len] = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -764,15 +866,581 @@ base64_decode(const void *src,
               index_t src_nbytes,
               void *dest)
 {
-    base64_decodestate dec_state;
-    int src_len = (int)src_nbytes;
-    base64_init_decodestate(&dec_state);
-    const char *src_ptr = (const char*)src;
-    char *des_ptr = (char*)dest;
-    base64_decode_block(src_ptr,
-                        src_len,
-                        des_ptr,
-                        &dec_state);
+    // like libb64, dest must hold every decoded byte. src_nbytes chars 
+    // decode to at most (src_nbytes * 3) / 4 bytes, unpadded input 
+    // included.
+    base64_decode(src,
+                  src_nbytes,
+                  dest,
+                  (src_nbytes * 3 + 3) / 4);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+base64_decode(const void *src,
+              index_t src_nbytes,
+              void *dest,
+              index_t dest_nbytes)
+{
+    const uint8 *dec     = base64_tables.dec;
+    const uint8 *src_ptr = (const uint8*)src;
+    const uint8 *src_end = src_ptr + src_nbytes;
+    uint8 *des_ptr       = (uint8*)dest;
+    uint8 *des_end       = des_ptr + dest_nbytes;
+
+    // fast path: full groups of 4 valid chars
+    while(src_end - src_ptr >= 4 && des_end - des_ptr >= 3)
+    {
+        uint32 a = dec[src_ptr[0]];
+        uint32 b = dec[src_ptr[1]];
+        uint32 c = dec[src_ptr[2]];
+        uint32 d = dec[src_ptr[3]];
+        // valid values fit in 6 bits
+        if( ((a | b | c | d) & 0xC0) != 0)
+        {
+            // padding, whitespace, or other chars: use the slow path 
+            break;
+        }
+        uint32 val = (a << 18) | (b << 12) | (c << 6) | d;
+        des_ptr[0] = (uint8)(val >> 16);
+        des_ptr[1] = (uint8)(val >>  8);
+        des_ptr[2] = (uint8) val;
+        src_ptr += 4;
+        des_ptr += 3;
+    }
+
+    // slow path: skip chars outside the alphabet and stop at padding
+    uint32 val     = 0;
+    int    nvals   = 0;
+    while(src_ptr < src_end && *src_ptr != '=')
+    {
+        uint8 v = dec[*src_ptr++];
+        if(v == BASE64_INVALID)
+        {
+            continue;
+        }
+
+        val = (val << 6) | v;
+        nvals++;
+        if(nvals == 4)
+        {
+            if(des_end - des_ptr < 3)
+            {
+                // out of room, store what fits
+                val   >>= 6;
+                nvals   = 3;
+                break;
+            }
+            des_ptr[0] = (uint8)(val >> 16);
+            des_ptr[1] = (uint8)(val >>  8);
+            des_ptr[2] = (uint8) val;
+            des_ptr += 3;
+            val   = 0;
+            nvals = 0;
+        }
+    }
+
+    // partial group (2 chars -> 1 byte, 3 chars -> 2 bytes)
+    if(nvals == 3)
+    {
+        uint8 tail[2] = { (uint8)(val >> 10), (uint8)(val >> 2) };
+        for(int i=0; i < 2 && des_ptr < des_end; i++)
+        {
+            *des_ptr++ = tail[i];
+        }
+    }
+    else if(nvals == 2 && des_ptr < des_end)
+    {
+        *des_ptr++ = (uint8)(val >> 4);
+    }
+
+    return (index_t)(des_ptr - (uint8*)dest);
+}
+
+//-----------------------------------------------------------------------------
+// helpers for hash_bytes
+//-----------------------------------------------------------------------------
+static const uint64 HASH_PRIME_1 = 11400714785074694791ULL;
+static const uint64 HASH_PRIME_2 = 14029467366897019727ULL;
+static const uint64 HASH_PRIME_3 =  1609587929392839161ULL;
+static const uint64 HASH_PRIME_4 =  9650029242287828579ULL;
+static const uint64 HASH_PRIME_5 =  2870177450012600261ULL;
+
+//-----------------------------------------------------------------------------
+static inline uint64
+hash_rotl(uint64 val, int bits)
+{
+    return (val << bits) | (val >> (64 - bits));
+}
+
+//-----------------------------------------------------------------------------
+static inline uint64
+hash_read64(const uint8 *ptr)
+{
+    // little endian read, independent of the machine's endianness
+    return  (uint64)ptr[0]        | ((uint64)ptr[1] << 8)  |
+           ((uint64)ptr[2] << 16) | ((uint64)ptr[3] << 24) |
+           ((uint64)ptr[4] << 32) | ((uint64)ptr[5] << 40) |
+           ((uint64)ptr[6] << 48) | ((uint64)ptr[7] << 56);
+}
+
+//-----------------------------------------------------------------------------
+static inline uint64
+hash_read32(const uint8 *ptr)
+{
+    return  (uint64)ptr[0]        | ((uint64)ptr[1] << 8) |
+           ((uint64)ptr[2] << 16) | ((uint64)ptr[3] << 24);
+}
+
+//-----------------------------------------------------------------------------
+static inline uint64
+hash_round(uint64 acc, uint64 val)
+{
+    acc += val * HASH_PRIME_2;
+    acc  = hash_rotl(acc,31);
+    acc *= HASH_PRIME_1;
+    return acc;
+}
+
+//-----------------------------------------------------------------------------
+static inline uint64
+hash_merge_round(uint64 acc, uint64 val)
+{
+    acc ^= hash_round(0,val);
+    acc  = acc * HASH_PRIME_1 + HASH_PRIME_4;
+    return acc;
+}
+
+//-----------------------------------------------------------------------------
+// hashes the 32 byte stripes at ptr, returns the end of the last full stripe
+static inline const uint8 *
+hash_stripes(uint64 *lanes, const uint8 *ptr, const uint8 *end)
+{
+    while(ptr + 32 <= end)
+    {
+        lanes[0] = hash_round(lanes[0],hash_read64(ptr));
+        lanes[1] = hash_round(lanes[1],hash_read64(ptr + 8));
+        lanes[2] = hash_round(lanes[2],hash_read64(ptr + 16));
+        lanes[3] = hash_round(lanes[3],hash_read64(ptr + 24));
+        ptr += 32;
+    }
+    return ptr;
+}
+
+//-----------------------------------------------------------------------------
+// combines the lanes (or the seed for short inputs) with the remaining
+// (less than 32) bytes
+static uint64
+hash_finish(const uint64 *lanes,
+            uint64 seed,
+            index_t nbytes,
+            const uint8 *ptr,
+            const uint8 *end)
+{
+    uint64 res = 0;
+
+    if(nbytes >= 32)
+    {
+        res = hash_rotl(lanes[0],1)  + hash_rotl(lanes[1],7) +
+              hash_rotl(lanes[2],12) + hash_rotl(lanes[3],18);
+        res = hash_merge_round(res,lanes[0]);
+        res = hash_merge_round(res,lanes[1]);
+        res = hash_merge_round(res,lanes[2]);
+        res = hash_merge_round(res,lanes[3]);
+    }
+    else
+    {
+        res = seed + HASH_PRIME_5;
+    }
+
+    res += (uint64)nbytes;
+
+    // remaining bytes
+    while(ptr + 8 <= end)
+    {
+        res ^= hash_round(0,hash_read64(ptr));
+        res  = hash_rotl(res,27) * HASH_PRIME_1 + HASH_PRIME_4;
+        ptr += 8;
+    }
+
+    if(ptr + 4 <= end)
+    {
+        res ^= hash_read32(ptr) * HASH_PRIME_1;
+        res  = hash_rotl(res,23) * HASH_PRIME_2 + HASH_PRIME_3;
+        ptr += 4;
+    }
+
+    while(ptr < end)
+    {
+        res ^= (uint64)(*ptr) * HASH_PRIME_5;
+        res  = hash_rotl(res,11) * HASH_PRIME_1;
+        ptr++;
+    }
+
+    // final mix
+    res ^= res >> 33;
+    res *= HASH_PRIME_2;
+    res ^= res >> 29;
+    res *= HASH_PRIME_3;
+    res ^= res >> 32;
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+static inline void
+hash_init_lanes(uint64 *lanes, uint64 seed)
+{
+    // four independent lanes over 32 byte stripes
+    lanes[0] = seed + HASH_PRIME_1 + HASH_PRIME_2;
+    lanes[1] = seed + HASH_PRIME_2;
+    lanes[2] = seed;
+    lanes[3] = seed - HASH_PRIME_1;
+}
+
+//-----------------------------------------------------------------------------
+uint64
+hash_bytes(const void *data,
+           index_t nbytes,
+           uint64 seed)
+{
+    const uint8 *ptr = (const uint8*)data;
+    const uint8 *end = ptr + nbytes;
+
+    uint64 lanes[4];
+    hash_init_lanes(lanes,seed);
+    ptr = hash_stripes(lanes,ptr,end);
+
+    return hash_finish(lanes,seed,nbytes,ptr,end);
+}
+
+//-----------------------------------------------------------------------------
+Hasher::Hasher(uint64 seed)
+: m_seed(seed),
+  m_stripe_bytes(0),
+  m_total_bytes(0)
+{
+    hash_init_lanes(m_lanes,seed);
+}
+
+//-----------------------------------------------------------------------------
+void
+Hasher::update(const void *data, index_t nbytes)
+{
+    const uint8 *ptr = (const uint8*)data;
+    const uint8 *end = ptr + nbytes;
+    m_total_bytes += nbytes;
+
+    // finish a partial stripe first
+    if(m_stripe_bytes > 0)
+    {
+        index_t num_copy = 32 - m_stripe_bytes;
+        if(num_copy > nbytes)
+        {
+            num_copy = nbytes;
+        }
+        memcpy(m_stripe + m_stripe_bytes,ptr,(size_t)num_copy);
+        m_stripe_bytes += num_copy;
+        ptr += num_copy;
+
+        if(m_stripe_bytes < 32)
+        {
+            return;
+        }
+
+        hash_stripes(m_lanes,m_stripe,m_stripe + 32);
+        m_stripe_bytes = 0;
+    }
+
+    ptr = hash_stripes(m_lanes,ptr,end);
+
+    m_stripe_bytes = (index_t)(end - ptr);
+    if(m_stripe_bytes > 0)
+    {
+        memcpy(m_stripe,ptr,(size_t)m_stripe_bytes);
+    }
+}
+
+//-----------------------------------------------------------------------------
+uint64
+Hasher::digest() const
+{
+    return hash_finish(m_lanes,
+                       m_seed,
+                       m_total_bytes,
+                       m_stripe,
+                       m_stripe + m_stripe_bytes);
+}
+
+//-----------------------------------------------------------------------------
+// helper for strided_copy, the fixed size memcpy compiles to plain 
+// loads and stores
+template <size_t NBYTES>
+static void
+strided_copy_fixed(uint8 *dest,
+                   index_t dest_stride,
+                   const uint8 *src,
+                   index_t src_stride,
+                   index_t num_ele)
+{
+    for(index_t i=0; i < num_ele; i++)
+    {
+        memcpy(dest,src,NBYTES);
+        dest += dest_stride;
+        src  += src_stride;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+strided_copy(void *dest,
+             index_t dest_stride,
+             const void *src,
+             index_t src_stride,
+             index_t ele_bytes,
+             index_t num_ele)
+{
+    if(num_ele <= 0 || ele_bytes <= 0 || 
+       (dest == src && dest_stride == src_stride))
+    {
+        return;
+    }
+
+    // dense on both sides: one bulk copy
+    if(dest_stride == ele_bytes && src_stride == ele_bytes)
+    {
+        memcpy(dest,src,(size_t)(ele_bytes * num_ele));
+        return;
+    }
+
+    uint8 *dest_ptr = (uint8*)dest;
+    const uint8 *src_ptr = (const uint8*)src;
+
+    switch(ele_bytes)
+    {
+        case 1:
+            strided_copy_fixed<1>(dest_ptr,dest_stride,
+                                  src_ptr,src_stride,
+                                  num_ele);
+            break;
+        case 2:
+            strided_copy_fixed<2>(dest_ptr,dest_stride,
+                                  src_ptr,src_stride,
+                                  num_ele);
+            break;
+        case 4:
+            strided_copy_fixed<4>(dest_ptr,dest_stride,
+                                  src_ptr,src_stride,
+                                  num_ele);
+            break;
+        case 8:
+            strided_copy_fixed<8>(dest_ptr,dest_stride,
+                                  src_ptr,src_stride,
+                                  num_ele);
+            break;
+        default:
+            for(index_t i=0; i < num_ele; i++)
+            {
+                memcpy(dest_ptr,src_ptr,(size_t)ele_bytes);
+                dest_ptr += dest_stride;
+                src_ptr  += src_stride;
+            }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// number formatting helpers, each writes at most 32 chars into buf and 
+// returns a pointer past the last char written.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static char *
+non_finite_to_chars(bool is_nan,
+                    bool is_neg,
+                    char *buf)
+{
+    if(is_nan)
+    {
+        memcpy(buf,"nan",3);
+        return buf + 3;
+    }
+
+    if(is_neg)
+    {
+        *buf++ = '-';
+    }
+    memcpy(buf,"inf",3);
+    return buf + 3;
+}
+
+//-----------------------------------------------------------------------------
+// Formats the digits in buf[0,length) (value = digits * 10^k) in place.
+// Uses the same layout choices as printf's "%.15g" (scientific notation 
+// when the decimal exponent is < -4 or >= 15) and adds ".0" to integral
+// values written in fixed notation.
+//-----------------------------------------------------------------------------
+static char *
+format_float_digits(char *buf,
+                    int length,
+                    int k)
+{
+    // decimal exponent of the first digit
+    int exp10 = length + k - 1;
+
+    if(exp10 < -4 || exp10 >= 15)
+    {
+        // 1234e30 -> 1.234e+33
+        char *ptr = buf + 1;
+        if(length > 1)
+        {
+            memmove(buf + 2, buf + 1, (size_t)(length - 1));
+            buf[1] = '.';
+            ptr = buf + length + 1;
+        }
+        *ptr++ = 'e';
+        if(exp10 < 0)
+        {
+            *ptr++ = '-';
+            exp10 = -exp10;
+        }
+        else
+        {
+            *ptr++ = '+';
+        }
+        if(exp10 >= 100)
+        {
+            *ptr++ = (char)('0' + exp10 / 100);
+            exp10 %= 100;
+        }
+        *ptr++ = (char)('0' + exp10 / 10);
+        *ptr++ = (char)('0' + exp10 % 10);
+        return ptr;
+    }
+    else if(k >= 0)
+    {
+        // 1234e2 -> 123400.0
+        for(int i = 0; i < k; i++)
+        {
+            buf[length + i] = '0';
+        }
+        buf[length + k]     = '.';
+        buf[length + k + 1] = '0';
+        return buf + length + k + 2;
+    }
+    else if(exp10 >= 0)
+    {
+        // 1234e-2 -> 12.34
+        memmove(buf + exp10 + 2, buf + exp10 + 1, (size_t)(-k));
+        buf[exp10 + 1] = '.';
+        return buf + length + 1;
+    }
+    else
+    {
+        // 1234e-6 -> 0.001234
+        int offset = 1 - exp10;
+        memmove(buf + offset, buf, (size_t)length);
+        buf[0] = '0';
+        buf[1] = '.';
+        for(int i = 2; i < offset; i++)
+        {
+            buf[i] = '0';
+        }
+        return buf + length + offset;
+    }
+}
+
+//-----------------------------------------------------------------------------
+static char *
+float64_to_chars(float64 value,
+                 char *buf)
+{
+    rapidjson::internal::Double d(value);
+    if(d.IsNan() || d.IsInf())
+    {
+        return non_finite_to_chars(d.IsNan(),d.Sign(),buf);
+    }
+    if(d.Sign())
+    {
+        *buf++ = '-';
+        value = -value;
+    }
+
+    if(d.IsZero())
+    {
+        memcpy(buf,"0.0",3);
+        return buf + 3;
+    }
+
+    // grisu2 shortest round trip digits
+    int length = 0;
+    int K = 0;
+    rapidjson::internal::Grisu2(value,buf,&length,&K);
+    return format_float_digits(buf,length,K);
+}
+
+//-----------------------------------------------------------------------------
+// Grisu2 using float32 boundaries, so we get the shortest digits that
+// round trip to the same float32 value (not the float64 value the float32
+// converts to).
+//-----------------------------------------------------------------------------
+static char *
+float32_to_chars(float32 value,
+                 char *buf)
+{
+    using rapidjson::internal::DiyFp;
+
+    uint32 bits;
+    memcpy(&bits,&value,4);
+
+    bool   neg      = (bits & 0x80000000u) != 0;
+    uint32 biased_e = (bits >> 23) & 0xFF;
+    uint64 f        = bits & 0x7FFFFF;
+
+    if(biased_e == 0xFF)
+    {
+        return non_finite_to_chars(f != 0,neg,buf);
+    }
+
+    if(neg)
+    {
+        *buf++ = '-';
+    }
+
+    if(biased_e == 0 && f == 0)
+    {
+        memcpy(buf,"0.0",3);
+        return buf + 3;
+    }
+
+    int e = 0;
+    if(biased_e != 0)
+    {
+        f |= 0x800000;
+        e  = (int)biased_e - 150;
+    }
+    else // denormal
+    {
+        e = 1 - 150;
+    }
+
+    // boundaries of the interval that rounds to this value
+    DiyFp w_p = DiyFp((f << 1) + 1, e - 1).Normalize();
+    DiyFp w_m = (f == 0x800000 && biased_e > 1) ?
+                    DiyFp((f << 2) - 1, e - 2) :
+                    DiyFp((f << 1) - 1, e - 1);
+    w_m.f <<= w_m.e - w_p.e;
+    w_m.e   = w_p.e;
+
+    int K = 0;
+    int length = 0;
+    const DiyFp c_mk = rapidjson::internal::GetCachedPower(w_p.e, &K);
+    const DiyFp W    = DiyFp(f,e).Normalize() * c_mk;
+    DiyFp Wp = w_p * c_mk;
+    DiyFp Wm = w_m * c_mk;
+    Wm.f++;
+    Wp.f--;
+    rapidjson::internal::DigitGen(W, Wp, Wp.f - Wm.f, buf, &length, &K);
+    return format_float_digits(buf, length, K);
 }
 
 //-----------------------------------------------------------------------------
@@ -780,17 +1448,249 @@ std::string
 float64_to_string(float64 value)
 {
     char buffer[64];
-    snprintf(buffer,64,"%.15g",value);
+    char *end = float64_to_chars(value,buffer);
+    return std::string(buffer,end);
+}
 
-    std::string res(buffer);
+//-----------------------------------------------------------------------------
+JSONWriter::JSONWriter(std::ostream &os)
+: m_os(os),
+  m_buffer(new char[BUFFER_SIZE]),
+  m_size(0),
+  m_b64_carry_size(0)
+{}
 
-    if(res.find('.') == std::string::npos &&
-       res.find('e') == std::string::npos )
+//-----------------------------------------------------------------------------
+JSONWriter::~JSONWriter()
+{
+    // destructors can't throw, so if the stream complains at this 
+    // point there is nothing we can do about it
+    try
     {
-        res += ".0";
+        flush();
     }
+    catch(...)
+    {}
+    delete [] m_buffer;
+}
 
-    return res;
+//-----------------------------------------------------------------------------
+void
+JSONWriter::flush()
+{
+    if(m_size > 0)
+    {
+        m_os.write(m_buffer,(std::streamsize)m_size);
+        m_size = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::write(const char *str,
+                  size_t len)
+{
+    if(m_size + len > BUFFER_SIZE)
+    {
+        flush();
+        // large chunks go straight to the stream
+        if(len > BUFFER_SIZE)
+        {
+            m_os.write(str,(std::streamsize)len);
+            return;
+        }
+    }
+    memcpy(m_buffer + m_size,str,len);
+    m_size += len;
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::write(const char *str)
+{
+    write(str,strlen(str));
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::write(const std::string &str)
+{
+    write(str.c_str(),str.size());
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::write_string(const std::string &str)
+{
+    write_string(str.c_str(),str.size());
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::write_string(const char *str,
+                         size_t len)
+{
+    write('"');
+    // copy runs of chars that don't need escaping in one go
+    size_t run_start = 0;
+    for(size_t i = 0; i < len; i++)
+    {
+        const char *esc = NULL;
+        switch(str[i])
+        {
+            case '\"': esc = "\\\""; break;
+            case '\\': esc = "\\\\"; break;
+            case '\n': esc = "\\n"; break;
+            case '\t': esc = "\\t"; break;
+            case '\b': esc = "\\b"; break;
+            case '\f': esc = "\\f"; break;
+            case '\r': esc = "\\r"; break;
+            default: break;
+        }
+
+        if(esc != NULL)
+        {
+            write(str + run_start, i - run_start);
+            write(esc,2);
+            run_start = i + 1;
+        }
+    }
+    write(str + run_start, len - run_start);
+    write('"');
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::write_base64(const void *data,
+                         index_t nbytes)
+{
+    begin_base64();
+    write_base64_bytes(data,nbytes);
+    end_base64();
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::begin_base64()
+{
+    write('"');
+    m_b64_carry_size = 0;
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::write_base64_bytes(const void *data,
+                               index_t nbytes)
+{
+    const uint8 *src_ptr = (const uint8*)data;
+
+    // complete a group started by a previous call
+    if(m_b64_carry_size > 0)
+    {
+        while(m_b64_carry_size < 3 && nbytes > 0)
+        {
+            m_b64_carry[m_b64_carry_size++] = *src_ptr++;
+            nbytes--;
+        }
+
+        if(m_b64_carry_size < 3)
+            return;
+
+        if(BUFFER_SIZE - m_size < 4)
+            flush();
+        m_size += (size_t)base64_encode_chars(m_b64_carry,
+                                              3,
+                                              m_buffer + m_size);
+        m_b64_carry_size = 0;
+    }
+
+    // encode full groups straight into the buffer
+    index_t full_nbytes = (nbytes / 3) * 3;
+    while(full_nbytes > 0)
+    {
+        if(BUFFER_SIZE - m_size < 4)
+            flush();
+
+        index_t chunk_nbytes = (index_t)((BUFFER_SIZE - m_size) / 4) * 3;
+        if(chunk_nbytes > full_nbytes)
+            chunk_nbytes = full_nbytes;
+
+        m_size += (size_t)base64_encode_chars(src_ptr,
+                                              chunk_nbytes,
+                                              m_buffer + m_size);
+        src_ptr     += chunk_nbytes;
+        full_nbytes -= chunk_nbytes;
+    }
+
+    // keep the rest for the next call
+    index_t rem = nbytes % 3;
+    for(index_t i=0; i < rem; i++)
+    {
+        m_b64_carry[m_b64_carry_size++] = src_ptr[i];
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::end_base64()
+{
+    if(m_b64_carry_size > 0)
+    {
+        if(BUFFER_SIZE - m_size < 4)
+            flush();
+        m_size += (size_t)base64_encode_chars(m_b64_carry,
+                                              m_b64_carry_size,
+                                              m_buffer + m_size);
+        m_b64_carry_size = 0;
+    }
+    write('"');
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::write_int64(int64 value)
+{
+    char *start = reserve_number();
+    m_size += rapidjson::internal::i64toa(value,start) - start;
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::write_uint64(uint64 value)
+{
+    char *start = reserve_number();
+    m_size += rapidjson::internal::u64toa(value,start) - start;
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::write_float32(float32 value)
+{
+    char *start = reserve_number();
+    m_size += float32_to_chars(value,start) - start;
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::write_float64(float64 value)
+{
+    char *start = reserve_number();
+    m_size += float64_to_chars(value,start) - start;
+}
+
+//-----------------------------------------------------------------------------
+void
+JSONWriter::indent(index_t indent,
+                   index_t depth,
+                   const std::string &pad)
+{
+    for(index_t i=0;i<depth;i++)
+    {
+        for(index_t j=0;j<indent;j++)
+        {
+            write(pad);
+        }
+    }
 }
 
 
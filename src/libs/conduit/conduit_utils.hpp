@@ -366,6 +366,60 @@ namespace utils
                                    index_t src_nbytes,
                                    void *dest);
 
+    /// decodes at most dest_nbytes bytes into dest, returns the number 
+    /// of bytes decoded. Chars outside of the base64 alphabet 
+    /// (whitespace, etc) are skipped, decoding stops at padding.
+    index_t CONDUIT_API base64_decode(const void *src,
+                                      index_t src_nbytes,
+                                      void *dest,
+                                      index_t dest_nbytes);
+
+//-----------------------------------------------------------------------------
+/// Copies num_ele elements of ele_bytes each between (possibly) strided 
+/// buffers. Uses a single memcpy when both sides are dense, and a fixed
+/// size copy loop for common element sizes otherwise.
+/// The source and destination must not overlap.
+//-----------------------------------------------------------------------------
+    void CONDUIT_API strided_copy(void *dest,
+                                  index_t dest_stride,
+                                  const void *src,
+                                  index_t src_stride,
+                                  index_t ele_bytes,
+                                  index_t num_ele);
+
+//-----------------------------------------------------------------------------
+/// Fast non-cryptographic 64-bit hash of a buffer (xxHash64 style).
+/// Used for checksums, the result does not depend on the machine's
+/// endianness.
+//-----------------------------------------------------------------------------
+    uint64 CONDUIT_API hash_bytes(const void *data,
+                                  index_t nbytes,
+                                  uint64 seed = 0);
+
+//-----------------------------------------------------------------------------
+/// Incremental form of hash_bytes, for data that arrives in pieces.
+/// update() with a buffer's pieces in order gives the same digest() as 
+/// hash_bytes() over the whole buffer.
+//-----------------------------------------------------------------------------
+class CONDUIT_API Hasher
+{
+public:
+    Hasher(uint64 seed = 0);
+
+    /// hashes the next nbytes of the stream
+    void     update(const void *data, index_t nbytes);
+    /// returns the hash of everything passed to update()
+    uint64   digest() const;
+
+private:
+    uint64   m_seed;
+    uint64   m_lanes[4];
+    // bytes of a partial 32 byte stripe
+    uint8    m_stripe[32];
+    index_t  m_stripe_bytes;
+    index_t  m_total_bytes;
+};
+
 //-----------------------------------------------------------------------------
      std::string CONDUIT_API json_sanitize(const std::string &json);
      
@@ -386,6 +440,7 @@ namespace utils
 //-----------------------------------------------------------------------------
 // floating point to string helper, strikes a balance of what we want 
 // for format-wise for debug printing and json.
+// Uses the "%.15g" layout with the short digits used by JSONWriter.
 //-----------------------------------------------------------------------------
     std::string CONDUIT_API float64_to_string(float64 value);
 
@@ -398,6 +453,112 @@ namespace utils
 //-----------------------------------------------------------------------------
      void CONDUIT_API sleep(index_t milliseconds);
 
+//-----------------------------------------------------------------------------
+/// Simple wall clock timer, used for basic performance measurements.
+/// The timer starts when constructed.
+//-----------------------------------------------------------------------------
+class CONDUIT_API Timer
+{
+public:
+    Timer();
+
+    /// restarts the timer
+    void     reset();
+    /// returns the elapsed time in seconds since construction or reset()
+    float64  elapsed() const;
+
+private:
+    // returns the current wall clock time in seconds
+    static float64 now();
+
+    float64  m_start;
+};
+
+//-----------------------------------------------------------------------------
+/// Buffered json text writer used by the to_json methods.
+///
+/// Output is collected in a fixed size buffer and handed to the wrapped
+/// stream in large chunks (when the buffer fills, on flush(), and on
+/// destruction). Integers and floating point values are formatted
+/// directly into the buffer without going through iostreams.
+/// Floating point values use short (grisu2) digits that round trip to 
+/// the same value, float32 values are formatted using float32 precision.
+//-----------------------------------------------------------------------------
+class CONDUIT_API JSONWriter
+{
+public:
+    JSONWriter(std::ostream &os);
+    ~JSONWriter();
+
+    /// raw output
+    void     write(char c)
+             {
+                 if(m_size == BUFFER_SIZE)
+                     flush();
+                 m_buffer[m_size++] = c;
+             }
+    void     write(const char *str);
+    void     write(const char *str, size_t len);
+    void     write(const std::string &str);
+
+    /// writes a quoted string, escaping special chars
+    /// (see escape_special_chars)
+    void     write_string(const std::string &str);
+    void     write_string(const char *str, size_t len);
+
+    /// numeric output
+    void     write_int64(int64 value);
+    void     write_uint64(uint64 value);
+    void     write_float32(float32 value);
+    void     write_float64(float64 value);
+
+    /// same as utils::indent
+    void     indent(index_t indent,
+                    index_t depth,
+                    const std::string &pad);
+
+    /// writes a quoted string with the base64 encoding of data, 
+    /// encoding directly into the output buffer
+    void     write_base64(const void *data,
+                          index_t nbytes);
+
+    /// incremental form of write_base64, the encoded string covers
+    /// all bytes passed to write_base64_bytes between the begin and 
+    /// end calls
+    void     begin_base64();
+    void     write_base64_bytes(const void *data,
+                                index_t nbytes);
+    void     end_base64();
+
+    /// hands the buffered output to the wrapped stream
+    void     flush();
+
+private:
+    // large enough for a few thousand numbers per flush
+    static const size_t BUFFER_SIZE = 65536;
+    // max number of chars used to format a single number
+    static const size_t NUMBER_SIZE = 32;
+
+    // make sure there is room for a number
+    char    *reserve_number()
+             {
+                 if(m_size + NUMBER_SIZE > BUFFER_SIZE)
+                     flush();
+                 return m_buffer + m_size;
+             }
+
+    // not copyable
+    JSONWriter(const JSONWriter &);
+    JSONWriter &operator=(const JSONWriter &);
+
+    std::ostream &m_os;
+    char         *m_buffer;
+    size_t        m_size;
+    // bytes waiting for a full base64 group
+    uint8         m_b64_carry[3];
+    index_t       m_b64_carry_size;
+};
+
 
 
 }
@@ -208,6 +208,7 @@ struct PyConduit_NodeIterator
 {
     PyObject_HEAD
     NodeIterator itr; // NoteIterator is light weight, we can deal with copies
+    PyObject *owner;  // python Node that owns the iterated tree
 };
 
 //---------------------------------------------------------------------------//
@@ -216,6 +217,9 @@ struct PyConduit_Node
    PyObject_HEAD
    Node *node;
    int python_owns;
+   // for wrappers that don't own their node: the python Node that
+   // owns the tree, kept alive while this wrapper exists.
+   PyObject *owner;
 };
 
 //---------------------------------------------------------------------------//
@@ -232,9 +236,15 @@ static int       PyConduit_Schema_Check(PyObject* obj);
 //---------------------------------------------------------------------------//
 // static PyConduit_Node* PyConduit_Node_python_create();
 static PyObject* PyConduit_Node_python_wrap(Node *node,int python_owns);
+static PyObject* PyConduit_Node_python_wrap_child(Node *node,
+                                                  PyObject *owner);
+static PyObject* PyConduit_Node_Tree_Owner(PyConduit_Node *py_node);
 static int       PyConduit_Node_SetFromPython(Node& node, PyObject* value);
-static PyObject* PyConduit_createNumpyType(Node& node, int type);
-static PyObject* PyConduit_convertNodeToPython(Node& node);
+static PyObject* PyConduit_createNumpyType(Node& node,
+                                           int type,
+                                           PyObject *owner);
+static PyObject* PyConduit_convertNodeToPython(Node& node,
+                                               PyObject *owner);
 
 //-----------------------------------------------------------------------------
 // c api decls from conduit_python.hpp
@@ -2316,7 +2326,7 @@ static PyObject *
 PyConduit_Schema_str(PyConduit_Schema *self)
 {
    std::ostringstream oss;
-   self->schema->to_json(oss);
+   self->schema->to_json_stream(oss);
    return (Py_BuildValue("s", oss.str().c_str()));
 }
 
@@ -2687,7 +2697,12 @@ PyConduit_NodeIterator_init(PyConduit_NodeIterator* self,
     {
         if (PyConduit_Node_Check(value))
         {
-            self->itr = NodeIterator(((PyConduit_Node*)value)->node);
+            PyConduit_Node *py_node = (PyConduit_Node*)value;
+            self->itr = NodeIterator(py_node->node);
+            PyObject *owner = PyConduit_Node_Tree_Owner(py_node);
+            Py_INCREF(owner);
+            Py_XDECREF(self->owner);
+            self->owner = owner;
         }
     }
 
@@ -2698,6 +2713,7 @@ PyConduit_NodeIterator_init(PyConduit_NodeIterator* self,
 static void
 PyConduit_NodeIterator_dealloc(PyConduit_NodeIterator *self)
 {
+    Py_XDECREF(self->owner);
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
@@ -2758,7 +2774,8 @@ PyConduit_NodeIterator_index(PyConduit_NodeIterator *self)
 static PyObject *
 PyConduit_NodeIterator_node(PyConduit_NodeIterator *self)
 {
-    return PyConduit_Node_python_wrap(&(self->itr.node()),0);
+    return PyConduit_Node_python_wrap_child(&(self->itr.node()),
+                                            self->owner);
 }
 
 //---------------------------------------------------------------------------//
@@ -2790,7 +2807,7 @@ PyConduit_NodeIterator_next(PyConduit_NodeIterator *self)
     if(self->itr.has_next())
     {
         Node &n = self->itr.next();
-        return PyConduit_Node_python_wrap(&n,0);
+        return PyConduit_Node_python_wrap_child(&n,self->owner);
     }
     else
     {
@@ -2806,7 +2823,7 @@ PyConduit_NodeIterator_peek_next(PyConduit_NodeIterator *self)
     if(self->itr.has_next())
     {
         Node &n = self->itr.peek_next();
-        return PyConduit_Node_python_wrap(&n,0);
+        return PyConduit_Node_python_wrap_child(&n,self->owner);
     }
     else
     {
@@ -2836,7 +2853,7 @@ PyConduit_NodeIterator_previous(PyConduit_NodeIterator *self)
     if(self->itr.has_previous())
     {
         Node &n = self->itr.previous();
-        return PyConduit_Node_python_wrap(&n,0);
+        return PyConduit_Node_python_wrap_child(&n,self->owner);
     }
     else
     {
@@ -2852,7 +2869,7 @@ PyConduit_NodeIterator_peek_previous(PyConduit_NodeIterator *self)
     if(self->itr.has_previous())
     {
         Node &n = self->itr.peek_previous();
-        return PyConduit_Node_python_wrap(&n,0);
+        return PyConduit_Node_python_wrap_child(&n,self->owner);
     }
     else
     {
@@ -3020,20 +3037,205 @@ PyConduit_NodeIterator_python_create()
 //---------------------------------------------------------------------------//
 
 //---------------------------------------------------------------------------//
-template <class T>
-static void
-PyConduit_Fill_DataArray_From_PyArray(DataArray<T> &conduit_array,
-                                      PyArrayObject *numpy_array)
+// numpy array helpers
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// returns the conduit dtype id for the numpy array's element type, or
+// DataType::EMPTY_ID if the type isn't supported
+//---------------------------------------------------------------------------//
+static index_t
+PyConduit_Numpy_DataType_Id(PyArrayObject *py_arr)
 {
-    npy_int num_ele = conduit_array.number_of_elements();
-    
-    T *numpy_data = (T*)PyArray_BYTES(numpy_array);
-    
-    for (npy_intp i = 0; i < num_ele; i++)
+    PyArray_Descr *desc = PyArray_DESCR(py_arr);
+    // use kind + size, so platform aliases (long vs longlong, etc)
+    // map to the same conduit type
+    switch(desc->kind)
+    {
+        case 'i':
+        {
+            switch(desc->elsize)
+            {
+                case 1: return DataType::INT8_ID;
+                case 2: return DataType::INT16_ID;
+                case 4: return DataType::INT32_ID;
+                case 8: return DataType::INT64_ID;
+            }
+            break;
+        }
+        case 'u':
+        {
+            switch(desc->elsize)
+            {
+                case 1: return DataType::UINT8_ID;
+                case 2: return DataType::UINT16_ID;
+                case 4: return DataType::UINT32_ID;
+                case 8: return DataType::UINT64_ID;
+            }
+            break;
+        }
+        case 'f':
+        {
+            switch(desc->elsize)
+            {
+                case 4: return DataType::FLOAT32_ID;
+                case 8: return DataType::FLOAT64_ID;
+            }
+            break;
+        }
+    }
+    return DataType::EMPTY_ID;
+}
+
+//---------------------------------------------------------------------------//
+static index_t
+PyConduit_Numpy_Endianness_Id(PyArrayObject *py_arr)
+{
+    switch(PyArray_DESCR(py_arr)->byteorder)
     {
-        conduit_array[i] = numpy_data[i];
+        case '<': return Endianness::LITTLE_ID;
+        case '>': return Endianness::BIG_ID;
+        // native or not applicable
+        default:  return Endianness::DEFAULT_ID;
     }
-    
+}
+
+//---------------------------------------------------------------------------//
+// conduit leaves are one dimensional with a single stride. 
+// An N-D numpy array can be described this way if stepping through its
+// elements in C order always advances the address by the same amount.
+// (C-contiguous arrays, slices with a step of the last dim, etc)
+// Returns false if the array can't be described by a single stride.
+//---------------------------------------------------------------------------//
+static bool
+PyConduit_Numpy_Leaf_Stride(PyArrayObject *py_arr,
+                            index_t &stride)
+{
+    int       nd      = PyArray_NDIM(py_arr);
+    npy_intp *shape   = PyArray_DIMS(py_arr);
+    npy_intp *strides = PyArray_STRIDES(py_arr);
+
+    stride = (index_t) PyArray_ITEMSIZE(py_arr);
+
+    if(PyArray_SIZE(py_arr) == 0)
+    {
+        return true;
+    }
+
+    bool     have_stride = false;
+    npy_intp span = 0;
+    for(int i = nd - 1; i >= 0; i--)
+    {
+        // dims of length 1 don't contribute
+        if(shape[i] == 1)
+        {
+            continue;
+        }
+
+        if(!have_stride)
+        {
+            stride = (index_t) strides[i];
+            have_stride = true;
+        }
+        else if(strides[i] != span)
+        {
+            return false;
+        }
+        span = strides[i] * shape[i];
+    }
+
+    // conduit strides need to move forward through memory
+    return stride > 0;
+}
+
+//---------------------------------------------------------------------------//
+// creates the conduit dtype that describes the numpy array's data in place
+// returns false (with a python error set) if this isn't possible
+//---------------------------------------------------------------------------//
+static bool
+PyConduit_Numpy_To_DataType(PyArrayObject *py_arr,
+                            DataType &dtype)
+{
+    index_t dtype_id = PyConduit_Numpy_DataType_Id(py_arr);
+    if(dtype_id == DataType::EMPTY_ID)
+    {
+        PyErr_SetString(PyExc_TypeError, "Unsupported type");
+        return false;
+    }
+
+    index_t stride = 0;
+    if(!PyConduit_Numpy_Leaf_Stride(py_arr,stride))
+    {
+        PyErr_SetString(PyExc_TypeError,
+                        "numpy array layout can't be described with a "
+                        "single stride (use a copy of the array)");
+        return false;
+    }
+
+    dtype.set(dtype_id,
+              (index_t) PyArray_SIZE(py_arr),
+              0,
+              stride,
+              (index_t) PyArray_ITEMSIZE(py_arr),
+              PyConduit_Numpy_Endianness_Id(py_arr));
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// copies the numpy array's data into a compact conduit leaf
+// returns -1 (with a python error set) on failure
+//---------------------------------------------------------------------------//
+static int
+PyConduit_Node_Set_From_Numpy(Node &node,
+                              PyArrayObject *py_arr)
+{
+    index_t dtype_id = PyConduit_Numpy_DataType_Id(py_arr);
+    if(dtype_id == DataType::EMPTY_ID)
+    {
+        PyErr_SetString(PyExc_TypeError, "Unsupported type");
+        return (-1);
+    }
+
+    index_t num_ele   = (index_t) PyArray_SIZE(py_arr);
+    index_t ele_bytes = (index_t) PyArray_ITEMSIZE(py_arr);
+
+    node.set(DataType(dtype_id,
+                      num_ele,
+                      0,
+                      ele_bytes,
+                      ele_bytes,
+                      PyConduit_Numpy_Endianness_Id(py_arr)));
+
+    if(num_ele == 0)
+    {
+        return (0);
+    }
+
+    index_t stride = 0;
+    if(PyConduit_Numpy_Leaf_Stride(py_arr,stride))
+    {
+        utils::strided_copy(node.data_ptr(),
+                            ele_bytes,
+                            PyArray_BYTES(py_arr),
+                            stride,
+                            ele_bytes,
+                            num_ele);
+    }
+    else
+    {
+        // let numpy gather general strided layouts
+        PyArrayObject *c_arr = PyArray_GETCONTIGUOUS(py_arr);
+        if(c_arr == NULL)
+        {
+            return (-1);
+        }
+        memcpy(node.data_ptr(),
+               PyArray_BYTES(c_arr),
+               (size_t)(num_ele * ele_bytes));
+        Py_DECREF(c_arr);
+    }
+
+    return (0);
 }
 
 
@@ -3064,6 +3266,7 @@ PyConduit_Node_new(PyTypeObject* type,
     {
         self->node = 0;
         self->python_owns = 0;
+        self->owner = NULL;
     }
 
     return ((PyObject*)self);
@@ -3108,6 +3311,8 @@ PyConduit_Node_dealloc(PyConduit_Node* self)
        delete self->node;
     }
 
+    Py_XDECREF(self->owner);
+
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
@@ -3145,11 +3350,13 @@ PyConduit_Node_GetItem(PyConduit_Node* self,
     if(self->node->has_path(ckey))
     {
         Node& node = (*self->node)[ckey];
-        retval = PyConduit_convertNodeToPython(node);
+        retval = PyConduit_convertNodeToPython(node,
+                                        PyConduit_Node_Tree_Owner(self));
     }
     else
     {
-        retval = PyConduit_Node_python_wrap(&(*self->node)[ckey],0);
+        retval = PyConduit_Node_python_wrap_child(&(*self->node)[ckey],
+                                        PyConduit_Node_Tree_Owner(self));
     }
     
     PyString_AsString_Cleanup(ckey);
@@ -3199,7 +3406,8 @@ static PyObject *
 PyConduit_Node_value(PyConduit_Node* self)
 {
     PyObject* retval = NULL;
-    retval = PyConduit_convertNodeToPython(*self->node);
+    retval = PyConduit_convertNodeToPython(*self->node,
+                                           PyConduit_Node_Tree_Owner(self));
     return (retval);
 }
 
@@ -3383,7 +3591,8 @@ PyConduit_Node_fetch(PyConduit_Node* self,
          return NULL;
      }
 
-    retval = PyConduit_Node_python_wrap(&(*self->node).fetch(key),0);
+    retval = PyConduit_Node_python_wrap_child(&(*self->node).fetch(key),
+                                              PyConduit_Node_Tree_Owner(self));
     return (retval);
 }
 
@@ -3400,7 +3609,8 @@ PyConduit_Node_child(PyConduit_Node* self,
          return NULL;
      }
 
-    retval = PyConduit_Node_python_wrap(&(*self->node).child(idx),0);
+    retval = PyConduit_Node_python_wrap_child(&(*self->node).child(idx),
+                                              PyConduit_Node_Tree_Owner(self));
     return (retval);
 }
 
@@ -3460,7 +3670,8 @@ PyConduit_Node_child_names(PyConduit_Node *self)
 static PyObject *
 PyConduit_Node_append(PyConduit_Node* self)
 {
-    return  PyConduit_Node_python_wrap(&(self->node->append()),0);
+    return  PyConduit_Node_python_wrap_child(&(self->node->append()),
+                                             PyConduit_Node_Tree_Owner(self));
 }
 
 
@@ -3549,7 +3760,8 @@ PyConduit_Node_parent(PyConduit_Node* self)
     }
     else
     {
-        return PyConduit_Node_python_wrap(self->node->parent(),0);
+        return PyConduit_Node_python_wrap_child(self->node->parent(),
+                                            PyConduit_Node_Tree_Owner(self));
     }
 }
 
@@ -3621,6 +3833,8 @@ PyConduit_Node_iter(PyObject *self)
     PyConduit_NodeIterator *retval = NULL;
     retval = PyConduit_NodeIterator_python_create();
     retval->itr =  py_n->node->children();
+    retval->owner = PyConduit_Node_Tree_Owner(py_n);
+    Py_INCREF(retval->owner);
 
     return ((PyObject *)retval);
 }
@@ -3664,88 +3878,16 @@ PyConduit_Node_set_external(PyConduit_Node* self,
         return (NULL);
     }
 
-    PyArray_Descr *desc = PyArray_DESCR((PyArrayObject*)value);
+    // describe the numpy array's memory (N-D arrays are flattened in 
+    // C order), the node points to it directly
     PyArrayObject *py_arr = (PyArrayObject*)value;
-    npy_intp num_ele = PyArray_SIZE(py_arr);
-    int offset = 0;
-    int stride = PyArray_STRIDE(py_arr, 0);
-    int nd = PyArray_NDIM(py_arr);
-
-    if (nd > 1) {
-        PyErr_SetString(PyExc_TypeError, "set_external does not handle multidimensional numpy arrays");
+    DataType dtype;
+    if(!PyConduit_Numpy_To_DataType(py_arr,dtype))
+    {
         return (NULL);
     }
 
-    Node& node = *self->node;
-
-    switch (desc->type_num) 
-    {
-        case NPY_UINT8 :
-        {
-            uint8 *numpy_data = (uint8*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_UINT16 :
-        {
-            uint16 *numpy_data = (uint16*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_UINT32 :
-        {
-            uint32 *numpy_data = (uint32*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_UINT64 :
-        {
-            uint64 *numpy_data = (uint64*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_INT8 :
-        {
-            int8 *numpy_data = (int8*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_INT16 :
-        {
-            int16 *numpy_data = (int16*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_INT32 :
-        {
-            int32 *numpy_data = (int32*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_INT64 :
-        {
-            int64 *numpy_data = (int64*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_FLOAT32 :
-        {
-            float32 *numpy_data = (float32*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        case NPY_FLOAT64 :
-        {
-            float64 *numpy_data = (float64*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
-        }
-        default :
-        {
-            PyErr_SetString(PyExc_TypeError, "Unsupported type");
-            return (NULL);
-        }
-    }
+    self->node->set_external(dtype,PyArray_BYTES(py_arr));
 
     Py_RETURN_NONE;
 
@@ -3836,6 +3978,149 @@ PyConduit_Node_to_json(PyConduit_Node* self,
     return (Py_BuildValue("s", output.c_str()));
 }
 
+//---------------------------------------------------------------------------//
+// Buffer protocol support for numeric leaves.
+//
+// The exported view points directly at the node's data, so consumers
+// like numpy.asarray and memoryview see (and can modify) the same memory.
+// The view keeps a reference to the python Node that owns the tree.
+//---------------------------------------------------------------------------//
+static const char *
+PyConduit_Node_Buffer_Format(const DataType &dtype)
+{
+    // native layout uses plain struct codes, non-native uses explicit
+    // byte order prefixes
+    static const char *native_fmts[] = {"b","h","i","q",
+                                        "B","H","I","Q",
+                                        "f","d"};
+    static const char *little_fmts[] = {"<b","<h","<i","<q",
+                                        "<B","<H","<I","<Q",
+                                        "<f","<d"};
+    static const char *big_fmts[]    = {">b",">h",">i",">q",
+                                        ">B",">H",">I",">Q",
+                                        ">f",">d"};
+    int idx = -1;
+    switch(dtype.id())
+    {
+        case DataType::INT8_ID:    idx = 0; break;
+        case DataType::INT16_ID:   idx = 1; break;
+        case DataType::INT32_ID:   idx = 2; break;
+        case DataType::INT64_ID:   idx = 3; break;
+        case DataType::UINT8_ID:   idx = 4; break;
+        case DataType::UINT16_ID:  idx = 5; break;
+        case DataType::UINT32_ID:  idx = 6; break;
+        case DataType::UINT64_ID:  idx = 7; break;
+        case DataType::FLOAT32_ID: idx = 8; break;
+        case DataType::FLOAT64_ID: idx = 9; break;
+        default: return NULL;
+    }
+
+    if(dtype.endianness_matches_machine())
+    {
+        return native_fmts[idx];
+    }
+    else if(dtype.is_little_endian())
+    {
+        return little_fmts[idx];
+    }
+
+    return big_fmts[idx];
+}
+
+//---------------------------------------------------------------------------//
+static int
+PyConduit_Node_getbuffer(PyConduit_Node *self,
+                         Py_buffer *view,
+                         int flags)
+{
+    if(view == NULL)
+    {
+        PyErr_SetString(PyExc_BufferError,
+                        "Node buffer export requires a valid view");
+        return -1;
+    }
+
+    const DataType &dtype = self->node->dtype();
+    const char *fmt = PyConduit_Node_Buffer_Format(dtype);
+
+    if(fmt == NULL || self->node->data_ptr() == NULL)
+    {
+        view->obj = NULL;
+        PyErr_SetString(PyExc_BufferError,
+                        "Node buffer export is only supported for "
+                        "numeric leaves");
+        return -1;
+    }
+
+    index_t ele_bytes = dtype.element_bytes();
+    index_t num_ele   = dtype.number_of_elements();
+    index_t stride    = dtype.stride();
+
+    if( stride != ele_bytes && (flags & PyBUF_STRIDES) != PyBUF_STRIDES )
+    {
+        view->obj = NULL;
+        PyErr_SetString(PyExc_BufferError,
+                        "Node data is strided, consumer must "
+                        "request PyBUF_STRIDES");
+        return -1;
+    }
+
+    // shape and strides share one allocation, released in releasebuffer
+    Py_ssize_t *shape_and_strides = (Py_ssize_t*)PyMem_Malloc(
+                                                    2 * sizeof(Py_ssize_t));
+    if(shape_and_strides == NULL)
+    {
+        view->obj = NULL;
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    shape_and_strides[0] = (Py_ssize_t) num_ele;
+    shape_and_strides[1] = (Py_ssize_t) stride;
+
+    view->buf        = self->node->element_ptr(0);
+    view->obj        = PyConduit_Node_Tree_Owner(self);
+    view->len        = (Py_ssize_t)(num_ele * ele_bytes);
+    view->readonly   = 0;
+    view->itemsize   = (Py_ssize_t) ele_bytes;
+    view->format     = NULL;
+    view->ndim       = 1;
+    view->shape      = NULL;
+    view->strides    = NULL;
+    view->suboffsets = NULL;
+    view->internal   = shape_and_strides;
+
+    if( (flags & PyBUF_FORMAT) == PyBUF_FORMAT )
+    {
+        view->format = const_cast<char*>(fmt);
+    }
+
+    if( (flags & PyBUF_ND) == PyBUF_ND )
+    {
+        view->shape = &shape_and_strides[0];
+    }
+
+    if( (flags & PyBUF_STRIDES) == PyBUF_STRIDES )
+    {
+        view->strides = &shape_and_strides[1];
+    }
+
+    Py_INCREF(view->obj);
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+static void
+PyConduit_Node_releasebuffer(PyConduit_Node *, // self
+                             Py_buffer *view)
+{
+    if(view->internal != NULL)
+    {
+        PyMem_Free(view->internal);
+        view->internal = NULL;
+    }
+}
+
 
 //----------------------------------------------------------------------------//
 // Node methods table
@@ -3993,6 +4278,18 @@ static PyMappingMethods node_as_mapping = {
    (objobjargproc)PyConduit_Node_SetItem,
 };
 
+//---------------------------------------------------------------------------//
+static PyBufferProcs node_as_buffer = {
+#if !defined(IS_PY3K)
+   0, /* bf_getreadbuffer */
+   0, /* bf_getwritebuffer */
+   0, /* bf_getsegcount */
+   0, /* bf_getcharbuffer */
+#endif
+   (getbufferproc)PyConduit_Node_getbuffer,
+   (releasebufferproc)PyConduit_Node_releasebuffer,
+};
+
 //---------------------------------------------------------------------------//
 static PyTypeObject PyConduit_Node_TYPE = {
    PyVarObject_HEAD_INIT(NULL, 0)
@@ -4013,8 +4310,13 @@ static PyTypeObject PyConduit_Node_TYPE = {
    (reprfunc)PyConduit_Node_str,                         /* str */
    0, /* getattro */
    0, /* setattro */
-   0, /* asbuffer */
+   &node_as_buffer, /* asbuffer */
+#if defined(IS_PY3K)
    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,     /* flags */
+#else
+   Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE |
+   Py_TPFLAGS_HAVE_NEWBUFFER,                    /* flags */
+#endif
    "Conduit node objects",
    0, /* traverse */
    0, /* clear */
@@ -4120,9 +4422,40 @@ PyConduit_Node_python_wrap(Node *node, int python_owns)
     PyConduit_Node* retval = (PyConduit_Node*)type->tp_alloc(type, 0);
     retval->node = node;
     retval->python_owns = python_owns;
+    retval->owner = NULL;
+    return ((PyObject*)retval);
+}
+
+//---------------------------------------------------------------------------//
+// Wraps a node that lives in a tree owned by another python Node.
+// The wrapper holds a reference to the owner, so views of the node's
+// data can't outlive the tree.
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_python_wrap_child(Node *node, PyObject *owner)
+{
+    PyConduit_Node *retval = (PyConduit_Node*)PyConduit_Node_python_wrap(node,
+                                                                         0);
+    Py_XINCREF(owner);
+    retval->owner = owner;
     return ((PyObject*)retval);
 }
 
+//---------------------------------------------------------------------------//
+// Returns (borrowed) the python Node that owns py_node's tree. This is
+// used as the base object for numpy views and buffer exports.
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_Tree_Owner(PyConduit_Node *py_node)
+{
+    if(py_node->python_owns || py_node->owner == NULL)
+    {
+        return (PyObject*)py_node;
+    }
+
+    return py_node->owner;
+}
+
 //---------------------------------------------------------------------------//
 static PyObject*
 PyConduit_Node_python_create()
@@ -4166,81 +4499,9 @@ PyConduit_Node_SetFromPython(Node &node,
     }
     else if (PyArray_Check(value))
     {
-        PyArray_Descr *desc = PyArray_DESCR((PyArrayObject*)value);
-        PyArrayObject *py_arr = (PyArrayObject*)value;
-        npy_intp num_ele = PyArray_SIZE(py_arr);
-        switch (desc->type_num) 
+        if(PyConduit_Node_Set_From_Numpy(node,(PyArrayObject*)value))
         {
-            case NPY_UINT8 :
-            {
-                node.set(DataType::uint8(num_ele));
-                uint8_array c_arr = node.value();
-                PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
-                break;
-            }
-            case NPY_UINT16 :
-            {
-                node.set(DataType::uint16(num_ele));
-                uint16_array c_arr = node.value();
-                PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
-                break;
-            }
-            case NPY_UINT32 :
-            {
-                node.set(DataType::uint32(num_ele));
-                uint32_array c_arr = node.value();
-                PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
-                break;
-            }
-            case NPY_UINT64 :
-            {
-                node.set(DataType::uint64(num_ele));
-                uint64_array c_arr = node.value();
-                PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
-                break;
-            }
-            case NPY_INT8 :
-            {
-                node.set(DataType::int8(num_ele));
-                uint8_array c_arr = node.value();
-                PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
-                break;
-            }
-            case NPY_INT16 :
-            {
-                node.set(DataType::int16(num_ele));
-                uint16_array c_arr = node.value();
-                PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
-                break;
-            }
-            case NPY_INT32 :
-            {
-                node.set(DataType::int32(num_ele));
-                uint32_array c_arr = node.value();
-                PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
-                break;
-            }
-            case NPY_INT64 :
-            {
-                node.set(DataType::int64(num_ele));
-                uint64_array c_arr = node.value();
-                PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
-                break;
-            }
-            case NPY_FLOAT32 :
-            {
-                node.set(DataType::float32(num_ele));
-                float32_array c_arr = node.value();
-                PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
-                break;
-            }
-            case NPY_FLOAT64 :
-            {
-                node.set(DataType::float64(num_ele));
-                float64_array c_arr = node.value();
-                PyConduit_Fill_DataArray_From_PyArray(c_arr, py_arr);
-                break;
-            }
+            return (-1);
         }
     } else if (PyArray_CheckScalar(value)) {
         PyArray_Descr* desc = PyArray_DescrFromScalar(value);
@@ -4315,37 +4576,65 @@ PyConduit_Node_SetFromPython(Node &node,
     return (0);
 }
 
+//---------------------------------------------------------------------------//
+// creates a numpy scalar (single element) or a numpy array that views 
+// the node's data in place. The array holds a reference to owner, the
+// python object that keeps the node's data alive.
 //---------------------------------------------------------------------------//
 static PyObject *
 PyConduit_createNumpyType(Node& node,
-                          int type)
+                          int type,
+                          PyObject *owner)
 {
     const DataType& dtype = node.dtype();
     PyArray_Descr* descr = PyArray_DescrFromType(type);
     PyObject* retval = NULL;
     void* data = node.element_ptr(0);
     npy_intp len = dtype.number_of_elements();
-    // TODO: This only deals with contiguous data?
+
+    if(!dtype.endianness_matches_machine())
+    {
+        PyArray_Descr *swapped = PyArray_DescrNewByteorder(descr,NPY_SWAP);
+        Py_DECREF(descr);
+        descr = swapped;
+    }
+
     if (len == 1) 
     {
         retval = PyArray_Scalar(data, descr, NULL);
+        Py_DECREF(descr);
     }
     else 
     {
-        retval = PyArray_SimpleNewFromData(1, &len, type, data);
-
-        // Since there doesn't appear to be a constructor that takes data
-        // and a descriptor, we'll just modify the strides appropriately.
-        // This should be OK since we only support 1D arrays currently.
-        npy_intp * strides = PyArray_STRIDES((PyArrayObject*)retval);
-        strides[0] = dtype.stride();
+        npy_intp stride = (npy_intp) dtype.stride();
+        // steals the descr reference
+        retval = PyArray_NewFromDescr(&PyArray_Type,
+                                      descr,
+                                      1,
+                                      &len,
+                                      &stride,
+                                      data,
+                                      NPY_ARRAY_WRITEABLE,
+                                      NULL);
+
+        if(retval != NULL && owner != NULL)
+        {
+            // steals the owner reference
+            Py_INCREF(owner);
+            if(PyArray_SetBaseObject((PyArrayObject*)retval,owner) != 0)
+            {
+                Py_DECREF(retval);
+                retval = NULL;
+            }
+        }
     }
     return (retval);
 }
 
 //---------------------------------------------------------------------------//
 static PyObject *
-PyConduit_convertNodeToPython(Node& node)
+PyConduit_convertNodeToPython(Node& node,
+                              PyObject *owner)
 {
     const DataType& type = node.dtype();
     int numpy_type = -1;
@@ -4354,7 +4643,7 @@ PyConduit_convertNodeToPython(Node& node)
     switch (type.id()) {
         case DataType::EMPTY_ID:
         case DataType::OBJECT_ID: {
-            retval = PyConduit_Node_python_wrap(&node,0);
+            retval = PyConduit_Node_python_wrap_child(&node,owner);
             break;
         }
         case DataType::CHAR8_STR_ID: {
@@ -4410,7 +4699,7 @@ PyConduit_convertNodeToPython(Node& node)
     if (type.id() != DataType::OBJECT_ID&&
         type.id() != DataType::CHAR8_STR_ID) {
 
-        retval = PyConduit_createNumpyType(node, numpy_type);
+        retval = PyConduit_createNumpyType(node, numpy_type, owner);
     }
 
     return (retval);
@@ -54,6 +54,8 @@
 // standard lib includes
 //-----------------------------------------------------------------------------
 #include <iostream>
+#include <set>
+#include <cstring>
 
 //-----------------------------------------------------------------------------
 // external lib includes
@@ -190,6 +192,177 @@ private:
     void         *herr_func_client_data; 
 };
 
+//-----------------------------------------------------------------------------
+// Private class used to hold options that control how leaves are written.
+//
+// See hdf5_set_options in conduit_relay_hdf5.hpp for the options Node
+// layout. A global instance holds the defaults, each hdf5_write call can
+// use a copy of the defaults updated with the options passed to it.
+//-----------------------------------------------------------------------------
+class HDF5Options
+{
+public:
+    HDF5Options()
+    : compression_method("deflate"),
+      compression_level(9),
+      shuffle(true),
+      chunk_threshold(0),
+      chunk_size(1024 * 1024)
+    {}
+
+    //------------------------------------------------------------------------
+    void set(const Node &opts)
+    {
+        if(opts.has_path("compression/method"))
+        {
+            std::string method = opts["compression/method"].as_string();
+            if(method != "deflate" && method != "none")
+            {
+                CONDUIT_ERROR("Unsupported HDF5 compression method: \""
+                              << method << "\""
+                              << " (expected \"deflate\" or \"none\")");
+            }
+            compression_method = method;
+        }
+
+        if(opts.has_path("compression/level"))
+        {
+            int level = (int) opts["compression/level"].to_int64();
+            if(level < 0 || level > 9)
+            {
+                CONDUIT_ERROR("Unsupported HDF5 deflate compression level: "
+                              << level << " (expected 0-9)");
+            }
+            compression_level = level;
+        }
+
+        if(opts.has_path("compression/shuffle"))
+        {
+            const Node &n_shuffle = opts["compression/shuffle"];
+            if(n_shuffle.dtype().is_number())
+            {
+                shuffle = n_shuffle.to_int() != 0;
+            }
+            else if(n_shuffle.dtype().is_string() &&
+                    (n_shuffle.as_string() == "true" ||
+                     n_shuffle.as_string() == "false"))
+            {
+                shuffle = n_shuffle.as_string() == "true";
+            }
+            else
+            {
+                CONDUIT_ERROR("Unsupported HDF5 shuffle option: "
+                              << n_shuffle.to_json()
+                              << " (expected \"true\", \"false\", 0 or 1)");
+            }
+        }
+
+        if(opts.has_path("chunking/threshold"))
+        {
+            chunk_threshold = opts["chunking/threshold"].to_index_t();
+        }
+
+        if(opts.has_path("chunking/chunk_size"))
+        {
+            chunk_size = opts["chunking/chunk_size"].to_index_t();
+        }
+    }
+
+    //------------------------------------------------------------------------
+    void about(Node &opts) const
+    {
+        opts.reset();
+        opts["compression/method"] = compression_method;
+        opts["compression/level"]  = compression_level;
+        opts["compression/shuffle"] = shuffle ? "true" : "false";
+        opts["chunking/threshold"]  = chunk_threshold;
+        opts["chunking/chunk_size"] = chunk_size;
+    }
+
+    // "deflate" or "none"
+    std::string compression_method;
+    // deflate level (0-9)
+    int         compression_level;
+    // apply the shuffle filter before compression
+    bool        shuffle;
+    // leaves with fewer bytes than this are written contiguous
+    index_t     chunk_threshold;
+    // target bytes per chunk, 0 uses one chunk for the entire leaf
+    index_t     chunk_size;
+};
+
+//-----------------------------------------------------------------------------
+static HDF5Options &
+hdf5_default_options()
+{
+    static HDF5Options opts;
+    return opts;
+}
+
+//-----------------------------------------------------------------------------
+// Private class used to hold options that control how datasets are read.
+//
+// See hdf5_read in conduit_relay_hdf5.hpp for the options Node layout.
+//-----------------------------------------------------------------------------
+class HDF5ReadOptions
+{
+public:
+    HDF5ReadOptions()
+    : schema_only(false),
+      offset(0),
+      stride(1),
+      size(-1)
+    {}
+
+    //------------------------------------------------------------------------
+    void set(const Node &opts)
+    {
+        if(opts.has_child("offset"))
+        {
+            offset = opts["offset"].to_index_t();
+            if(offset < 0)
+            {
+                CONDUIT_ERROR("HDF5 read offset must be >= 0"
+                              " (given: " << offset << ")");
+            }
+        }
+
+        if(opts.has_child("stride"))
+        {
+            stride = opts["stride"].to_index_t();
+            if(stride < 1)
+            {
+                CONDUIT_ERROR("HDF5 read stride must be >= 1"
+                              " (given: " << stride << ")");
+            }
+        }
+
+        if(opts.has_child("size"))
+        {
+            size = opts["size"].to_index_t();
+            if(size < 0)
+            {
+                CONDUIT_ERROR("HDF5 read size must be >= 0"
+                              " (given: " << size << ")");
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------
+    bool has_selection() const
+    {
+        return offset != 0 || stride != 1 || size != -1;
+    }
+
+    // only construct the tree and leaf dtypes, don't read data
+    bool    schema_only;
+    // element selection applied to each dataset
+    index_t offset;
+    index_t stride;
+    // number of elements, -1 selects all from offset to the end
+    index_t size;
+};
+
 //-----------------------------------------------------------------------------
 // helper method decls
 //-----------------------------------------------------------------------------
@@ -226,7 +399,8 @@ bool  check_if_conduit_node_is_compatible_with_hdf5_tree(const Node &node,
 hid_t create_hdf5_dataset_for_conduit_leaf(const DataType &dt,
                                            const std::string &ref_path,
                                            hid_t hdf5_group_id,
-                                           const std::string &hdf5_dset_name);
+                                           const std::string &hdf5_dset_name,
+                                           const HDF5Options &opts);
 
 //-----------------------------------------------------------------------------
 void  write_conduit_leaf_to_hdf5_dataset(const Node &node,
@@ -237,12 +411,14 @@ void  write_conduit_leaf_to_hdf5_dataset(const Node &node,
 void  write_conduit_leaf_to_hdf5_group(const Node &node,
                                        const std::string &ref_path,
                                        hid_t hdf5_group_id,
-                                       const std::string &hdf5_dset_name);
+                                       const std::string &hdf5_dset_name,
+                                       const HDF5Options &opts);
 
 //-----------------------------------------------------------------------------
 void  write_conduit_object_to_hdf5_group(const Node &node,
                                          const std::string &ref_path,
-                                         hid_t hdf5_group_id);
+                                         hid_t hdf5_group_id,
+                                         const HDF5Options &opts);
 
 
 //-----------------------------------------------------------------------------
@@ -252,16 +428,19 @@ void  write_conduit_object_to_hdf5_group(const Node &node,
 //-----------------------------------------------------------------------------
 void read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
                                          const std::string &ref_path,
+                                         const HDF5ReadOptions &opts,
                                          Node &dest);
 
 //-----------------------------------------------------------------------------
 void read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
                                        const std::string &ref_path,
+                                       const HDF5ReadOptions &opts,
                                        Node &dest);
 
 //-----------------------------------------------------------------------------
 void read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
                                       const std::string &ref_path,
+                                      const HDF5ReadOptions &opts,
                                       Node &dest);
 
 
@@ -670,26 +849,47 @@ check_if_conduit_node_is_compatible_with_hdf5_tree(const Node &node,
 
 //---------------------------------------------------------------------------//
 hid_t
-create_hdf5_compression_plist_for_conduit_leaf(const DataType &dtype)
+create_hdf5_compression_plist_for_conduit_leaf(const DataType &dtype,
+                                               const HDF5Options &opts)
 {
+    hsize_t num_eles = (hsize_t) dtype.number_of_elements();
+    index_t num_bytes = dtype.bytes_compact();
+
+    // small leaves (and leaves we don't compress) are written contiguous,
+    // chunking only pays off when we apply filters
+    if( opts.compression_method == "none" ||
+        num_eles == 0 ||
+        num_bytes < opts.chunk_threshold )
+    {
+        return H5P_DEFAULT;
+    }
+
     hid_t h5_cprops_id = H5Pcreate(H5P_DATASET_CREATE);
 
-    hsize_t num_eles = (hsize_t) dtype.number_of_elements();
     // Turn on chunking...needed for compression
-    hsize_t chunk_size = 1024;
-    double num_chunks = (double) num_eles / (double) chunk_size;
-    double partial_chunk = num_chunks - (int) num_chunks;
-    double chunk_waste = 1 - partial_chunk;
-    if (chunk_waste > 0.1 || num_eles < chunk_size)
+    hsize_t chunk_size = num_eles;
+    if(opts.chunk_size > 0)
     {
-        chunk_size = num_eles;
+        index_t ele_bytes = dtype.element_bytes();
+        chunk_size = (hsize_t) (opts.chunk_size / ele_bytes);
+        if(chunk_size == 0)
+        {
+            chunk_size = 1;
+        }
+        else if(chunk_size > num_eles)
+        {
+            chunk_size = num_eles;
+        }
     }
 
     H5Pset_chunk(h5_cprops_id, 1, &chunk_size);
 
     // Turn on compression
-    H5Pset_shuffle(h5_cprops_id);
-    H5Pset_deflate(h5_cprops_id, 9);
+    if(opts.shuffle)
+    {
+        H5Pset_shuffle(h5_cprops_id);
+    }
+    H5Pset_deflate(h5_cprops_id, opts.compression_level);
 
     return h5_cprops_id;
 }
@@ -700,7 +900,8 @@ hid_t
 create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
                                      const std::string &ref_path,
                                      hid_t hdf5_group_id,
-                                     const std::string &hdf5_dset_name)
+                                     const std::string &hdf5_dset_name,
+                                     const HDF5Options &opts)
 {
     hid_t res = -1;
     
@@ -708,7 +909,8 @@ create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
 
     hsize_t num_eles = (hsize_t) dtype.number_of_elements();
     
-    hid_t h5_cprops_id = create_hdf5_compression_plist_for_conduit_leaf(dtype);
+    hid_t h5_cprops_id = create_hdf5_compression_plist_for_conduit_leaf(dtype,
+                                                                        opts);
     
     hid_t h5_dspace_id = H5Screate_simple(1,
                                           &num_eles,
@@ -734,11 +936,14 @@ create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
                                            << hdf5_dset_name);
 
     // close plist used for compression
-    CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(H5Pclose(h5_cprops_id),
-                                           ref_path,
-                                           "Failed to close HDF5 compression "
-                                           "property list " 
-                                           << h5_cprops_id);
+    if(h5_cprops_id != H5P_DEFAULT)
+    {
+        CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(H5Pclose(h5_cprops_id),
+                                               ref_path,
+                                               "Failed to close HDF5 "
+                                               "compression property list " 
+                                               << h5_cprops_id);
+    }
 
     // close our dataspace
     CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(H5Sclose(h5_dspace_id),
@@ -844,7 +1049,8 @@ void
 write_conduit_leaf_to_hdf5_group(const Node &node,
                                  const std::string &ref_path,
                                  hid_t hdf5_group_id,
-                                 const std::string &hdf5_dset_name)
+                                 const std::string &hdf5_dset_name,
+                                 const HDF5Options &opts)
 {
 
     // check if the dataset exists
@@ -879,7 +1085,8 @@ write_conduit_leaf_to_hdf5_group(const Node &node,
         h5_child_id = create_hdf5_dataset_for_conduit_leaf(node.dtype(),
                                                            ref_path,
                                                            hdf5_group_id,
-                                                           hdf5_dset_name);
+                                                           hdf5_dset_name,
+                                                           opts);
 
         CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(h5_child_id,
                                                ref_path,
@@ -952,7 +1159,8 @@ write_conduit_empty_to_hdf5_group(hid_t hdf5_group_id,
 void
 write_conduit_object_to_hdf5_group(const Node &node,
                                    const std::string &ref_path,
-                                   hid_t hdf5_group_id)
+                                   hid_t hdf5_group_id,
+                                   const HDF5Options &opts)
 {
     NodeConstIterator itr = node.children();
 
@@ -967,7 +1175,8 @@ write_conduit_object_to_hdf5_group(const Node &node,
             write_conduit_leaf_to_hdf5_group(child,
                                              ref_path,
                                              hdf5_group_id,
-                                             itr.name().c_str());
+                                             itr.name().c_str(),
+                                             opts);
         }
         else if(dt.is_empty())
         {
@@ -1038,7 +1247,8 @@ write_conduit_object_to_hdf5_group(const Node &node,
             // traverse 
             write_conduit_object_to_hdf5_group(child,
                                                ref_path,
-                                               h5_child_id);
+                                               h5_child_id,
+                                               opts);
 
             CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(H5Gclose(h5_child_id),
                                                    ref_path,
@@ -1063,7 +1273,8 @@ write_conduit_object_to_hdf5_group(const Node &node,
 void
 write_conduit_node_to_hdf5_tree(const Node &node,
                                 const std::string &ref_path,
-                                hid_t hdf5_id)
+                                hid_t hdf5_id,
+                                const HDF5Options &opts)
 {
 
     DataType dt = node.dtype();
@@ -1078,7 +1289,8 @@ write_conduit_node_to_hdf5_tree(const Node &node,
     {
         write_conduit_object_to_hdf5_group(node,
                                            ref_path,
-                                           hdf5_id);
+                                           hdf5_id,
+                                           opts);
     }
     else // not supported
     {
@@ -1144,6 +1356,8 @@ struct h5_read_opdata
     // pointer to conduit node, anchors traversal to 
     Node            *node;
     std::string      ref_path;
+    // options for reading datasets
+    const HDF5ReadOptions *opts;
 };
 
 //---------------------------------------------------------------------------//
@@ -1260,6 +1474,7 @@ h5_literate_traverse_op_func(hid_t hdf5_id,
 
                 read_hdf5_group_into_conduit_node(h5_group_id,
                                                   chld_ref_path,
+                                                  *h5_od->opts,
                                                   chld_node);
 
                 // close the group
@@ -1290,6 +1505,7 @@ h5_literate_traverse_op_func(hid_t hdf5_id,
 
             read_hdf5_dataset_into_conduit_node(h5_dset_id,
                                                 chld_ref_path,
+                                                *h5_od->opts,
                                                 leaf);
             
             // close the dataset
@@ -1314,6 +1530,7 @@ h5_literate_traverse_op_func(hid_t hdf5_id,
 void
 read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
                                   const std::string &ref_path,
+                                  const HDF5ReadOptions &opts,
                                   Node &dest)
 {
     // we want to make sure this is a conduit object
@@ -1335,6 +1552,7 @@ read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
     h5_od.node = &dest;
     // keep ref path
     h5_od.ref_path = ref_path;
+    h5_od.opts = &opts;
 
     H5_index_t h5_grp_index_type = H5_INDEX_NAME;
     
@@ -1385,10 +1603,187 @@ read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
                                            << hdf5_group_id);
 }
 
+//---------------------------------------------------------------------------//
+// selects the elements requested by the read options in the dataset's 
+// dataspace via a hyperslab, and creates a matching memory dataspace
+//---------------------------------------------------------------------------//
+void
+select_hdf5_dataset_elements(hid_t h5_dspace_id,
+                             index_t dset_nelems,
+                             const std::string &ref_path,
+                             const HDF5ReadOptions &opts,
+                             index_t &sel_nelems,
+                             hid_t &h5_mspace_id)
+{
+    if(H5Sget_simple_extent_ndims(h5_dspace_id) != 1)
+    {
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "HDF5 read selections are only supported for"
+                           " 1D datasets");
+    }
+
+    if(opts.offset > dset_nelems)
+    {
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "HDF5 read offset (" << opts.offset << ")"
+                           " is beyond the end of the dataset"
+                           " (" << dset_nelems << " elements)");
+    }
+
+    // number of elements available from the offset with the given stride
+    index_t num_avail = (dset_nelems - opts.offset + opts.stride - 1) / 
+                        opts.stride;
+
+    sel_nelems = num_avail;
+    if(opts.size >= 0)
+    {
+        if(opts.size > num_avail)
+        {
+            CONDUIT_HDF5_ERROR(ref_path,
+                               "HDF5 read selection of " << opts.size 
+                               << " elements (offset: " << opts.offset
+                               << ", stride: " << opts.stride << ")"
+                               << " is beyond the end of the dataset"
+                               << " (" << dset_nelems << " elements)");
+        }
+        sel_nelems = opts.size;
+    }
+
+    hsize_t h5_offset = (hsize_t) opts.offset;
+    hsize_t h5_stride = (hsize_t) opts.stride;
+    hsize_t h5_count  = (hsize_t) sel_nelems;
+
+    if(sel_nelems > 0)
+    {
+        CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(
+                                    H5Sselect_hyperslab(h5_dspace_id,
+                                                        H5S_SELECT_SET,
+                                                        &h5_offset,
+                                                        &h5_stride,
+                                                        &h5_count,
+                                                        NULL),
+                                    ref_path,
+                                    "Error selecting HDF5 hyperslab");
+    }
+    else
+    {
+        H5Sselect_none(h5_dspace_id);
+    }
+
+    h5_mspace_id = H5Screate_simple(1,&h5_count,NULL);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(h5_mspace_id,
+                                           ref_path,
+                                           "Error creating HDF5 Dataspace");
+}
+
+//---------------------------------------------------------------------------//
+// reads nelems from the (selected) dataset into an existing leaf with a 
+// compatible dtype, in place.
+//
+// The memory type uses the leaf's endianness, so hdf5 handles any 
+// conversion. Strides that are a multiple of the element size are 
+// described with a hyperslab of the memory dataspace, other strides 
+// (e.g. interleaved mixed types) read compact and copy each element.
+//---------------------------------------------------------------------------//
+void
+read_hdf5_dataset_into_compatible_leaf(hid_t hdf5_dset_id,
+                                       hid_t h5_fspace_id,
+                                       hid_t h5_mspace_id,
+                                       index_t nelems,
+                                       const std::string &ref_path,
+                                       Node &dest)
+{
+    const DataType &dest_dt = dest.dtype();
+    index_t ele_bytes = dest_dt.element_bytes();
+    index_t stride    = dest_dt.stride();
+
+    hid_t h5_dtype_id = conduit_dtype_to_hdf5_dtype(dest_dt,ref_path);
+    herr_t h5_status = 0;
+
+    if(stride == ele_bytes)
+    {
+        h5_status = H5Dread(hdf5_dset_id,
+                            h5_dtype_id,
+                            h5_mspace_id,
+                            h5_fspace_id,
+                            H5P_DEFAULT,
+                            dest.element_ptr(0));
+    }
+    else if(stride > 0 && (stride % ele_bytes) == 0)
+    {
+        // memory dataspace spans the strided elements, select every 
+        // stride-th element
+        hsize_t h5_mem_stride = (hsize_t) (stride / ele_bytes);
+        hsize_t h5_mem_nelems = (hsize_t) ((nelems - 1) * h5_mem_stride + 1);
+        hsize_t h5_mem_offset = 0;
+        hsize_t h5_count      = (hsize_t) nelems;
+
+        hid_t h5_strided_mspace_id = H5Screate_simple(1,
+                                                      &h5_mem_nelems,
+                                                      NULL);
+        CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(h5_strided_mspace_id,
+                                               ref_path,
+                                               "Error creating HDF5 "
+                                               "Dataspace");
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(
+                                    H5Sselect_hyperslab(h5_strided_mspace_id,
+                                                        H5S_SELECT_SET,
+                                                        &h5_mem_offset,
+                                                        &h5_mem_stride,
+                                                        &h5_count,
+                                                        NULL),
+                                    ref_path,
+                                    "Error selecting HDF5 hyperslab");
+
+        h5_status = H5Dread(hdf5_dset_id,
+                            h5_dtype_id,
+                            h5_strided_mspace_id,
+                            h5_fspace_id,
+                            H5P_DEFAULT,
+                            dest.element_ptr(0));
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(H5Sclose(h5_strided_mspace_id),
+                                               ref_path,
+                                               "Error closing HDF5 "
+                                               "Dataspace: "
+                                               << h5_strided_mspace_id);
+    }
+    else
+    {
+        Node n_tmp(DataType(dest_dt.id(),
+                            nelems,
+                            0,
+                            ele_bytes,
+                            ele_bytes,
+                            dest_dt.endianness()));
+
+        h5_status = H5Dread(hdf5_dset_id,
+                            h5_dtype_id,
+                            h5_mspace_id,
+                            h5_fspace_id,
+                            H5P_DEFAULT,
+                            n_tmp.data_ptr());
+
+        for(index_t i = 0; i < nelems; i++)
+        {
+            memcpy(dest.element_ptr(i),
+                   n_tmp.element_ptr(i),
+                   (size_t)ele_bytes);
+        }
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(h5_status,
+                                           ref_path,
+                                           "Error reading HDF5 Dataset: "
+                                           << hdf5_dset_id);
+}
+
 //---------------------------------------------------------------------------//
 void
 read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
                                     const std::string &ref_path,
+                                    const HDF5ReadOptions &opts,
                                     Node &dest)
 {
     hid_t h5_dspace_id = H5Dget_space(hdf5_dset_id);
@@ -1415,6 +1810,21 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
 
     
         index_t nelems     = H5Sget_simple_extent_npoints(h5_dspace_id);
+
+        // select a subset of the dataset's elements if requested
+        hid_t h5_mspace_id = H5S_ALL;
+        hid_t h5_fspace_id = H5S_ALL;
+        if(opts.has_selection())
+        {
+            select_hdf5_dataset_elements(h5_dspace_id,
+                                         nelems,
+                                         ref_path,
+                                         opts,
+                                         nelems,
+                                         h5_mspace_id);
+            h5_fspace_id = h5_dspace_id;
+        }
+
         DataType dt        = hdf5_dtype_to_conduit_dtype(h5_dtype_id,
                                                          nelems,
                                                          ref_path);
@@ -1451,35 +1861,47 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
         
         hid_t h5_status    = 0;
     
-        if(dest.dtype().is_compact() && 
-           dest.dtype().compatible(dt) )
+        if(opts.schema_only)
         {
-            // we can read directly from hdf5 dataset if compact 
-            // & compatible
-            h5_status = H5Dread(hdf5_dset_id,
-                                h5_dtype_id,
-                                H5S_ALL,
-                                H5S_ALL,
-                                H5P_DEFAULT,
-                                dest.data_ptr());
+            // describe the leaf without allocating or reading its data
+            dest.set_external(dt,NULL);
+        }
+        else if(nelems == 0)
+        {
+            // nothing to read
+            dest.set(dt);
+        }
+        else if(dest.dtype().compatible(dt))
+        {
+            // read directly into the destination's memory, this includes
+            // strided (e.g. interleaved) and external destinations
+            read_hdf5_dataset_into_compatible_leaf(hdf5_dset_id,
+                                                   h5_fspace_id,
+                                                   h5_mspace_id,
+                                                   nelems,
+                                                   ref_path,
+                                                   dest);
         }
         else
         {
-            // we create a temp Node b/c we want read to work for 
-            // strided data
-            // 
-            // the hdf5 data will always be compact, source node we are 
-            // reading will not unless it's already compatible and compact.
-            Node n_tmp(dt);
+            // allocate compact storage for the dataset and read 
+            // directly into it
+            dest.set(dt);
             h5_status = H5Dread(hdf5_dset_id,
                                 h5_dtype_id,
-                                H5S_ALL,
-                                H5S_ALL,
+                                h5_mspace_id,
+                                h5_fspace_id,
                                 H5P_DEFAULT,
-                                n_tmp.data_ptr());
-        
-            // copy out to our dest
-        dest.set(n_tmp);
+                                dest.data_ptr());
+        }
+
+        if(h5_mspace_id != H5S_ALL)
+        {
+            CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(H5Sclose(h5_mspace_id),
+                                                   ref_path,
+                                                   "Error closing HDF5 "
+                                                   "Dataspace: "
+                                                   << h5_mspace_id);
         }
 
         CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(h5_status,
@@ -1505,6 +1927,7 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
 void
 read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
                                  const std::string  &ref_path,
+                                 const HDF5ReadOptions &opts,
                                  Node &dest)
 {
     herr_t     h5_status = 0;
@@ -1527,6 +1950,7 @@ read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
         {
             read_hdf5_group_into_conduit_node(hdf5_id,
                                               ref_path,
+                                              opts,
                                               dest);
             break;
         }
@@ -1536,6 +1960,7 @@ read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
         {
             read_hdf5_dataset_into_conduit_node(hdf5_id,
                                                 ref_path,
+                                                opts,
                                                 dest);
             break;
         }
@@ -1583,6 +2008,15 @@ read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
 void 
 hdf5_write(const  Node &node,
            const std::string &path)
+{
+    hdf5_write(node,path,Node());
+}
+
+//---------------------------------------------------------------------------//
+void 
+hdf5_write(const  Node &node,
+           const std::string &path,
+           const Node &opts)
 {
     // check for ":" split
     std::string file_path;
@@ -1601,7 +2035,8 @@ hdf5_write(const  Node &node,
 
     hdf5_write(node,
                file_path,
-               hdf5_path);
+               hdf5_path,
+               opts);
 }
 
 
@@ -1611,6 +2046,20 @@ hdf5_write(const Node &node,
            const std::string &file_path,
            const std::string &hdf5_path)
 {
+    hdf5_write(node,file_path,hdf5_path,Node());
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_write(const Node &node,
+           const std::string &file_path,
+           const std::string &hdf5_path,
+           const Node &opts)
+{
+    // check the options before we create (and truncate) the file
+    HDF5Options h5_opts = hdf5_default_options();
+    h5_opts.set(opts);
+
     // preserve creation order
     hid_t h5_file_plist = H5Pcreate(H5P_FILE_CREATE);
 
@@ -1642,7 +2091,8 @@ hdf5_write(const Node &node,
     
     hdf5_write(node,
                h5_file_id,
-               hdf5_path);
+               hdf5_path,
+               opts);
 
     // close the hdf5 file
     CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
@@ -1656,6 +2106,20 @@ hdf5_write(const Node &node,
            hid_t hdf5_id,
            const std::string &hdf5_path)
 {
+    hdf5_write(node,hdf5_id,hdf5_path,Node());
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_write(const Node &node,
+           hid_t hdf5_id,
+           const std::string &hdf5_path,
+           const Node &opts)
+{
+    // apply any passed options to a copy of the defaults
+    HDF5Options h5_opts = hdf5_default_options();
+    h5_opts.set(opts);
+
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -1715,7 +2179,7 @@ hdf5_write(const Node &node,
                                                           hdf5_id))
     {
         // write if we are compat
-        write_conduit_node_to_hdf5_tree(n,"",hdf5_id);
+        write_conduit_node_to_hdf5_tree(n,"",hdf5_id,h5_opts);
     }
     else
     {
@@ -1732,6 +2196,19 @@ void
 hdf5_write(const Node &node,
            hid_t hdf5_id)
 {
+    hdf5_write(node,hdf5_id,Node());
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_write(const Node &node,
+           hid_t hdf5_id,
+           const Node &opts)
+{
+    // apply any passed options to a copy of the defaults
+    HDF5Options h5_opts = hdf5_default_options();
+    h5_opts.set(opts);
+
     // disable hdf5 error stack
     // TODO: we may only need to use this in an outer level variant
     // of check_if_conduit_node_is_compatible_with_hdf5_tree
@@ -1745,7 +2222,8 @@ hdf5_write(const Node &node,
         // write if we are compat
         write_conduit_node_to_hdf5_tree(node,
                                         "",
-                                        hdf5_id);
+                                        hdf5_id,
+                                        h5_opts);
     }
     else
     {
@@ -1756,6 +2234,24 @@ hdf5_write(const Node &node,
 }
 
 
+//---------------------------------------------------------------------------//
+void
+hdf5_set_options(const Node &opts)
+{
+    // only update the defaults if all of the options are valid
+    HDF5Options h5_opts = hdf5_default_options();
+    h5_opts.set(opts);
+    hdf5_default_options() = h5_opts;
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_options(Node &opts)
+{
+    hdf5_default_options().about(opts);
+}
+
+
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
@@ -1796,28 +2292,36 @@ hdf5_read(const std::string &file_path,
           const std::string &hdf5_path,
           Node &node)
 {
-    // open the hdf5 file for reading
-    hid_t h5_file_id = H5Fopen(file_path.c_str(),
-                               H5F_ACC_RDONLY,
-                               H5P_DEFAULT);
+    hdf5_read(file_path,hdf5_path,Node(),node);
+}
 
-    CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
-                             "Error opening HDF5 file for reading: " 
-                              << file_path);
+//---------------------------------------------------------------------------//
+void
+hdf5_read(const std::string &file_path,
+          const std::string &hdf5_path,
+          const Node &opts,
+          Node &node)
+{
+    // open the hdf5 file for reading
+    hid_t h5_file_id = hdf5_open_file_for_read(file_path);
 
     hdf5_read(h5_file_id,
               hdf5_path,
+              opts,
               node);
     
     // close the hdf5 file
-    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
-                             "Error closing HDF5 file: " << file_path);
+    hdf5_close_file(h5_file_id);
 }
+
 //---------------------------------------------------------------------------//
-void
-hdf5_read(hid_t hdf5_id,
-          const std::string &hdf5_path,
-          Node &dest)
+// reads the object at the given path with the given options
+//---------------------------------------------------------------------------//
+static void
+read_hdf5_path_into_conduit_node(hid_t hdf5_id,
+                                 const std::string &hdf5_path,
+                                 const HDF5ReadOptions &opts,
+                                 Node &dest)
 {
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
@@ -1833,6 +2337,7 @@ hdf5_read(hid_t hdf5_id,
 
     read_hdf5_tree_into_conduit_node(h5_child_obj,
                                      hdf5_path,
+                                     opts,
                                      dest);
     
     CONDUIT_CHECK_HDF5_ERROR(H5Oclose(h5_child_obj),
@@ -1842,6 +2347,34 @@ hdf5_read(hid_t hdf5_id,
     // enable hdf5 error stack
 }
 
+//---------------------------------------------------------------------------//
+void
+hdf5_read(hid_t hdf5_id,
+          const std::string &hdf5_path,
+          Node &dest)
+{
+    read_hdf5_path_into_conduit_node(hdf5_id,
+                                     hdf5_path,
+                                     HDF5ReadOptions(),
+                                     dest);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read(hid_t hdf5_id,
+          const std::string &hdf5_path,
+          const Node &opts,
+          Node &dest)
+{
+    HDF5ReadOptions h5_opts;
+    h5_opts.set(opts);
+
+    read_hdf5_path_into_conduit_node(hdf5_id,
+                                     hdf5_path,
+                                     h5_opts,
+                                     dest);
+}
+
 
 //---------------------------------------------------------------------------//
 void
@@ -1853,11 +2386,278 @@ hdf5_read(hid_t hdf5_id,
     
     read_hdf5_tree_into_conduit_node(hdf5_id,
                                      "",
+                                     HDF5ReadOptions(),
                                      dest);
     
     // enable hdf5 error stack
 }
 
+//---------------------------------------------------------------------------//
+void
+hdf5_read_schema(const std::string &path,
+                 Schema &schema)
+{
+    // check for ":" split
+    std::string file_path;
+    std::string hdf5_path;
+    conduit::utils::split_string(path,
+                                 std::string(":"),
+                                 file_path,
+                                 hdf5_path);
+
+    // We will read the root if no hdf5_path is given.
+    if(hdf5_path.size() == 0)
+    {
+        hdf5_path = "/";
+    }
+
+    hid_t h5_file_id = hdf5_open_file_for_read(file_path);
+
+    hdf5_read_schema(h5_file_id,
+                     hdf5_path,
+                     schema);
+
+    hdf5_close_file(h5_file_id);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read_schema(hid_t hdf5_id,
+                 const std::string &hdf5_path,
+                 Schema &schema)
+{
+    HDF5ReadOptions h5_opts;
+    h5_opts.schema_only = true;
+
+    // leaves are set external to NULL, so no data is allocated
+    Node n;
+    read_hdf5_path_into_conduit_node(hdf5_id,
+                                     hdf5_path,
+                                     h5_opts,
+                                     n);
+    schema.reset();
+    n.schema().compact_to(schema);
+}
+
+//---------------------------------------------------------------------------//
+hid_t
+hdf5_open_file_for_read(const std::string &file_path)
+{
+    hid_t h5_file_id = H5Fopen(file_path.c_str(),
+                               H5F_ACC_RDONLY,
+                               H5P_DEFAULT);
+
+    CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
+                             "Error opening HDF5 file for reading: " 
+                              << file_path);
+    return h5_file_id;
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_close_file(hid_t hdf5_id)
+{
+    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(hdf5_id),
+                             "Error closing HDF5 file: " << hdf5_id);
+}
+
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// HDF5LazyReader
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+HDF5LazyReader::HDF5LazyReader()
+: m_file_id(-1),
+  m_hdf5_path(),
+  m_schema(),
+  m_data(),
+  m_loaded()
+{}
+
+//---------------------------------------------------------------------------//
+HDF5LazyReader::~HDF5LazyReader()
+{
+    // avoid throwing from the destructor
+    if(m_file_id >= 0)
+    {
+        H5Fclose(m_file_id);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5LazyReader::open(const std::string &path)
+{
+    close();
+
+    std::string file_path;
+    std::string hdf5_path;
+    conduit::utils::split_string(path,
+                                 std::string(":"),
+                                 file_path,
+                                 hdf5_path);
+
+    if(hdf5_path.size() == 0)
+    {
+        hdf5_path = "/";
+    }
+
+    m_file_id = hdf5_open_file_for_read(file_path);
+    m_hdf5_path = hdf5_path;
+    hdf5_read_schema(m_file_id, m_hdf5_path, m_schema);
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5LazyReader::close()
+{
+    if(m_file_id >= 0)
+    {
+        hid_t h5_file_id = m_file_id;
+        m_file_id = -1;
+        hdf5_close_file(h5_file_id);
+    }
+
+    m_hdf5_path = "";
+    m_schema.reset();
+    m_data.reset();
+    m_loaded.clear();
+}
+
+//---------------------------------------------------------------------------//
+bool
+HDF5LazyReader::is_open() const
+{
+    return m_file_id >= 0;
+}
+
+//---------------------------------------------------------------------------//
+const Schema &
+HDF5LazyReader::schema() const
+{
+    return m_schema;
+}
+
+//---------------------------------------------------------------------------//
+bool
+HDF5LazyReader::has_path(const std::string &path) const
+{
+    return m_schema.has_path(path);
+}
+
+//---------------------------------------------------------------------------//
+bool
+HDF5LazyReader::is_loaded(const std::string &path) const
+{
+    return m_loaded.find(path) != m_loaded.end();
+}
+
+//---------------------------------------------------------------------------//
+Node &
+HDF5LazyReader::fetch(const std::string &path)
+{
+    if(!is_open())
+    {
+        CONDUIT_ERROR("HDF5LazyReader::fetch: no file is open");
+    }
+
+    if(!path.empty() && !m_schema.has_path(path))
+    {
+        CONDUIT_ERROR("HDF5LazyReader::fetch: \"" << path << "\""
+                      " does not exist in HDF5 file");
+    }
+
+    load(path);
+
+    if(path.empty())
+    {
+        return m_data;
+    }
+
+    return m_data.fetch(path);
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5LazyReader::release(const std::string &path)
+{
+    if(path.empty())
+    {
+        m_data.reset();
+        m_loaded.clear();
+        return;
+    }
+
+    if(m_data.has_path(path))
+    {
+        m_data.remove(path);
+    }
+
+    // forget any loaded leaves at or below the path
+    std::string prefix = path + "/";
+    std::set<std::string>::iterator itr = m_loaded.begin();
+    while(itr != m_loaded.end())
+    {
+        if( *itr == path || itr->compare(0,prefix.size(),prefix) == 0 )
+        {
+            m_loaded.erase(itr++);
+        }
+        else
+        {
+            itr++;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5LazyReader::load(const std::string &path)
+{
+    const Schema &s = path.empty() ? m_schema : m_schema.fetch_child(path);
+
+    if(s.dtype().is_object())
+    {
+        // keep any children we have already loaded
+        Node &n = path.empty() ? m_data : m_data.fetch(path);
+        if(!n.dtype().is_object())
+        {
+            n.set(DataType::object());
+        }
+
+        const std::vector<std::string> &cld_names = s.child_names();
+        for(size_t i = 0; i < cld_names.size(); i++)
+        {
+            std::string cld_path = cld_names[i];
+            if(!path.empty())
+            {
+                cld_path = path + "/" + cld_path;
+            }
+            load(cld_path);
+        }
+    }
+    else if(!is_loaded(path))
+    {
+        std::string hdf5_path = m_hdf5_path;
+        if(!path.empty())
+        {
+            if(hdf5_path[hdf5_path.size()-1] != '/')
+            {
+                hdf5_path += "/";
+            }
+            hdf5_path += path;
+        }
+
+        Node &n = path.empty() ? m_data : m_data.fetch(path);
+        hdf5_read(m_file_id, hdf5_path, n);
+        m_loaded.insert(path);
+    }
+}
+
 
 }
 //-----------------------------------------------------------------------------
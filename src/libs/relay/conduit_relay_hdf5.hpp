@@ -51,6 +51,11 @@
 #ifndef CONDUIT_RELAY_HDF5_HPP
 #define CONDUIT_RELAY_HDF5_HPP
 
+//-----------------------------------------------------------------------------
+// standard lib includes
+//-----------------------------------------------------------------------------
+#include <set>
+
 //-----------------------------------------------------------------------------
 // external lib includes
 //-----------------------------------------------------------------------------
@@ -133,6 +138,34 @@ namespace io
 //-----------------------------------------------------------------------------
 
 
+//-----------------------------------------------------------------------------
+/// Options that control how leaves are stored
+///
+/// The write methods accept an optional options Node, entries it contains
+/// override the global defaults (set via hdf5_set_options) for that write:
+///
+///  compression:
+///    method:  "deflate" (default) or "none"
+///    level:   deflate level 0-9 (default: 9)
+///    shuffle: "true" (default) or "false", apply the shuffle filter
+///             (numeric values are also accepted, non-zero means "true")
+///  chunking:
+///    threshold:  leaves with fewer bytes are written contiguous 
+///                (default: 0)
+///    chunk_size: target bytes per chunk, 0 uses a single chunk for the 
+///                entire leaf (default: 1048576)
+///
+/// Chunking is only used for compressed leaves, with method "none" all 
+/// leaves are written contiguous. Options only apply when datasets are 
+/// created, writes to existing datasets use their existing layout.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_set_options(const Node &opts);
+
+//-----------------------------------------------------------------------------
+/// Returns the current global default options 
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_options(Node &opts);
+
 //-----------------------------------------------------------------------------
 /// Write node data to a given path
 ///
@@ -143,6 +176,10 @@ namespace io
 void CONDUIT_RELAY_API hdf5_write(const Node &node,
                                   const std::string &path);
 
+void CONDUIT_RELAY_API hdf5_write(const Node &node,
+                                  const std::string &path,
+                                  const Node &opts);
+
 //-----------------------------------------------------------------------------
 /// Write node data to given file system path and internal hdf5 path
 //-----------------------------------------------------------------------------
@@ -150,6 +187,11 @@ void CONDUIT_RELAY_API hdf5_write(const Node &node,
                                   const std::string &file_path,
                                   const std::string &hdf5_path);
 
+void CONDUIT_RELAY_API hdf5_write(const Node &node,
+                                  const std::string &file_path,
+                                  const std::string &hdf5_path,
+                                  const Node &opts);
+
 //-----------------------------------------------------------------------------
 /// Write node data to the hdf5_path relative to group represented  by 
 /// hdf5_id 
@@ -158,6 +200,11 @@ void CONDUIT_RELAY_API hdf5_write(const Node &node,
                                   hid_t hdf5_id,
                                   const std::string &hdf5_path);
 
+void CONDUIT_RELAY_API hdf5_write(const Node &node,
+                                  hid_t hdf5_id,
+                                  const std::string &hdf5_path,
+                                  const Node &opts);
+
 //-----------------------------------------------------------------------------
 /// Write node data to group represented by hdf5_id
 /// 
@@ -167,6 +214,10 @@ void CONDUIT_RELAY_API hdf5_write(const Node &node,
 void CONDUIT_RELAY_API hdf5_write(const Node &node,
                                   hid_t hdf5_id);
 
+void CONDUIT_RELAY_API hdf5_write(const Node &node,
+                                  hid_t hdf5_id,
+                                  const Node &opts);
+
 //-----------------------------------------------------------------------------
 /// Read hdf5 data from given path into the output node 
 /// 
@@ -191,6 +242,95 @@ void CONDUIT_RELAY_API hdf5_read(const std::string &file_path,
 void CONDUIT_RELAY_API hdf5_read(hid_t hdf5_id,
                                  const std::string &hdf5_path,
                                  Node &node);
+
+//-----------------------------------------------------------------------------
+/// Read variants that accept an options Node, used to read a subset of the
+/// elements of each 1D dataset via a hyperslab selection:
+///
+///   offset: index of the first element to read (default: 0)
+///   stride: step between elements (default: 1)
+///   size:   number of elements to read (default: all remaining elements)
+///
+/// A selection that extends beyond the end of a dataset is an error.
+/// Combine with hdf5_read_schema to find paths and sizes first, and read 
+/// several paths via hdf5_open_file_for_read and the hid_t variant.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read(const std::string &file_path,
+                                 const std::string &hdf5_path,
+                                 const Node &opts,
+                                 Node &node);
+
+void CONDUIT_RELAY_API hdf5_read(hid_t hdf5_id,
+                                 const std::string &hdf5_path,
+                                 const Node &opts,
+                                 Node &node);
+
+//-----------------------------------------------------------------------------
+/// Read the tree structure and leaf dtypes (type and number of elements) 
+/// without reading any data. The resulting schema is compact. 
+///
+/// Like hdf5_read, path supports a file system and hdf5 path, joined 
+/// using a ":"
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read_schema(const std::string &path,
+                                        Schema &schema);
+
+void CONDUIT_RELAY_API hdf5_read_schema(hid_t hdf5_id,
+                                        const std::string &hdf5_path,
+                                        Schema &schema);
+
+//-----------------------------------------------------------------------------
+/// Helpers to open (read only) and close hdf5 files, for use with the 
+/// hid_t read variants.
+//-----------------------------------------------------------------------------
+hid_t CONDUIT_RELAY_API hdf5_open_file_for_read(const std::string &file_path);
+
+void  CONDUIT_RELAY_API hdf5_close_file(hid_t hdf5_id);
+
+//-----------------------------------------------------------------------------
+/// Lazy access to the tree of an hdf5 file.
+///
+/// open() reads the schema of the file (or the subtree at the given hdf5
+/// path), and keeps the file open. fetch() returns the node at a path,
+/// reading the data of the leaves under it that have not been read yet,
+/// leaves are read only once. release() frees the data under a path.
+//-----------------------------------------------------------------------------
+class CONDUIT_RELAY_API HDF5LazyReader
+{
+public:
+    HDF5LazyReader();
+   ~HDF5LazyReader();
+
+    /// supports a file system and hdf5 path, joined using a ":"
+    void            open(const std::string &path);
+    void            close();
+    bool            is_open() const;
+
+    /// schema of the entire tree, available without reading any data
+    const Schema   &schema() const;
+    bool            has_path(const std::string &path) const;
+
+    /// returns the node at the given path ("" for the entire tree), 
+    /// reading any leaves under it that haven't been read yet
+    Node           &fetch(const std::string &path);
+    /// true if the leaf at the given path has been read
+    bool            is_loaded(const std::string &path) const;
+    /// frees the data under the given path
+    void            release(const std::string &path);
+
+private:
+    // not copyable, we own an hdf5 file handle
+    HDF5LazyReader(const HDF5LazyReader &);
+    HDF5LazyReader &operator=(const HDF5LazyReader &);
+
+    void            load(const std::string &path);
+
+    hid_t                  m_file_id;
+    std::string            m_hdf5_path;
+    Schema                 m_schema;
+    Node                   m_data;
+    std::set<std::string>  m_loaded;
+};
 //-----------------------------------------------------------------------------
 /// Read from hdf5 id into the output node
 //-----------------------------------------------------------------------------
@@ -131,6 +131,10 @@ identify_protocol(const std::string &path,
     {
         io_type = "conduit_base64_json";
     }
+    else if(file_name_ext == "conduit_sbin")
+    {
+        io_type = "conduit_sbin";
+    }
     
     // default to conduit_bin
 
@@ -185,6 +189,7 @@ save(const Node &node,
 {
     // support conduit::Node's basic save cases
     if(protocol == "conduit_bin" ||
+       protocol == "conduit_sbin" ||
        protocol == "json" || 
        protocol == "conduit_json" ||
        protocol == "conduit_base64_json" )
@@ -233,6 +238,7 @@ save_merged(const Node &node,
 {
     // support conduit::Node's basic save cases
     if(protocol == "conduit_bin" ||
+       protocol == "conduit_sbin" ||
        protocol == "json" || 
        protocol == "conduit_json" ||
        protocol == "conduit_base64_json" )
@@ -289,6 +295,7 @@ load(const std::string &path,
 
     // support conduit::Node's basic load cases
     if(protocol == "conduit_bin" ||
+       protocol == "conduit_sbin" ||
        protocol == "json" || 
        protocol == "conduit_json" ||
        protocol == "conduit_base64_json" )
@@ -335,6 +342,7 @@ load_merged(const std::string &path,
 {
     // support conduit::Node's basic load cases
     if(protocol == "conduit_bin" ||
+       protocol == "conduit_sbin" ||
        protocol == "json" || 
        protocol == "conduit_json" ||
        protocol == "conduit_base64_json" )
@@ -77,6 +77,15 @@ namespace relay
 namespace io
 {
 
+///
+/// ``identify_protocol`` picks the protocol used by save and load for a
+/// path from its file extension (default: "conduit_bin")
+///
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API identify_protocol(const std::string &path,
+                                         std::string &protocol);
+
 ///
 /// ``save`` works like a 'set' to the file.
 ///
@@ -0,0 +1,682 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_async.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit_relay_io_async.hpp"
+#include "conduit_relay_io.hpp"
+
+//-----------------------------------------------------------------------------
+// standard lib includes
+//-----------------------------------------------------------------------------
+#include <deque>
+#include <map>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+#include <pthread.h>
+#endif
+
+// includes for optional features
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+#include "conduit_relay_hdf5.hpp"
+#endif
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+//-----------------------------------------------------------------------------
+// -- AsyncWriter internal state --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+// a pooled snapshot buffer and the write request that currently owns it
+//---------------------------------------------------------------------------//
+struct AsyncWriteBuffer
+{
+    std::vector<uint8>  data;
+    Node                snapshot;
+    index_t             id;
+    std::string         path;
+    std::string         protocol;
+    utils::Timer        latency_timer;
+};
+
+//---------------------------------------------------------------------------//
+class AsyncWriterState
+{
+public:
+                AsyncWriterState();
+               ~AsyncWriterState();
+
+    void        lock();
+    void        unlock();
+
+    // snapshots node into a free buffer, blocks while the queue is full
+    index_t     enqueue(const Node &node,
+                        const std::string &path,
+                        const std::string &protocol);
+
+    // blocks until id is complete, if block is false returns false
+    // when id is still pending. throws if the write failed.
+    bool        complete(index_t id, bool block);
+    void        complete_all();
+
+    // writes the snapshot and records the result
+    void        write(AsyncWriteBuffer *buff);
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    static void *worker_main(void *state);
+    void         worker_loop();
+#endif
+
+    index_t                          m_depth;
+    index_t                          m_next_id;
+
+    // all buffers, and the ones not owned by a pending write
+    std::vector<AsyncWriteBuffer*>   m_buffers;
+    std::vector<AsyncWriteBuffer*>   m_free;
+    // buffers waiting for the writer thread
+    std::deque<AsyncWriteBuffer*>    m_queue;
+
+    std::set<index_t>                m_pending;
+    // error messages for failed writes that have not been reported
+    std::map<index_t,std::string>    m_errors;
+
+    // stats
+    index_t                          m_num_writes;
+    index_t                          m_num_bytes;
+    float64                          m_snapshot_time;
+    float64                          m_write_time;
+    float64                          m_latency_total;
+    float64                          m_latency_max;
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    pthread_t                        m_thread;
+    pthread_mutex_t                  m_mutex;
+    // signaled when work is queued or on shutdown
+    pthread_cond_t                   m_work_cond;
+    // signaled when a write completes
+    pthread_cond_t                   m_done_cond;
+    bool                             m_shutdown;
+#endif
+};
+
+//---------------------------------------------------------------------------//
+AsyncWriterState::AsyncWriterState()
+: m_depth(2),
+  m_next_id(0),
+  m_num_writes(0),
+  m_num_bytes(0),
+  m_snapshot_time(0.0),
+  m_write_time(0.0),
+  m_latency_total(0.0),
+  m_latency_max(0.0)
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    m_shutdown = false;
+    pthread_mutex_init(&m_mutex,NULL);
+    pthread_cond_init(&m_work_cond,NULL);
+    pthread_cond_init(&m_done_cond,NULL);
+
+    if(pthread_create(&m_thread,
+                      NULL,
+                      AsyncWriterState::worker_main,
+                      this) != 0)
+    {
+        pthread_cond_destroy(&m_done_cond);
+        pthread_cond_destroy(&m_work_cond);
+        pthread_mutex_destroy(&m_mutex);
+        CONDUIT_ERROR("AsyncWriter: failed to start writer thread");
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+AsyncWriterState::~AsyncWriterState()
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    lock();
+    m_shutdown = true;
+    pthread_cond_signal(&m_work_cond);
+    unlock();
+    // the writer drains the queue before exiting
+    pthread_join(m_thread,NULL);
+
+    pthread_cond_destroy(&m_done_cond);
+    pthread_cond_destroy(&m_work_cond);
+    pthread_mutex_destroy(&m_mutex);
+#endif
+
+    for(size_t i=0; i < m_buffers.size(); i++)
+    {
+        delete m_buffers[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+AsyncWriterState::lock()
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    pthread_mutex_lock(&m_mutex);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+void
+AsyncWriterState::unlock()
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    pthread_mutex_unlock(&m_mutex);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// true if a write can run on the writer thread. Conduit's own formats don't
+// touch HDF5. Any other protocol (hdf5, or silo, which may be built on
+// HDF5) can't be used from a second thread unless the HDF5 library is
+// built thread safe, so those writes happen in the calling thread instead.
+//---------------------------------------------------------------------------//
+static bool
+use_writer_thread(const std::string &path,
+                  const std::string &protocol)
+{
+    std::string io_type = protocol;
+    if(io_type.empty())
+    {
+        identify_protocol(path,io_type);
+    }
+
+    if(io_type == "conduit_bin" ||
+       io_type == "conduit_sbin" ||
+       io_type == "json" ||
+       io_type == "conduit_json" ||
+       io_type == "conduit_base64_json" )
+    {
+        return true;
+    }
+
+    bool res = false;
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+    hbool_t is_threadsafe = 0;
+    if(H5is_library_threadsafe(&is_threadsafe) >= 0 && is_threadsafe)
+    {
+        res = true;
+    }
+#endif
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+AsyncWriterState::enqueue(const Node &node,
+                          const std::string &path,
+                          const std::string &protocol)
+{
+    utils::Timer snapshot_timer;
+
+    bool background = use_writer_thread(path,protocol);
+
+    lock();
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    while( (index_t)m_pending.size() >= m_depth)
+    {
+        pthread_cond_wait(&m_done_cond,&m_mutex);
+    }
+#endif
+
+    AsyncWriteBuffer *buff = NULL;
+    if(m_free.empty())
+    {
+        buff = new AsyncWriteBuffer();
+        m_buffers.push_back(buff);
+    }
+    else
+    {
+        buff = m_free.back();
+        m_free.pop_back();
+    }
+
+    index_t id = m_next_id++;
+    m_pending.insert(id);
+    unlock();
+
+    // the buffer is owned by this request, so the copy can happen
+    // outside of the lock while the writer thread keeps working.
+    // serialize reuses the buffer's existing allocation.
+    buff->id       = id;
+    buff->path     = path;
+    buff->protocol = protocol;
+    buff->latency_timer.reset();
+
+    try
+    {
+        Schema s_compact;
+        node.schema().compact_to(s_compact);
+        node.serialize(buff->data);
+        buff->snapshot.set_external(s_compact,
+                                    buff->data.empty() ? NULL :
+                                                         &buff->data[0]);
+    }
+    catch(...)
+    {
+        // give back the slot so waiters don't block on this id
+        lock();
+        m_pending.erase(id);
+        m_free.push_back(buff);
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+        pthread_cond_broadcast(&m_done_cond);
+#endif
+        unlock();
+        throw;
+    }
+
+    float64 snapshot_time = snapshot_timer.elapsed();
+
+    lock();
+    m_snapshot_time += snapshot_time;
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    if(background)
+    {
+        m_queue.push_back(buff);
+        pthread_cond_signal(&m_work_cond);
+        unlock();
+        return id;
+    }
+#endif
+    unlock();
+
+    // no writer thread, or the protocol can't be used from it
+    write(buff);
+
+    return id;
+}
+
+//---------------------------------------------------------------------------//
+bool
+AsyncWriterState::complete(index_t id, bool block)
+{
+    lock();
+    if(id < 0 || id >= m_next_id)
+    {
+        unlock();
+        CONDUIT_ERROR("AsyncWriter: invalid handle " << id);
+    }
+
+    while(m_pending.find(id) != m_pending.end())
+    {
+        if(!block)
+        {
+            unlock();
+            return false;
+        }
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+        pthread_cond_wait(&m_done_cond,&m_mutex);
+#endif
+    }
+
+    std::string err_msg;
+    bool failed = false;
+    std::map<index_t,std::string>::iterator itr = m_errors.find(id);
+    if(itr != m_errors.end())
+    {
+        failed  = true;
+        err_msg = itr->second;
+        m_errors.erase(itr);
+    }
+    unlock();
+
+    if(failed)
+    {
+        CONDUIT_ERROR("AsyncWriter: write " << id << " failed: " << err_msg);
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+void
+AsyncWriterState::complete_all()
+{
+    lock();
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    while(!m_pending.empty())
+    {
+        pthread_cond_wait(&m_done_cond,&m_mutex);
+    }
+#endif
+
+    // report the first failure, the rest are dropped
+    std::ostringstream oss;
+    bool failed = !m_errors.empty();
+    if(failed)
+    {
+        oss << "AsyncWriter: " << m_errors.size() << " write(s) failed. "
+            << "write " << m_errors.begin()->first << " failed: "
+            << m_errors.begin()->second;
+        m_errors.clear();
+    }
+    unlock();
+
+    if(failed)
+    {
+        CONDUIT_ERROR(oss.str());
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+AsyncWriterState::write(AsyncWriteBuffer *buff)
+{
+    std::string err_msg;
+    bool failed = false;
+
+    utils::Timer write_timer;
+    try
+    {
+        if(buff->protocol.empty())
+        {
+            relay::io::save(buff->snapshot,buff->path);
+        }
+        else
+        {
+            relay::io::save(buff->snapshot,buff->path,buff->protocol);
+        }
+    }
+    catch(conduit::Error &e)
+    {
+        failed  = true;
+        err_msg = e.message();
+    }
+    catch(std::exception &e)
+    {
+        failed  = true;
+        err_msg = e.what();
+    }
+    catch(...)
+    {
+        failed  = true;
+        err_msg = "unknown exception";
+    }
+    float64 write_time = write_timer.elapsed();
+    float64 latency    = buff->latency_timer.elapsed();
+
+    lock();
+    if(failed)
+    {
+        m_errors[buff->id] = err_msg;
+    }
+    else
+    {
+        m_num_writes++;
+        m_num_bytes     += (index_t)buff->data.size();
+        m_write_time    += write_time;
+        m_latency_total += latency;
+        if(latency > m_latency_max)
+        {
+            m_latency_max = latency;
+        }
+    }
+    m_pending.erase(buff->id);
+    m_free.push_back(buff);
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    pthread_cond_broadcast(&m_done_cond);
+#endif
+    unlock();
+}
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+//---------------------------------------------------------------------------//
+void *
+AsyncWriterState::worker_main(void *state)
+{
+    static_cast<AsyncWriterState*>(state)->worker_loop();
+    return NULL;
+}
+
+//---------------------------------------------------------------------------//
+void
+AsyncWriterState::worker_loop()
+{
+    while(true)
+    {
+        lock();
+        while(m_queue.empty() && !m_shutdown)
+        {
+            pthread_cond_wait(&m_work_cond,&m_mutex);
+        }
+
+        if(m_queue.empty())
+        {
+            // shutdown requested and nothing left to write
+            unlock();
+            return;
+        }
+
+        AsyncWriteBuffer *buff = m_queue.front();
+        m_queue.pop_front();
+        unlock();
+
+        write(buff);
+    }
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// -- AsyncWriter --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+AsyncWriter::AsyncWriter()
+: m_state(new AsyncWriterState())
+{}
+
+//---------------------------------------------------------------------------//
+AsyncWriter::~AsyncWriter()
+{
+    // joins the writer thread after pending writes finish,
+    // any unreported errors are dropped
+    delete m_state;
+}
+
+//---------------------------------------------------------------------------//
+void
+AsyncWriter::set_queue_depth(index_t depth)
+{
+    if(depth < 1)
+    {
+        CONDUIT_ERROR("AsyncWriter: queue depth must be >= 1"
+                      " (passed " << depth << ")");
+    }
+
+    m_state->lock();
+    m_state->m_depth = depth;
+    m_state->unlock();
+}
+
+//---------------------------------------------------------------------------//
+index_t
+AsyncWriter::queue_depth() const
+{
+    m_state->lock();
+    index_t res = m_state->m_depth;
+    m_state->unlock();
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+AsyncWriter::save(const Node &node,
+                  const std::string &path)
+{
+    // empty protocol: relay::io::save identifies it from the path
+    return m_state->enqueue(node,path,"");
+}
+
+//---------------------------------------------------------------------------//
+index_t
+AsyncWriter::save(const Node &node,
+                  const std::string &path,
+                  const std::string &protocol)
+{
+    return m_state->enqueue(node,path,protocol);
+}
+
+//---------------------------------------------------------------------------//
+void
+AsyncWriter::wait(index_t handle)
+{
+    m_state->complete(handle,true);
+}
+
+//---------------------------------------------------------------------------//
+bool
+AsyncWriter::test(index_t handle)
+{
+    return m_state->complete(handle,false);
+}
+
+//---------------------------------------------------------------------------//
+void
+AsyncWriter::wait_all()
+{
+    m_state->complete_all();
+}
+
+//---------------------------------------------------------------------------//
+index_t
+AsyncWriter::number_of_pending() const
+{
+    m_state->lock();
+    index_t res = (index_t)m_state->m_pending.size();
+    m_state->unlock();
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+AsyncWriter::stats(Node &res) const
+{
+    res.reset();
+    m_state->lock();
+
+    index_t num_writes = m_state->m_num_writes;
+    res["writes"]        = num_writes;
+    res["bytes"]         = m_state->m_num_bytes;
+    res["snapshot_time"] = m_state->m_snapshot_time;
+    res["write_time"]    = m_state->m_write_time;
+
+    float64 mbs = 0.0;
+    if(m_state->m_write_time > 0.0)
+    {
+        mbs = (m_state->m_num_bytes / (1024.0 * 1024.0))
+              / m_state->m_write_time;
+    }
+    res["write_throughput"] = mbs;
+
+    float64 avg_latency = 0.0;
+    if(num_writes > 0)
+    {
+        avg_latency = m_state->m_latency_total / num_writes;
+    }
+    res["latency/avg"] = avg_latency;
+    res["latency/max"] = m_state->m_latency_max;
+    res["buffers"]     = (index_t)m_state->m_buffers.size();
+
+    m_state->unlock();
+}
+
+//---------------------------------------------------------------------------//
+void
+AsyncWriter::reset_stats()
+{
+    m_state->lock();
+    m_state->m_num_writes    = 0;
+    m_state->m_num_bytes     = 0;
+    m_state->m_snapshot_time = 0.0;
+    m_state->m_write_time    = 0.0;
+    m_state->m_latency_total = 0.0;
+    m_state->m_latency_max   = 0.0;
+    m_state->unlock();
+}
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,164 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_async.hpp
+///
+//-----------------------------------------------------------------------------
+
+
+#ifndef CONDUIT_RELAY_IO_ASYNC_HPP
+#define CONDUIT_RELAY_IO_ASYNC_HPP
+
+//-----------------------------------------------------------------------------
+// conduit lib include 
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_relay_exports.h"
+#include "conduit_relay_config.h"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+//-----------------------------------------------------------------------------
+/// AsyncWriter runs relay::io::save calls on a background thread.
+///
+/// save() takes a compact snapshot of the node into a reusable buffer and
+/// returns a handle right away, so the caller can keep modifying the
+/// node while the file is written. At most queue_depth() snapshots are
+/// held at once, save() blocks until a slot frees up.
+///
+/// Errors raised while writing are reported by wait() or test() on the
+/// failed write's handle, or by wait_all().
+///
+/// On platforms without pthreads, writes happen synchronously in save().
+/// Writes that may use HDF5 (every protocol except conduit's own bin and
+/// json formats) also happen synchronously in save() unless the HDF5
+/// library is built thread safe.
+//-----------------------------------------------------------------------------
+
+// forward declare internal state
+class AsyncWriterState;
+
+class CONDUIT_RELAY_API AsyncWriter
+{
+public:
+                AsyncWriter();
+    /// waits for all pending writes, then stops the writer thread
+               ~AsyncWriter();
+
+    /// max number of snapshots queued or in flight (default: 2)
+    void        set_queue_depth(index_t depth);
+    index_t     queue_depth() const;
+
+    /// snapshot node and queue a write, returns a handle for wait / test
+    index_t     save(const Node &node,
+                     const std::string &path);
+
+    index_t     save(const Node &node,
+                     const std::string &path,
+                     const std::string &protocol);
+
+    /// blocks until the write for handle is complete
+    void        wait(index_t handle);
+    /// returns true if the write for handle is complete
+    bool        test(index_t handle);
+    /// blocks until all pending writes are complete
+    void        wait_all();
+
+    /// number of writes queued or in flight
+    index_t     number_of_pending() const;
+
+    /// throughput and latency report:
+    ///   writes, bytes, snapshot_time, write_time, write_throughput (MB/s),
+    ///   latency/{avg,max} (seconds from save() to write complete),
+    ///   buffers (number of pooled snapshot buffers)
+    void        stats(Node &res) const;
+    /// clears accumulated stats
+    void        reset_stats();
+
+private:
+    // not copyable
+                AsyncWriter(const AsyncWriter &);
+    AsyncWriter &operator=(const AsyncWriter &);
+
+    AsyncWriterState *m_state;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+
+#endif
+
@@ -50,6 +50,9 @@
 
 #include "conduit_relay_mpi.hpp"
 #include <iostream>
+#include <map>
+#include <sstream>
+#include <cstring>
 
 //-----------------------------------------------------------------------------
 /// The CONDUIT_CHECK_MPI_ERROR macro is used to check return values for 
@@ -115,318 +118,2899 @@ rank(MPI_Comm mpi_comm)
 
 
 //---------------------------------------------------------------------------//
-int 
-send(Node &node, int dest, int tag, MPI_Comm comm)
-{ 
-
-    Schema schema_c;
-    node.schema().compact_to(schema_c);
-    std::string schema = schema_c.to_json();
-    int schema_len = schema.length() + 1;
+// Collects the blocks of an MPI derived datatype that describes the leaf 
+// data of a node in place, using absolute addresses (for use with 
+// MPI_BOTTOM). The blocks follow the byte order of Node::serialize, and 
+// adjacent contiguous leaves are coalesced, so a compact node is 
+// described by a single block.
+//---------------------------------------------------------------------------//
+static int
+collect_mpi_blocks(const Node &node,
+                   std::vector<int> &lens,
+                   std::vector<MPI_Aint> &displs,
+                   std::vector<MPI_Datatype> &types,
+                   index_t &num_bytes)
+{
+    int mpi_error = MPI_SUCCESS;
+    index_t dtype_id = node.dtype().id();
 
-    std::vector<uint8> data;
-    node.serialize(data);
-    int data_len = data.size();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        NodeConstIterator itr = node.children();
+        while(itr.has_next())
+        {
+            mpi_error = collect_mpi_blocks(itr.next(),
+                                           lens,
+                                           displs,
+                                           types,
+                                           num_bytes);
+            CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        }
+        return mpi_error;
+    }
 
+    index_t num_ele = node.dtype().number_of_elements();
 
-    int intArray[2] = { schema_len, data_len };
+    if(dtype_id == DataType::EMPTY_ID || num_ele == 0)
+    {
+        return mpi_error;
+    }
 
+    index_t ele_bytes = node.dtype().element_bytes();
+    index_t stride    = node.dtype().stride();
 
-    int mpi_error = MPI_Send(intArray, 2, MPI_INT, dest, tag, comm);
+    MPI_Aint addr;
+    mpi_error = MPI_Get_address(const_cast<void*>(node.element_ptr(0)),
+                                &addr);
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    mpi_error = MPI_Send(const_cast <char*> (schema.c_str()), schema_len, MPI_CHAR, dest, tag, comm);
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
-    
-    mpi_error = MPI_Send((char*)&data[0], data_len, MPI_CHAR, dest, tag, comm);
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    num_bytes += num_ele * ele_bytes;
+
+    if(stride == ele_bytes || num_ele == 1)
+    {
+        int nbytes = (int)(num_ele * ele_bytes);
+        // extend the previous block if this leaf directly follows it
+        if(!types.empty() && 
+           types.back() == MPI_BYTE &&
+           displs.back() + lens.back() == addr)
+        {
+            lens.back() += nbytes;
+        }
+        else
+        {
+            lens.push_back(nbytes);
+            displs.push_back(addr);
+            types.push_back(MPI_BYTE);
+        }
+    }
+    else
+    {
+        MPI_Datatype leaf_dtype;
+        mpi_error = MPI_Type_create_hvector((int)num_ele,
+                                            (int)ele_bytes,
+                                            (MPI_Aint)stride,
+                                            MPI_BYTE,
+                                            &leaf_dtype);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        lens.push_back(1);
+        displs.push_back(addr);
+        types.push_back(leaf_dtype);
+    }
 
     return mpi_error;
 }
 
 //---------------------------------------------------------------------------//
-int
-recv(Node &node, int src, int tag, MPI_Comm comm)
-{  
-    int rcv_counts[2];
-    MPI_Status status;
+// Creates and commits an MPI derived datatype that describes the leaf
+// data of a node in place, see collect_mpi_blocks. num_bytes is set 
+// to the number of data bytes the datatype describes. 
+// The caller must free the datatype with MPI_Type_free.
+//---------------------------------------------------------------------------//
+static int
+create_mpi_datatype(const Node &node,
+                    MPI_Datatype &mpi_dtype,
+                    index_t &num_bytes)
+{
+    std::vector<int>          lens;
+    std::vector<MPI_Aint>     displs;
+    std::vector<MPI_Datatype> types;
+    num_bytes = 0;
 
-    int mpi_error = MPI_Recv(rcv_counts, 2, MPI_INT, src, tag, comm, &status);
+    int mpi_error = collect_mpi_blocks(node,lens,displs,types,num_bytes);
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    int schema_len = rcv_counts[0];
-    int data_len   = rcv_counts[1];
-
-    Node recv_buffers;
-    recv_buffers["schema"].set(DataType::c_char(schema_len+1));
-    recv_buffers["data"].set(DataType::c_char(data_len+1));
-
-    char *schema_ptr = recv_buffers["schema"].value();
-    char *data_ptr   = recv_buffers["data"].value();
-
-    mpi_error = MPI_Recv(schema_ptr, schema_len, MPI_CHAR, src, tag, comm, &status);
+    mpi_error = MPI_Type_create_struct((int)types.size(),
+                                       lens.empty()   ? NULL : &lens[0],
+                                       displs.empty() ? NULL : &displs[0],
+                                       types.empty()  ? NULL : &types[0],
+                                       &mpi_dtype);
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    mpi_error = MPI_Recv(data_ptr, data_len, MPI_CHAR, src, tag, comm, &status);
+    // the struct type holds its own references to the leaf types 
+    for(size_t i=0; i < types.size(); i++)
+    {
+        if(types[i] != MPI_BYTE)
+        {
+            MPI_Type_free(&types[i]);
+        }
+    }
+
+    mpi_error = MPI_Type_commit(&mpi_dtype);
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
-    
-    Generator node_gen(schema_ptr, "conduit_json", data_ptr);
-    /// gen copy 
-    node_gen.walk(node);
 
     return mpi_error;
 }
+
 //---------------------------------------------------------------------------//
-int 
-reduce(Node &send_node,
-       Node& recv_node,
-       MPI_Datatype mpi_datatype,
-       MPI_Op mpi_op,
-       int root,
-       MPI_Comm mpi_comm) 
+// Communicator-scoped schema cache
+//
+// Repeated exchanges usually use identical layouts. Both sides remember 
+// the hash of the last schema exchanged with each peer, so a schema is 
+// only sent when it changes and the receiver reuses its decoded copy.
+// 
+// Point to point state is keyed by (peer rank, tag): messages with the
+// same source, tag and communicator are non-overtaking, so the sender
+// and receiver always agree on what was last sent. Collectives are 
+// ordered on a communicator, so gatherv state is keyed by root 
+// (-1 for all_gatherv, -2 for all_to_allv), broadcast and scatter 
+// state by root and destination rank.
+//
+// The cache is attached to the communicator as an MPI attribute and is
+// deleted when the communicator is freed. Duplicated communicators start
+// with an empty cache.
+//---------------------------------------------------------------------------//
+class SchemaCache
 {
-    int rank;
-    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+public:
+    typedef std::pair<int,int> Key;
 
-    Schema schema_c;
-    send_node.schema().compact_to(schema_c);
-    std::string schema = schema_c.to_json();
+    struct Entry
+    {
+        Entry()
+        : hash(0),
+          schema(NULL)
+        {}
+
+        uint64  hash;
+        Schema *schema;
+    };
 
-    std::vector<uint8> data;
-    send_node.serialize(data);
-    int data_len = data.size();
+    ~SchemaCache()
+    {
+        clear(m_recv);
+        clear(m_gatherv_recv);
+        clear(m_gatherv_result);
+        clear(m_bcast);
+        clear(m_scatterv_recv);
+    }
 
-    int data_size = 0;
-    MPI_Type_size(mpi_datatype, &data_size);
+    // hash of the last schema sent to a (dest, tag) pair
+    std::map<Key,uint64>  m_send;
+    // last schema received from a (src, tag) pair
+    std::map<Key,Entry>   m_recv;
+    // hash of the last schema this rank contributed to a gatherv root
+    std::map<int,uint64>  m_gatherv_send;
+    // last schema a gatherv root received from a (root, rank) pair
+    std::map<Key,Entry>   m_gatherv_recv;
+    // last combined gatherv result schema for a root
+    std::map<int,Entry>   m_gatherv_result;
+    // last schema broadcast from a (root, kind) pair, on all ranks
+    std::map<Key,Entry>   m_bcast;
+    // hash of the last schema a scatterv root sent to a rank
+    std::map<int,uint64>  m_scatterv_send;
+    // last schema received from a scatterv root
+    std::map<int,Entry>   m_scatterv_recv;
+    // hash of the last schema this rank sent to a rank in all_to_allv
+    std::map<int,uint64>  m_all_to_allv_send;
+
+private:
+    template<typename K>
+    static void clear(std::map<K,Entry> &entries)
+    {
+        typename std::map<K,Entry>::iterator itr;
+        for(itr = entries.begin(); itr != entries.end(); ++itr)
+        {
+            delete itr->second.schema;
+        }
+        entries.clear();
+    }
+};
 
-    Node recv_buffer;
-    recv_buffer.set(DataType::c_char(data_len+1));
-    char *recv_ptr = recv_buffer.value();
+static int schema_cache_keyval = MPI_KEYVAL_INVALID;
+// user op used to reduce mixed type trees, see reduce_layout_op
+static MPI_Op reduce_layout_mpi_op = MPI_OP_NULL;
 
-    int mpi_error = MPI_Reduce(&data[0],
-                               recv_ptr,
-                               (data_len / data_size) + 1,
-                               mpi_datatype, mpi_op, root, mpi_comm);
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
-    
-    if (rank == root)
+//---------------------------------------------------------------------------//
+// MPI objects created on demand are freed when MPI is finalized: 
+// MPI_Finalize first deletes the attributes of MPI_COMM_SELF, which calls
+// this for the attribute set by register_finalize_cleanup.
+//---------------------------------------------------------------------------//
+static int finalize_keyval = MPI_KEYVAL_INVALID;
+
+//---------------------------------------------------------------------------//
+static int
+finalize_delete(MPI_Comm, // comm -- unused
+                int,      // keyval -- unused
+                void *,   // attr_val -- unused
+                void *)   // extra_state -- unused
+{
+    if(reduce_layout_mpi_op != MPI_OP_NULL)
     {
-        Generator node_gen(schema, "conduit_json", recv_ptr);
+        MPI_Op_free(&reduce_layout_mpi_op);
+    }
 
-        node_gen.walk(recv_node);
+    if(schema_cache_keyval != MPI_KEYVAL_INVALID)
+    {
+        MPI_Comm_free_keyval(&schema_cache_keyval);
     }
 
-    return mpi_error;
+    MPI_Comm_free_keyval(&finalize_keyval);
+    return MPI_SUCCESS;
 }
 
-//--------------------------------------------------------------------------//
-int
-all_reduce(Node &send_node,
-           Node &recv_node,
-           MPI_Datatype mpi_datatype,
-           MPI_Op mpi_op,
-           MPI_Comm mpi_comm)
+//---------------------------------------------------------------------------//
+static void
+register_finalize_cleanup()
 {
+    if(finalize_keyval != MPI_KEYVAL_INVALID)
+    {
+        return;
+    }
 
-    Schema schema_c;
-    send_node.schema().compact_to(schema_c);
-    std::string schema = schema_c.to_json();
-
+    MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN,
+                           finalize_delete,
+                           &finalize_keyval,
+                           NULL);
+    MPI_Comm_set_attr(MPI_COMM_SELF, finalize_keyval, NULL);
+}
 
-    std::vector<uint8> data;
-    send_node.serialize(data);
-    int data_len = data.size();
+//---------------------------------------------------------------------------//
+static int
+schema_cache_delete(MPI_Comm, // comm -- unused
+                    int,      // keyval -- unused
+                    void *attr_val,
+                    void *)   // extra_state -- unused
+{
+    delete (SchemaCache*)attr_val;
+    return MPI_SUCCESS;
+}
 
-    int data_size = 0;
-    MPI_Type_size(mpi_datatype, &data_size);
+//---------------------------------------------------------------------------//
+static SchemaCache *
+schema_cache(MPI_Comm comm)
+{
+    if(schema_cache_keyval == MPI_KEYVAL_INVALID)
+    {
+        register_finalize_cleanup();
+        MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN,
+                               schema_cache_delete,
+                               &schema_cache_keyval,
+                               NULL);
+    }
 
-    Node recv_buffer;
-    recv_buffer.set(DataType::c_char(data_len+1));
-    char *recv_ptr = recv_buffer.value();
+    void *attr_val = NULL;
+    int   found = 0;
+    MPI_Comm_get_attr(comm, schema_cache_keyval, &attr_val, &found);
+    if(found)
+    {
+        return (SchemaCache*)attr_val;
+    }
 
-    int mpi_error = MPI_Allreduce(&data[0],
-                                  recv_ptr,
-                                  (data_len / data_size) + 1,
-                                  mpi_datatype,
-                                  mpi_op,
-                                  mpi_comm);
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    SchemaCache *res = new SchemaCache();
+    MPI_Comm_set_attr(comm, schema_cache_keyval, res);
+    return res;
+}
 
-    Generator node_gen(schema, "conduit_json", recv_ptr);
+//---------------------------------------------------------------------------//
+// Schema encoding
+//
+// Schemas are sent using the binary encoding (see Schema::serialize) 
+// unless "conduit_json" is selected via set_schema_protocol. Receivers
+// accept either: JSON schemas start with '{' or '[' (after whitespace),
+// binary schemas start with their version byte.
+//---------------------------------------------------------------------------//
+static bool schema_protocol_json = false;
 
-    node_gen.walk(recv_node);
+//---------------------------------------------------------------------------//
+void
+set_schema_protocol(const std::string &protocol)
+{
+    if(protocol == "conduit_bin")
+    {
+        schema_protocol_json = false;
+    }
+    else if(protocol == "conduit_json")
+    {
+        schema_protocol_json = true;
+    }
+    else
+    {
+        CONDUIT_ERROR("<relay::mpi::set_schema_protocol> unknown schema "
+                      "protocol: \"" << protocol << "\". "
+                      "Expected \"conduit_bin\" or \"conduit_json\"");
+    }
+}
 
+//---------------------------------------------------------------------------//
+std::string
+schema_protocol()
+{
+    return schema_protocol_json ? "conduit_json" : "conduit_bin";
+}
 
-    return mpi_error;
+//---------------------------------------------------------------------------//
+static void
+encode_schema(const Schema &schema,
+              std::vector<uint8> &schema_data)
+{
+    if(schema_protocol_json)
+    {
+        std::string schema_json = schema.to_json();
+        schema_data.assign(schema_json.begin(),schema_json.end());
+    }
+    else
+    {
+        schema.serialize(schema_data);
+    }
 }
 
 //---------------------------------------------------------------------------//
-int
-isend(Node &node,
-      int dest,
-      int tag,
-      MPI_Comm mpi_comm,
-      ConduitMPIRequest* request) 
+static void
+decode_schema(const uint8 *data,
+              index_t nbytes,
+              Schema &schema)
 {
-    request->_externalData = new Node();
-    node.compact_to(*(request->_externalData));
+    index_t i = 0;
+    while(i < nbytes && (data[i] == ' '  || data[i] == '\n' || 
+                         data[i] == '\t' || data[i] == '\r'))
+    {
+        i++;
+    }
 
-    int mpi_error =  MPI_Isend((char*)request->_externalData->data_ptr(), 
-                               request->_externalData->total_bytes_compact(), 
-                               MPI_CHAR, 
-                               dest, 
-                               tag,
-                               mpi_comm,
-                               &(request->_request));
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
-    return mpi_error;
+    if(i < nbytes && (data[i] == '{' || data[i] == '['))
+    {
+        schema.set(std::string((const char*)data,(size_t)nbytes));
+    }
+    else
+    {
+        schema.deserialize(data,nbytes);
+    }
 }
 
 //---------------------------------------------------------------------------//
-int 
-irecv(Node &node,
-      int src,
-      int tag,
-      MPI_Comm mpi_comm,
-      ConduitMPIRequest *request) 
+// decodes a schema into a cache entry
+//---------------------------------------------------------------------------//
+static Schema *
+cache_schema(SchemaCache::Entry &entry,
+             uint64 hash,
+             const uint8 *data,
+             index_t nbytes)
 {
-    request->_externalData = new Node();
-    node.compact_to(*(request->_externalData));
+    if(entry.schema == NULL)
+    {
+        entry.schema = new Schema();
+    }
+    decode_schema(data,nbytes,*entry.schema);
+    entry.hash = hash;
+    return entry.schema;
+}
 
-    request->_recvData = &node;
+//---------------------------------------------------------------------------//
+// fetches a schema the peer expects us to have cached
+//---------------------------------------------------------------------------//
+static Schema *
+cached_schema(SchemaCache::Entry &entry,
+              uint64 hash,
+              int peer)
+{
+    if(entry.schema == NULL || entry.hash != hash)
+    {
+        CONDUIT_ERROR("<relay::mpi> schema cache miss for rank " << peer
+                      << ". Peers must exchange nodes using the relay::mpi "
+                      "methods on the same communicator.");
+    }
+    return entry.schema;
+}
 
-    int mpi_error =  MPI_Irecv((char*)request->_externalData->data_ptr(),
-                               request->_externalData->total_bytes_compact(),
-                               MPI_CHAR,
-                               src,
-                               tag,
-                               mpi_comm,
-                               &(request->_request));
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
-    return mpi_error;
+//---------------------------------------------------------------------------//
+// encoding of the compact form of a schema, returns its hash
+//---------------------------------------------------------------------------//
+static uint64
+compact_schema_data(const Schema &schema,
+                    std::vector<uint8> &schema_data)
+{
+    Schema schema_c;
+    schema.compact_to(schema_c);
+    encode_schema(schema_c,schema_data);
+    return utils::hash_bytes(&schema_data[0],(index_t)schema_data.size());
 }
 
 //---------------------------------------------------------------------------//
-int
-wait_send(ConduitMPIRequest* request,
-          MPI_Status *status) 
+// true if both schemas describe the same leaves in the same order,
+// so data can be moved between them without rebuilding the tree.
+// check_offsets also requires identical offsets and strides.
+//---------------------------------------------------------------------------//
+static bool
+same_layout(const Schema &s,
+            const Schema &ref,
+            bool check_offsets)
 {
-    int mpi_error = MPI_Wait(&(request->_request), status);
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
-        
-    delete request->_externalData;
-    request->_externalData = 0;
+    const DataType &dt     = s.dtype();
+    const DataType &ref_dt = ref.dtype();
+    index_t dt_id = dt.id();
 
-    return mpi_error;
+    if(dt_id != ref_dt.id())
+    {
+        return false;
+    }
+
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = s.number_of_children();
+        if(nchildren != ref.number_of_children())
+        {
+            return false;
+        }
+
+        if(dt_id == DataType::OBJECT_ID &&
+           s.child_names() != ref.child_names())
+        {
+            return false;
+        }
+
+        for(index_t i=0; i < nchildren; i++)
+        {
+            if(!same_layout(s.child(i),ref.child(i),check_offsets))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if(dt.number_of_elements() != ref_dt.number_of_elements() ||
+       dt.element_bytes() != ref_dt.element_bytes() ||
+       dt.endianness() != ref_dt.endianness())
+    {
+        return false;
+    }
+
+    return !check_offsets ||
+           (dt.offset() == ref_dt.offset() && 
+            dt.stride() == ref_dt.stride());
 }
 
 //---------------------------------------------------------------------------//
-int
-wait_recv(ConduitMPIRequest* request,
-          MPI_Status *status) 
-{
-    int mpi_error = MPI_Wait(&(request->_request), status);
+int 
+send(Node &node, int dest, int tag, MPI_Comm comm)
+{ 
+    std::vector<uint8> schema;
+    uint64 schema_hash = compact_schema_data(node.schema(),schema);
+    int schema_len = (int)schema.size();
+
+    // skip the schema if it is the last one we sent to this peer
+    SchemaCache *cache = schema_cache(comm);
+    SchemaCache::Key key(dest,tag);
+    std::map<SchemaCache::Key,uint64>::iterator itr = cache->m_send.find(key);
+    if(itr != cache->m_send.end() && itr->second == schema_hash)
+    {
+        schema_len = 0;
+    }
+
+    // the data is sent directly from the node's memory using 
+    // a derived datatype, see create_mpi_datatype
+    MPI_Datatype data_dtype;
+    index_t data_bytes = 0;
+    int mpi_error = create_mpi_datatype(node,data_dtype,data_bytes);
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
-    
-    request->_recvData->update(*(request->_externalData));
 
-    delete request->_externalData;
-    request->_externalData = 0;
+    uint64 header[3] = { (uint64)schema_len,
+                         (uint64)data_bytes,
+                         schema_hash };
 
-    request->_recvData = 0;
+    mpi_error = MPI_Send(header, 3, MPI_UINT64_T, dest, tag, comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(schema_len > 0)
+    {
+        mpi_error = MPI_Send((char*)&schema[0], schema_len, MPI_CHAR, dest, tag, comm);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        cache->m_send[key] = schema_hash;
+    }
     
+    mpi_error = MPI_Send(MPI_BOTTOM, 1, data_dtype, dest, tag, comm);
+    MPI_Type_free(&data_dtype);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
     return mpi_error;
 }
 
 //---------------------------------------------------------------------------//
 int
-wait_all_send(int count,
-              ConduitMPIRequest requests[],
-              MPI_Status statuses[]) 
-{
-     MPI_Request *justrequests = new MPI_Request[count];
-     
-     for (int i = 0; i < count; ++i) 
-     {
-         justrequests[i] = requests[i]._request;
-     }
-     
-     int mpi_error = MPI_Waitall(count, justrequests, statuses);
-     CONDUIT_CHECK_MPI_ERROR(mpi_error);
+recv(Node &node, int src, int tag, MPI_Comm comm)
+{  
+    uint64 header[3];
+    MPI_Status status;
 
-     for (int i = 0; i < count; ++i)
-     {
-         requests[i]._request = justrequests[i];
-         delete requests[i]._externalData;
-         requests[i]._externalData = 0;
-     }
+    int mpi_error = MPI_Recv(header, 3, MPI_UINT64_T, src, tag, comm, &status);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-     delete [] justrequests;
+    // use the matched source and tag for the rest of the exchange,
+    // in case wildcards were passed
+    src = status.MPI_SOURCE;
+    tag = status.MPI_TAG;
 
-     return mpi_error; 
+    int    schema_len  = (int)header[0];
+    int    data_len    = (int)header[1];
+    uint64 schema_hash = header[2];
 
+    SchemaCache *cache = schema_cache(comm);
+    SchemaCache::Entry &entry = cache->m_recv[SchemaCache::Key(src,tag)];
+    Schema *rcv_schema = NULL;
 
-}
+    if(schema_len > 0)
+    {
+        std::vector<uint8> schema_buff((size_t)schema_len);
 
-//---------------------------------------------------------------------------//
-int
+        mpi_error = MPI_Recv((char*)&schema_buff[0], schema_len, MPI_CHAR, src, tag, comm, &status);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+        rcv_schema = cache_schema(entry,
+                                  schema_hash,
+                                  &schema_buff[0],
+                                  schema_len);
+    }
+    else
+    {
+        rcv_schema = cached_schema(entry,schema_hash,src);
+    }
+
+    // if the node already has this layout (typically from the last 
+    // recv), receive into it without rebuilding the tree
+    if(same_layout(node.schema(),*rcv_schema,false))
+    {
+        return recv_data(node,src,tag,comm);
+    }
+
+    // the sender's schema is compact, so we can receive the data
+    // directly into the node's buffer.
+    node.set(*rcv_schema);
+
+    mpi_error = MPI_Recv(node.data_ptr(), data_len, MPI_BYTE, src, tag, comm, &status);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int 
+send_data(const Node &node, int dest, int tag, MPI_Comm comm)
+{
+    MPI_Datatype data_dtype;
+    index_t data_bytes = 0;
+    int mpi_error = create_mpi_datatype(node,data_dtype,data_bytes);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    mpi_error = MPI_Send(MPI_BOTTOM, 1, data_dtype, dest, tag, comm);
+    MPI_Type_free(&data_dtype);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int 
+recv_data(Node &node, int src, int tag, MPI_Comm comm)
+{
+    MPI_Datatype data_dtype;
+    index_t data_bytes = 0;
+    int mpi_error = create_mpi_datatype(node,data_dtype,data_bytes);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    MPI_Status status;
+    mpi_error = MPI_Recv(MPI_BOTTOM, 1, data_dtype, src, tag, comm, &status);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    int rcv_bytes = 0;
+    mpi_error = MPI_Get_elements(&status, data_dtype, &rcv_bytes);
+    MPI_Type_free(&data_dtype);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(rcv_bytes != (int)data_bytes)
+    {
+        CONDUIT_ERROR("<relay::mpi::recv_data> received " << rcv_bytes
+                      << " bytes, but the passed node describes " 
+                      << data_bytes << " bytes. The sender and receiver "
+                      "nodes must have compatible schemas.");
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// Leaf aware reduce support
+//
+// Reductions use the predefined MPI datatype that matches each leaf's
+// dtype. Both the send and recv data use the compact layout of the send 
+// schema, so a displacement describes the same leaf in both buffers.
+//
+// Compact nodes with a single leaf type are one block of elements and 
+// are reduced with the requested op directly. Predefined ops only apply
+// to basic datatypes, so mixed trees are reduced with a single call 
+// using a struct datatype and a user defined op, which applies the 
+// requested predefined op to each block. The user op doesn't call MPI, 
+// it finds the blocks through active_reduce_layout, which is set around
+// the collective call. Mixed trees reduced with ops that aren't 
+// predefined use one collective call per block.
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// a run of adjacent leaves with the same dtype
+//---------------------------------------------------------------------------//
+struct ReduceBlock
+{
+    MPI_Aint      displ;
+    int           count;
+    index_t       dtype_id;
+    index_t       ele_bytes;
+    MPI_Datatype  mpi_dtype;
+};
+
+//---------------------------------------------------------------------------//
+// predefined ops applied by reduce_layout_op
+//---------------------------------------------------------------------------//
+enum ReduceOpId
+{
+    REDUCE_OP_SUM,
+    REDUCE_OP_PROD,
+    REDUCE_OP_MIN,
+    REDUCE_OP_MAX,
+    REDUCE_OP_LAND,
+    REDUCE_OP_LOR,
+    REDUCE_OP_LXOR,
+    // bitwise ops, only for integer leaves
+    REDUCE_OP_BAND,
+    REDUCE_OP_BOR,
+    REDUCE_OP_BXOR,
+    REDUCE_OP_UNSUPPORTED
+};
+
+//---------------------------------------------------------------------------//
+// blocks, their extent, and the requested op of a mixed type reduce
+//---------------------------------------------------------------------------//
+struct ReduceLayout
+{
+    std::vector<ReduceBlock>  blocks;
+    MPI_Aint                  extent;
+    int                       op_id;
+};
+
+// layout of the mixed type reduce in progress, see reduce_leaves
+static const ReduceLayout *active_reduce_layout = NULL;
+
+//---------------------------------------------------------------------------//
+static int
+reduce_op_id(MPI_Op mpi_op)
+{
+    if(mpi_op == MPI_SUM)  return REDUCE_OP_SUM;
+    if(mpi_op == MPI_PROD) return REDUCE_OP_PROD;
+    if(mpi_op == MPI_MIN)  return REDUCE_OP_MIN;
+    if(mpi_op == MPI_MAX)  return REDUCE_OP_MAX;
+    if(mpi_op == MPI_LAND) return REDUCE_OP_LAND;
+    if(mpi_op == MPI_LOR)  return REDUCE_OP_LOR;
+    if(mpi_op == MPI_LXOR) return REDUCE_OP_LXOR;
+    if(mpi_op == MPI_BAND) return REDUCE_OP_BAND;
+    if(mpi_op == MPI_BOR)  return REDUCE_OP_BOR;
+    if(mpi_op == MPI_BXOR) return REDUCE_OP_BXOR;
+    return REDUCE_OP_UNSUPPORTED;
+}
+
+//---------------------------------------------------------------------------//
+// combines in_val into inout_val, in the same way as the predefined op
+//---------------------------------------------------------------------------//
+template<typename T>
+static T
+reduce_value(T in_val,
+             T inout_val,
+             int op_id)
+{
+    switch(op_id)
+    {
+        case REDUCE_OP_SUM:  return in_val + inout_val;
+        case REDUCE_OP_PROD: return in_val * inout_val;
+        case REDUCE_OP_MIN:  return in_val < inout_val ? in_val : inout_val;
+        case REDUCE_OP_MAX:  return in_val > inout_val ? in_val : inout_val;
+        case REDUCE_OP_LAND: return (T)(in_val != 0 && inout_val != 0);
+        case REDUCE_OP_LOR:  return (T)(in_val != 0 || inout_val != 0);
+        case REDUCE_OP_LXOR: return (T)((in_val != 0) != (inout_val != 0));
+    }
+    return inout_val;
+}
+
+//---------------------------------------------------------------------------//
+template<typename T>
+static T
+reduce_int_value(T in_val,
+                 T inout_val,
+                 int op_id)
+{
+    switch(op_id)
+    {
+        case REDUCE_OP_BAND: return in_val & inout_val;
+        case REDUCE_OP_BOR:  return in_val | inout_val;
+        case REDUCE_OP_BXOR: return in_val ^ inout_val;
+    }
+    return reduce_value(in_val,inout_val,op_id);
+}
+
+//---------------------------------------------------------------------------//
+// the blocks of a compact layout may be unaligned, values are copied
+//---------------------------------------------------------------------------//
+template<typename T>
+static void
+reduce_block_values(const uint8 *in_ptr,
+                    uint8 *inout_ptr,
+                    int count,
+                    int op_id,
+                    bool is_int)
+{
+    for(int i=0; i < count; i++)
+    {
+        T in_val;
+        T inout_val;
+        memcpy(&in_val,in_ptr + i * sizeof(T),sizeof(T));
+        memcpy(&inout_val,inout_ptr + i * sizeof(T),sizeof(T));
+        inout_val = is_int ? reduce_int_value(in_val,inout_val,op_id) :
+                             reduce_value(in_val,inout_val,op_id);
+        memcpy(inout_ptr + i * sizeof(T),&inout_val,sizeof(T));
+    }
+}
+
+//---------------------------------------------------------------------------//
+// float types don't support the bitwise ops 
+//---------------------------------------------------------------------------//
+template<typename T>
+static void
+reduce_float_block_values(const uint8 *in_ptr,
+                          uint8 *inout_ptr,
+                          int count,
+                          int op_id)
+{
+    for(int i=0; i < count; i++)
+    {
+        T in_val;
+        T inout_val;
+        memcpy(&in_val,in_ptr + i * sizeof(T),sizeof(T));
+        memcpy(&inout_val,inout_ptr + i * sizeof(T),sizeof(T));
+        inout_val = reduce_value(in_val,inout_val,op_id);
+        memcpy(inout_ptr + i * sizeof(T),&inout_val,sizeof(T));
+    }
+}
+
+//---------------------------------------------------------------------------//
+static void
+reduce_block(const ReduceBlock &block,
+             const uint8 *in_ptr,
+             uint8 *inout_ptr,
+             int op_id)
+{
+    in_ptr    += block.displ;
+    inout_ptr += block.displ;
+    int count  = block.count;
+
+    switch(block.dtype_id)
+    {
+        case DataType::INT8_ID:
+            reduce_block_values<int8>(in_ptr,inout_ptr,count,op_id,true);
+            break;
+        case DataType::INT16_ID:
+            reduce_block_values<int16>(in_ptr,inout_ptr,count,op_id,true);
+            break;
+        case DataType::INT32_ID:
+            reduce_block_values<int32>(in_ptr,inout_ptr,count,op_id,true);
+            break;
+        case DataType::INT64_ID:
+            reduce_block_values<int64>(in_ptr,inout_ptr,count,op_id,true);
+            break;
+        case DataType::UINT8_ID:
+            reduce_block_values<uint8>(in_ptr,inout_ptr,count,op_id,true);
+            break;
+        case DataType::UINT16_ID:
+            reduce_block_values<uint16>(in_ptr,inout_ptr,count,op_id,true);
+            break;
+        case DataType::UINT32_ID:
+            reduce_block_values<uint32>(in_ptr,inout_ptr,count,op_id,true);
+            break;
+        case DataType::UINT64_ID:
+            reduce_block_values<uint64>(in_ptr,inout_ptr,count,op_id,true);
+            break;
+        case DataType::FLOAT32_ID:
+            reduce_float_block_values<float32>(in_ptr,inout_ptr,count,op_id);
+            break;
+        case DataType::FLOAT64_ID:
+            reduce_float_block_values<float64>(in_ptr,inout_ptr,count,op_id);
+            break;
+        default:
+            break;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// user op for mixed type reduce datatypes
+//---------------------------------------------------------------------------//
+static void
+reduce_layout_op(void *in_vec,
+                 void *inout_vec,
+                 int *len,
+                 MPI_Datatype *) // dtype -- unused, see active_reduce_layout
+{
+    const ReduceLayout *layout = active_reduce_layout;
+    // only used while reduce_leaves has a layout active
+    if(layout == NULL)
+    {
+        return;
+    }
+
+    const uint8 *in_ptr = (const uint8*)in_vec;
+    uint8 *inout_ptr    = (uint8*)inout_vec;
+
+    for(int i=0; i < *len; i++)
+    {
+        for(size_t b=0; b < layout->blocks.size(); b++)
+        {
+            reduce_block(layout->blocks[b],in_ptr,inout_ptr,layout->op_id);
+        }
+        in_ptr    += layout->extent;
+        inout_ptr += layout->extent;
+    }
+}
+
+//---------------------------------------------------------------------------//
+static MPI_Datatype
+reduce_mpi_datatype(const DataType &dt)
+{
+    switch(dt.id())
+    {
+        case DataType::INT8_ID:    return MPI_INT8_T;
+        case DataType::INT16_ID:   return MPI_INT16_T;
+        case DataType::INT32_ID:   return MPI_INT32_T;
+        case DataType::INT64_ID:   return MPI_INT64_T;
+        case DataType::UINT8_ID:   return MPI_UINT8_T;
+        case DataType::UINT16_ID:  return MPI_UINT16_T;
+        case DataType::UINT32_ID:  return MPI_UINT32_T;
+        case DataType::UINT64_ID:  return MPI_UINT64_T;
+        case DataType::FLOAT32_ID: return MPI_FLOAT;
+        case DataType::FLOAT64_ID: return MPI_DOUBLE;
+        default:
+        {
+            CONDUIT_ERROR("<relay::mpi::reduce> only numeric leaves can be"
+                          " reduced, unsupported leaf type: " 
+                          << dt.name());
+        }
+    }
+    return MPI_DATATYPE_NULL;
+}
+
+//---------------------------------------------------------------------------//
+// collects the leaves of a compact schema in order, adjacent leaves of
+// the same type are coalesced into one block
+//---------------------------------------------------------------------------//
+static void
+collect_reduce_blocks(const Schema &schema,
+                      std::vector<ReduceBlock> &blocks)
+{
+    const DataType &dt = schema.dtype();
+    index_t dt_id = dt.id();
+
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        for(index_t i=0; i < schema.number_of_children(); i++)
+        {
+            collect_reduce_blocks(schema.child(i),blocks);
+        }
+        return;
+    }
+
+    if(dt_id == DataType::EMPTY_ID || dt.number_of_elements() == 0)
+    {
+        return;
+    }
+
+    // throws for non numeric leaves
+    MPI_Datatype mpi_dtype = reduce_mpi_datatype(dt);
+
+    if(!dt.endianness_matches_machine())
+    {
+        CONDUIT_ERROR("<relay::mpi::reduce> leaves must use the machine's"
+                      " endianness");
+    }
+
+    int      count = (int)dt.number_of_elements();
+    MPI_Aint displ = (MPI_Aint)dt.offset();
+
+    if(!blocks.empty() &&
+       blocks.back().mpi_dtype == mpi_dtype &&
+       blocks.back().displ + 
+         blocks.back().count * blocks.back().ele_bytes == displ)
+    {
+        blocks.back().count += count;
+    }
+    else
+    {
+        ReduceBlock block;
+        block.displ     = displ;
+        block.count     = count;
+        block.dtype_id  = dt_id;
+        block.ele_bytes = dt.element_bytes();
+        block.mpi_dtype = mpi_dtype;
+        blocks.push_back(block);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// true if reduce_layout_op can apply mpi_op to all of the blocks
+//---------------------------------------------------------------------------//
+static bool
+reduce_layout_supported(const std::vector<ReduceBlock> &blocks,
+                        int op_id)
+{
+    if(op_id == REDUCE_OP_UNSUPPORTED)
+    {
+        return false;
+    }
+
+    if(op_id >= REDUCE_OP_BAND)
+    {
+        for(size_t i=0; i < blocks.size(); i++)
+        {
+            if(blocks[i].dtype_id == DataType::FLOAT32_ID ||
+               blocks[i].dtype_id == DataType::FLOAT64_ID)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// creates the struct datatype used to reduce mixed type blocks, and fills
+// the layout used by reduce_layout_op. The caller must free the datatype
+// with MPI_Type_free.
+//---------------------------------------------------------------------------//
+static int
+create_reduce_layout_datatype(const std::vector<ReduceBlock> &blocks,
+                              int op_id,
+                              MPI_Datatype &layout_dtype,
+                              ReduceLayout &layout)
+{
+    int mpi_error = MPI_SUCCESS;
+
+    if(reduce_layout_mpi_op == MPI_OP_NULL)
+    {
+        register_finalize_cleanup();
+        // all of the supported predefined ops are commutative
+        mpi_error = MPI_Op_create(reduce_layout_op,1,&reduce_layout_mpi_op);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    std::vector<int>          lens;
+    std::vector<MPI_Aint>     displs;
+    std::vector<MPI_Datatype> types;
+    for(size_t i=0; i < blocks.size(); i++)
+    {
+        lens.push_back(blocks[i].count);
+        displs.push_back(blocks[i].displ - blocks[0].displ);
+        types.push_back(blocks[i].mpi_dtype);
+    }
+
+    mpi_error = MPI_Type_create_struct((int)blocks.size(),
+                                       &lens[0],
+                                       &displs[0],
+                                       &types[0],
+                                       &layout_dtype);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    mpi_error = MPI_Type_commit(&layout_dtype);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    MPI_Aint lb = 0;
+    mpi_error = MPI_Type_get_extent(layout_dtype,&lb,&layout.extent);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    layout.blocks = blocks;
+    layout.op_id  = op_id;
+    for(size_t i=0; i < layout.blocks.size(); i++)
+    {
+        layout.blocks[i].displ -= blocks[0].displ;
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// returns the address of the first byte of leaf data, or NULL if the
+// node has no leaf data
+//---------------------------------------------------------------------------//
+static void *
+first_leaf_ptr(Node &node)
+{
+    index_t dt_id = node.dtype().id();
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        for(index_t i=0; i < node.number_of_children(); i++)
+        {
+            void *res = first_leaf_ptr(node.child(i));
+            if(res != NULL)
+            {
+                return res;
+            }
+        }
+        return NULL;
+    }
+
+    if(dt_id == DataType::EMPTY_ID || 
+       node.dtype().number_of_elements() == 0)
+    {
+        return NULL;
+    }
+
+    return node.element_ptr(0);
+}
+
+//---------------------------------------------------------------------------//
+// true if the node's data already uses the compact layout of schema,
+// in which case it can be passed to MPI directly
+//---------------------------------------------------------------------------//
+static bool
+has_compact_layout(const Node &node,
+                   const Schema &schema)
+{
+    return same_layout(node.schema(),schema,false) &&
+           node.is_compact() &&
+           node.is_contiguous();
+}
+
+//---------------------------------------------------------------------------//
+// MPI_Reduce (root >= 0) or MPI_Allreduce (root == -1)
+//---------------------------------------------------------------------------//
+static int
+reduce_collective(void *snd_ptr,
+                  void *rcv_ptr,
+                  int count,
+                  MPI_Datatype dtype,
+                  MPI_Op op,
+                  int root,
+                  MPI_Comm mpi_comm)
+{
+    if(root == -1)
+    {
+        return MPI_Allreduce(snd_ptr,
+                             rcv_ptr,
+                             count,
+                             dtype,
+                             op,
+                             mpi_comm);
+    }
+
+    return MPI_Reduce(snd_ptr,
+                      rcv_ptr,
+                      count,
+                      dtype,
+                      op,
+                      root,
+                      mpi_comm);
+}
+
+//---------------------------------------------------------------------------//
+// sets up the send and recv buffers for a reduce of send_node, using the
+// compact layout of its schema. snd_ptr is MPI_IN_PLACE when reducing a
+// node into itself, rcv_ptr is NULL on ranks that don't receive.
+//---------------------------------------------------------------------------//
+static void
+reduce_buffers(Node &send_node,
+               Node &recv_node,
+               const Schema &schema_c,
+               bool recv_here,
+               Node &n_snd_compact,
+               void *&snd_ptr,
+               void *&rcv_ptr)
+{
+    // compact nodes are reduced in place, others are staged 
+    if(has_compact_layout(send_node,schema_c))
+    {
+        snd_ptr = first_leaf_ptr(send_node);
+    }
+    else
+    {
+        send_node.compact_to(n_snd_compact);
+        snd_ptr = first_leaf_ptr(n_snd_compact);
+    }
+
+    rcv_ptr = NULL;
+    if(recv_here)
+    {
+        if(!has_compact_layout(recv_node,schema_c))
+        {
+            recv_node.set(schema_c);
+        }
+        rcv_ptr = first_leaf_ptr(recv_node);
+    }
+
+    // reducing a node into itself
+    if(snd_ptr != NULL && snd_ptr == rcv_ptr)
+    {
+        snd_ptr = MPI_IN_PLACE;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// reduce (root >= 0) or all_reduce (root == -1)
+//---------------------------------------------------------------------------//
+static int
+reduce_leaves(Node &send_node,
+              Node &recv_node,
+              MPI_Op mpi_op,
+              int root,
+              MPI_Comm mpi_comm)
+{
+    bool recv_here = (root == -1 || root == mpi::rank(mpi_comm));
+
+    Schema schema_c;
+    send_node.schema().compact_to(schema_c);
+
+    std::vector<ReduceBlock> blocks;
+    collect_reduce_blocks(schema_c,blocks);
+
+    Node n_snd_compact;
+    void *snd_ptr = NULL;
+    void *rcv_ptr = NULL;
+    reduce_buffers(send_node,recv_node,schema_c,recv_here,
+                   n_snd_compact,snd_ptr,rcv_ptr);
+
+    // nothing to reduce
+    if(blocks.empty())
+    {
+        return MPI_SUCCESS;
+    }
+
+    int mpi_error = MPI_SUCCESS;
+
+    if(blocks.size() == 1)
+    {
+        mpi_error = reduce_collective(snd_ptr,
+                                      rcv_ptr,
+                                      blocks[0].count,
+                                      blocks[0].mpi_dtype,
+                                      mpi_op,
+                                      root,
+                                      mpi_comm);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        return mpi_error;
+    }
+
+    int op_id = reduce_op_id(mpi_op);
+    if(reduce_layout_supported(blocks,op_id))
+    {
+        MPI_Datatype dtype;
+        ReduceLayout layout;
+        mpi_error = create_reduce_layout_datatype(blocks,op_id,dtype,layout);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+        // note: the layout is process wide, like the MPI op itself
+        active_reduce_layout = &layout;
+        mpi_error = reduce_collective(snd_ptr,
+                                      rcv_ptr,
+                                      1,
+                                      dtype,
+                                      reduce_layout_mpi_op,
+                                      root,
+                                      mpi_comm);
+        active_reduce_layout = NULL;
+
+        MPI_Type_free(&dtype);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        return mpi_error;
+    }
+
+    // ops we can't apply ourselves reduce one block at a time
+    for(size_t i=0; i < blocks.size(); i++)
+    {
+        const ReduceBlock &block = blocks[i];
+        MPI_Aint offset = block.displ - blocks[0].displ;
+        void *blk_snd_ptr = snd_ptr;
+        void *blk_rcv_ptr = rcv_ptr;
+        if(snd_ptr != MPI_IN_PLACE)
+        {
+            blk_snd_ptr = ((uint8*)snd_ptr) + offset;
+        }
+        if(rcv_ptr != NULL)
+        {
+            blk_rcv_ptr = ((uint8*)rcv_ptr) + offset;
+        }
+
+        mpi_error = reduce_collective(blk_snd_ptr,
+                                      blk_rcv_ptr,
+                                      block.count,
+                                      block.mpi_dtype,
+                                      mpi_op,
+                                      root,
+                                      mpi_comm);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// reduces the compact data of send_node as an array of mpi_datatype 
+// elements, for the overloads that take an MPI datatype
+//---------------------------------------------------------------------------//
+static int
+reduce_as_datatype(Node &send_node,
+                   Node &recv_node,
+                   MPI_Datatype mpi_datatype,
+                   MPI_Op mpi_op,
+                   int root,
+                   MPI_Comm mpi_comm)
+{
+    bool recv_here = (root == -1 || root == mpi::rank(mpi_comm));
+
+    Schema schema_c;
+    send_node.schema().compact_to(schema_c);
+
+    int type_size = 0;
+    int mpi_error = MPI_Type_size(mpi_datatype,&type_size);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    index_t data_bytes = schema_c.total_bytes_compact();
+    if(type_size <= 0 || data_bytes % type_size != 0)
+    {
+        CONDUIT_ERROR("<relay::mpi::reduce> the node's data ("
+                      << data_bytes << " bytes) is not a whole number of"
+                      " elements of the passed MPI datatype ("
+                      << type_size << " bytes)");
+    }
+
+    Node n_snd_compact;
+    void *snd_ptr = NULL;
+    void *rcv_ptr = NULL;
+    reduce_buffers(send_node,recv_node,schema_c,recv_here,
+                   n_snd_compact,snd_ptr,rcv_ptr);
+
+    if(data_bytes == 0)
+    {
+        return MPI_SUCCESS;
+    }
+
+    mpi_error = reduce_collective(snd_ptr,
+                                  rcv_ptr,
+                                  (int)(data_bytes / type_size),
+                                  mpi_datatype,
+                                  mpi_op,
+                                  root,
+                                  mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int 
+reduce(Node &send_node,
+       Node &recv_node,
+       MPI_Op mpi_op,
+       int root,
+       MPI_Comm mpi_comm) 
+{
+    return reduce_leaves(send_node,recv_node,mpi_op,root,mpi_comm);
+}
+
+//---------------------------------------------------------------------------//
+int
+all_reduce(Node &send_node,
+           Node &recv_node,
+           MPI_Op mpi_op,
+           MPI_Comm mpi_comm)
+{
+    return reduce_leaves(send_node,recv_node,mpi_op,-1,mpi_comm);
+}
+
+//---------------------------------------------------------------------------//
+int 
+reduce(Node &send_node,
+       Node &recv_node,
+       MPI_Datatype mpi_datatype,
+       MPI_Op mpi_op,
+       int root,
+       MPI_Comm mpi_comm) 
+{
+    return reduce_as_datatype(send_node,
+                              recv_node,
+                              mpi_datatype,
+                              mpi_op,
+                              root,
+                              mpi_comm);
+}
+
+//---------------------------------------------------------------------------//
+int
+all_reduce(Node &send_node,
+           Node &recv_node,
+           MPI_Datatype mpi_datatype,
+           MPI_Op mpi_op,
+           MPI_Comm mpi_comm)
+{
+    return reduce_as_datatype(send_node,
+                              recv_node,
+                              mpi_datatype,
+                              mpi_op,
+                              -1,
+                              mpi_comm);
+}
+
+//---------------------------------------------------------------------------//
+int
+isend(Node &node,
+      int dest,
+      int tag,
+      MPI_Comm mpi_comm,
+      ConduitMPIRequest* request) 
+{
+    request->_externalData = new Node();
+    node.compact_to(*(request->_externalData));
+
+    int mpi_error =  MPI_Isend((char*)request->_externalData->data_ptr(), 
+                               request->_externalData->total_bytes_compact(), 
+                               MPI_CHAR, 
+                               dest, 
+                               tag,
+                               mpi_comm,
+                               &(request->_request));
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int 
+irecv(Node &node,
+      int src,
+      int tag,
+      MPI_Comm mpi_comm,
+      ConduitMPIRequest *request) 
+{
+    request->_externalData = new Node();
+    node.compact_to(*(request->_externalData));
+
+    request->_recvData = &node;
+
+    int mpi_error =  MPI_Irecv((char*)request->_externalData->data_ptr(),
+                               request->_externalData->total_bytes_compact(),
+                               MPI_CHAR,
+                               src,
+                               tag,
+                               mpi_comm,
+                               &(request->_request));
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+wait_send(ConduitMPIRequest* request,
+          MPI_Status *status) 
+{
+    int mpi_error = MPI_Wait(&(request->_request), status);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        
+    delete request->_externalData;
+    request->_externalData = 0;
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+wait_recv(ConduitMPIRequest* request,
+          MPI_Status *status) 
+{
+    int mpi_error = MPI_Wait(&(request->_request), status);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    
+    request->_recvData->update(*(request->_externalData));
+
+    delete request->_externalData;
+    request->_externalData = 0;
+
+    request->_recvData = 0;
+    
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+wait_all_send(int count,
+              ConduitMPIRequest requests[],
+              MPI_Status statuses[]) 
+{
+     MPI_Request *justrequests = new MPI_Request[count];
+     
+     for (int i = 0; i < count; ++i) 
+     {
+         justrequests[i] = requests[i]._request;
+     }
+     
+     int mpi_error = MPI_Waitall(count, justrequests, statuses);
+     CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+     for (int i = 0; i < count; ++i)
+     {
+         requests[i]._request = justrequests[i];
+         delete requests[i]._externalData;
+         requests[i]._externalData = 0;
+     }
+
+     delete [] justrequests;
+
+     return mpi_error; 
+
+
+}
+
+//---------------------------------------------------------------------------//
+int
 wait_all_recv(int count,
               ConduitMPIRequest requests[],
               MPI_Status statuses[])
 {
-     MPI_Request *justrequests = new MPI_Request[count];
-     
-     for (int i = 0; i < count; ++i)
-     {
-         justrequests[i] = requests[i]._request;
-     }
-     
-     int mpi_error = MPI_Waitall(count, justrequests, statuses);
-     CONDUIT_CHECK_MPI_ERROR(mpi_error);
+     MPI_Request *justrequests = new MPI_Request[count];
+     
+     for (int i = 0; i < count; ++i)
+     {
+         justrequests[i] = requests[i]._request;
+     }
+     
+     int mpi_error = MPI_Waitall(count, justrequests, statuses);
+     CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+     for (int i = 0; i < count; ++i)
+     {
+         requests[i]._recvData->update(*(requests[i]._externalData));
+
+         requests[i]._request = justrequests[i];
+         delete requests[i]._externalData;
+         requests[i]._externalData = 0;
+     }
+
+     delete [] justrequests;
+
+     return mpi_error; 
+
+}
+
+//---------------------------------------------------------------------------//
+int
+gather(Node &send_node,
+       Node &recv_node,
+       int root,
+       MPI_Comm mpi_comm)
+{
+    Node n_snd_compact;
+    send_node.compact_to(n_snd_compact);
+    int data_len = n_snd_compact.total_bytes_compact();
+
+    int m_size = mpi::size(mpi_comm);
+    int m_rank = mpi::rank(mpi_comm);
+
+    if(m_rank == root)
+    {
+        recv_node.list_of(n_snd_compact.schema(),
+                          m_size);
+    }
+
+    int mpi_error = MPI_Gather( n_snd_compact.data_ptr(), // local data
+                                data_len, // local data len
+                                MPI_CHAR, // send chars
+                                recv_node.data_ptr(),  // rcv buffer
+                                data_len, // data len 
+                                MPI_CHAR,  // rcv chars
+                                root,
+                                mpi_comm); // mpi com
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+all_gather(Node &send_node,
+           Node &recv_node,
+           MPI_Comm mpi_comm)
+{
+    Node n_snd_compact;
+    send_node.compact_to(n_snd_compact);
+    int data_len = n_snd_compact.total_bytes_compact();
+    
+    int m_size = mpi::size(mpi_comm);
+
+    recv_node.list_of(n_snd_compact.schema(),
+                      m_size);
+
+    int mpi_error = MPI_Allgather( n_snd_compact.data_ptr(), // local data
+                                   data_len, // local data len
+                                   MPI_CHAR, // send chars
+                                   recv_node.data_ptr(),  // rcv buffer
+                                   data_len, // data len 
+                                   MPI_CHAR,  // rcv chars
+                                   mpi_comm); // mpi com
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+
+
+//---------------------------------------------------------------------------//
+// Updates the cached per rank schemas of a gatherv (root is -1 for 
+// all_gatherv) from the received sizes and schema data, and returns the
+// combined result schema. The result is only rebuilt if a rank's 
+// schema changed.
+//---------------------------------------------------------------------------//
+static Schema *
+gathered_schema(SchemaCache *cache,
+                int root,
+                Node &n_rcv_sizes,
+                const char *schema_rcv_buff,
+                const int *schema_rcv_displs)
+{
+    std::vector<Schema*> rank_schemas;
+    bool changed = false;
+    int i = 0;
+
+    NodeIterator itr = n_rcv_sizes.children();
+    while(itr.has_next())
+    {
+        Node &curr = itr.next();
+
+        int    schema_len  = (int)curr["schema_len"].as_uint64();
+        uint64 schema_hash = curr["schema_hash"].as_uint64();
+
+        SchemaCache::Entry &entry = 
+                            cache->m_gatherv_recv[SchemaCache::Key(root,i)];
+
+        if(schema_len > 0)
+        {
+            cache_schema(entry,
+                         schema_hash,
+                         (const uint8*)&schema_rcv_buff[schema_rcv_displs[i]],
+                         schema_len);
+            changed = true;
+        }
+
+        rank_schemas.push_back(cached_schema(entry,schema_hash,i));
+        i++;
+    }
+
+    SchemaCache::Entry &res = cache->m_gatherv_result[root];
+    if(res.schema == NULL || changed)
+    {
+        //TODO: should we make it easer to create a compact schema?
+        Schema s_tmp;
+        for(size_t j=0; j < rank_schemas.size(); j++)
+        {
+            s_tmp.append().set(*rank_schemas[j]);
+        }
+
+        if(res.schema == NULL)
+        {
+            res.schema = new Schema();
+        }
+        s_tmp.compact_to(*res.schema);
+    }
+
+    return res.schema;
+}
+
+//---------------------------------------------------------------------------//
+// prepares a gatherv result node, reusing it if it already holds the
+// result layout (typically from the last gatherv).
+//---------------------------------------------------------------------------//
+static char *
+gathered_data_ptr(Node &recv_node,
+                  const Schema &rcv_schema)
+{
+    if(!same_layout(recv_node.schema(),rcv_schema,true) ||
+       recv_node.allocated_bytes() != rcv_schema.total_bytes_compact())
+    {
+        recv_node.set(rcv_schema);
+    }
+    return (char*)recv_node.data_ptr();
+}
+
+//---------------------------------------------------------------------------//
+int
+gatherv(Node &send_node,
+        Node &recv_node,
+        int root, 
+        MPI_Comm mpi_comm)
+{
+    Node n_snd_compact;
+    send_node.compact_to(n_snd_compact);
+
+    int m_size = mpi::size(mpi_comm);
+    int m_rank = mpi::rank(mpi_comm);
+
+    std::vector<uint8> schema_data;
+    encode_schema(n_snd_compact.schema(),schema_data);
+    uint64 schema_hash = utils::hash_bytes(&schema_data[0],
+                                           (index_t)schema_data.size());
+
+    int schema_len = (int)schema_data.size();
+    int data_len   = n_snd_compact.total_bytes_compact();
+
+    // skip the schema if the root already has it, see SchemaCache
+    SchemaCache *cache = schema_cache(mpi_comm);
+    std::map<int,uint64>::iterator snd_itr = cache->m_gatherv_send.find(root);
+    if(snd_itr != cache->m_gatherv_send.end() && 
+       snd_itr->second == schema_hash)
+    {
+        schema_len = 0;
+    }
+    cache->m_gatherv_send[root] = schema_hash;
+    
+    // to do the conduit gatherv, first need a gather to get the 
+    // schema and data buffer sizes
+    
+    uint64 snd_sizes[] = {(uint64)schema_len,
+                          (uint64)data_len,
+                          schema_hash};
+
+    Node n_rcv_sizes;
+
+    if( m_rank == root )
+    {
+        Schema s;
+        s["schema_len"].set(DataType::uint64());
+        s["data_len"].set(DataType::uint64());
+        s["schema_hash"].set(DataType::uint64());
+        n_rcv_sizes.list_of(s,m_size);
+    }
+
+    int mpi_error = MPI_Gather( snd_sizes, // local data
+                                3, // three uint64s per rank
+                                MPI_UINT64_T, // send uint64s
+                                n_rcv_sizes.data_ptr(),  // rcv buffer
+                                3,  // three uint64s per rank
+                                MPI_UINT64_T,  // rcv uint64s
+                                root,  // id of root for gather op
+                                mpi_comm); // mpi com
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+                                
+    Node n_rcv_tmp;
+    
+    int  *schema_rcv_counts = NULL;
+    int  *schema_rcv_displs = NULL;
+    char *schema_rcv_buff   = NULL;
+
+    int  *data_rcv_counts = NULL;
+    int  *data_rcv_displs = NULL;
+    char *data_rcv_buff   = NULL;
+
+    // we only need rcv params on the gather root
+    if( m_rank == root )
+    {
+        // alloc data for the mpi gather counts and displ arrays
+        n_rcv_tmp["schemas/counts"].set(DataType::c_int(m_size));
+        n_rcv_tmp["schemas/displs"].set(DataType::c_int(m_size));
+
+        n_rcv_tmp["data/counts"].set(DataType::c_int(m_size));
+        n_rcv_tmp["data/displs"].set(DataType::c_int(m_size));
+
+        // get pointers to counts and displs
+        schema_rcv_counts = n_rcv_tmp["schemas/counts"].value();
+        schema_rcv_displs = n_rcv_tmp["schemas/displs"].value();
+
+        data_rcv_counts = n_rcv_tmp["data/counts"].value();
+        data_rcv_displs = n_rcv_tmp["data/displs"].value();
+
+        int schema_curr_displ = 0;
+        int data_curr_displ   = 0;
+        int i=0;
+        
+        NodeIterator itr = n_rcv_sizes.children();
+        while(itr.has_next())
+        {
+            Node &curr = itr.next();
+
+            int schema_curr_count = (int)curr["schema_len"].as_uint64();
+            int data_curr_count   = (int)curr["data_len"].as_uint64();
+            
+            schema_rcv_counts[i] = schema_curr_count;
+            schema_rcv_displs[i] = schema_curr_displ;
+            schema_curr_displ   += schema_curr_count;
+            
+            data_rcv_counts[i] = data_curr_count;
+            data_rcv_displs[i] = data_curr_displ;
+            data_curr_displ   += data_curr_count;
+            
+            i++;
+        }
+        
+        n_rcv_tmp["schemas/data"].set(DataType::c_char(schema_curr_displ));
+        schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
+    }
+
+    mpi_error = MPI_Gatherv( (char*)&schema_data[0],
+                             schema_len,
+                             MPI_CHAR,
+                             schema_rcv_buff,
+                             schema_rcv_counts,
+                             schema_rcv_displs,
+                             MPI_CHAR,
+                             root,
+                             mpi_comm);
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if( m_rank == root )
+    {
+        // decode any new schemas, and allocate data to hold the 
+        // gather result
+        Schema *rcv_schema = gathered_schema(cache,
+                                             root,
+                                             n_rcv_sizes,
+                                             schema_rcv_buff,
+                                             schema_rcv_displs);
+
+        data_rcv_buff = gathered_data_ptr(recv_node,*rcv_schema);
+    }
+    
+    mpi_error = MPI_Gatherv( n_snd_compact.data_ptr(),
+                             data_len,
+                             MPI_CHAR,
+                             data_rcv_buff,
+                             data_rcv_counts,
+                             data_rcv_displs,
+                             MPI_CHAR,
+                             root,
+                             mpi_comm);
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+all_gatherv(Node &send_node,
+            Node &recv_node,
+            MPI_Comm mpi_comm)
+{
+    Node n_snd_compact;
+    send_node.compact_to(n_snd_compact);
+
+    int m_size = mpi::size(mpi_comm);
+
+    std::vector<uint8> schema_data;
+    encode_schema(n_snd_compact.schema(),schema_data);
+    uint64 schema_hash = utils::hash_bytes(&schema_data[0],
+                                           (index_t)schema_data.size());
+
+    int schema_len = (int)schema_data.size();
+    int data_len   = n_snd_compact.total_bytes_compact();
+
+    // skip the schema if all ranks already have it, see SchemaCache
+    SchemaCache *cache = schema_cache(mpi_comm);
+    std::map<int,uint64>::iterator snd_itr = cache->m_gatherv_send.find(-1);
+    if(snd_itr != cache->m_gatherv_send.end() && 
+       snd_itr->second == schema_hash)
+    {
+        schema_len = 0;
+    }
+    cache->m_gatherv_send[-1] = schema_hash;
+    
+    // to do the conduit gatherv, first need a gather to get the 
+    // schema and data buffer sizes
+    
+    uint64 snd_sizes[] = {(uint64)schema_len,
+                          (uint64)data_len,
+                          schema_hash};
+
+    Node n_rcv_sizes;
+
+    Schema s;
+    s["schema_len"].set(DataType::uint64());
+    s["data_len"].set(DataType::uint64());
+    s["schema_hash"].set(DataType::uint64());
+    n_rcv_sizes.list_of(s,m_size);
+
+    int mpi_error = MPI_Allgather( snd_sizes, // local data
+                                   3, // three uint64s per rank
+                                   MPI_UINT64_T, // send uint64s
+                                   n_rcv_sizes.data_ptr(),  // rcv buffer
+                                   3,  // three uint64s per rank
+                                   MPI_UINT64_T,  // rcv uint64s
+                                   mpi_comm); // mpi com
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+                                
+    Node n_rcv_tmp;
+    
+    int  *schema_rcv_counts = NULL;
+    int  *schema_rcv_displs = NULL;
+    char *schema_rcv_buff   = NULL;
+
+    int  *data_rcv_counts = NULL;
+    int  *data_rcv_displs = NULL;
+    char *data_rcv_buff   = NULL;
+
+
+    // alloc data for the mpi gather counts and displ arrays
+    n_rcv_tmp["schemas/counts"].set(DataType::c_int(m_size));
+    n_rcv_tmp["schemas/displs"].set(DataType::c_int(m_size));
+
+    n_rcv_tmp["data/counts"].set(DataType::c_int(m_size));
+    n_rcv_tmp["data/displs"].set(DataType::c_int(m_size));
+
+    // get pointers to counts and displs
+    schema_rcv_counts = n_rcv_tmp["schemas/counts"].value();
+    schema_rcv_displs = n_rcv_tmp["schemas/displs"].value();
+
+    data_rcv_counts = n_rcv_tmp["data/counts"].value();
+    data_rcv_displs = n_rcv_tmp["data/displs"].value();
+
+    int schema_curr_displ = 0;
+    int data_curr_displ   = 0;
+    int i=0;
+    
+    NodeIterator itr = n_rcv_sizes.children();
+    while(itr.has_next())
+    {
+        Node &curr = itr.next();
+
+        int schema_curr_count = (int)curr["schema_len"].as_uint64();
+        int data_curr_count   = (int)curr["data_len"].as_uint64();
+        
+        schema_rcv_counts[i] = schema_curr_count;
+        schema_rcv_displs[i] = schema_curr_displ;
+        schema_curr_displ   += schema_curr_count;
+        
+        data_rcv_counts[i] = data_curr_count;
+        data_rcv_displs[i] = data_curr_displ;
+        data_curr_displ   += data_curr_count;
+        
+        i++;
+    }
+
+    // every rank knows the schema sizes, so the schema exchange can be
+    // skipped when no rank's schema changed
+    if(schema_curr_displ > 0)
+    {
+        n_rcv_tmp["schemas/data"].set(DataType::c_char(schema_curr_displ));
+        schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
+
+        mpi_error = MPI_Allgatherv( (char*)&schema_data[0],
+                                    schema_len,
+                                    MPI_CHAR,
+                                    schema_rcv_buff,
+                                    schema_rcv_counts,
+                                    schema_rcv_displs,
+                                    MPI_CHAR,
+                                    mpi_comm);
+
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    // decode any new schemas, and allocate data to hold the 
+    // gather result
+    Schema *rcv_schema = gathered_schema(cache,
+                                         -1,
+                                         n_rcv_sizes,
+                                         schema_rcv_buff,
+                                         schema_rcv_displs);
+
+    data_rcv_buff = gathered_data_ptr(recv_node,*rcv_schema);
+    
+    mpi_error = MPI_Allgatherv( n_snd_compact.data_ptr(),
+                                data_len,
+                                MPI_CHAR,
+                                data_rcv_buff,
+                                data_rcv_counts,
+                                data_rcv_displs,
+                                MPI_CHAR,
+                                mpi_comm);
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+
+
+//---------------------------------------------------------------------------//
+// Broadcast, scatter and all to all support
+//---------------------------------------------------------------------------//
+
+// kinds of broadcast schema state, see SchemaCache::m_bcast
+static const int BCAST_KIND_BROADCAST = 0;
+static const int BCAST_KIND_SCATTER   = 1;
+
+// gatherv cache key used for all_to_allv results, see gathered_schema
+static const int ALL_TO_ALLV_CACHE_KEY = -2;
+
+//---------------------------------------------------------------------------//
+// Broadcasts the compact form of schema from root, rcv_schema is set to
+// it on all ranks (schema is only read on root). The schema is only sent
+// when it differs from the last one root broadcast for the given kind.
+//---------------------------------------------------------------------------//
+static int
+broadcast_schema(const Schema &schema,
+                 int root,
+                 int kind,
+                 MPI_Comm mpi_comm,
+                 Schema *&rcv_schema)
+{
+    SchemaCache *cache = schema_cache(mpi_comm);
+    SchemaCache::Entry &entry = cache->m_bcast[SchemaCache::Key(root,kind)];
+
+    std::vector<uint8> schema_data;
+    uint64 header[2] = {0, 0};
+
+    if(mpi::rank(mpi_comm) == root)
+    {
+        uint64 schema_hash = compact_schema_data(schema,schema_data);
+        header[1] = schema_hash;
+        if(entry.schema == NULL || entry.hash != schema_hash)
+        {
+            header[0] = (uint64)schema_data.size();
+        }
+    }
+
+    int mpi_error = MPI_Bcast(header, 2, MPI_UINT64_T, root, mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    int    schema_len  = (int)header[0];
+    uint64 schema_hash = header[1];
+
+    if(schema_len == 0)
+    {
+        rcv_schema = cached_schema(entry,schema_hash,root);
+        return mpi_error;
+    }
+
+    schema_data.resize((size_t)schema_len);
+    mpi_error = MPI_Bcast((char*)&schema_data[0],
+                          schema_len,
+                          MPI_CHAR,
+                          root,
+                          mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    rcv_schema = cache_schema(entry,schema_hash,&schema_data[0],schema_len);
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// Prepares node to receive data described by a compact schema. If the
+// node already has the layout (typically from the last exchange), the
+// data is received in place using a derived datatype. Otherwise the node
+// is reset to the schema and the data is received as bytes. 
+// Free the datatype with MPI_Type_free if it is not MPI_BYTE.
+//---------------------------------------------------------------------------//
+static int
+prepare_recv(Node &node,
+             const Schema &schema,
+             void *&recv_buff,
+             int &recv_count,
+             MPI_Datatype &recv_dtype)
+{
+    if(same_layout(node.schema(),schema,false))
+    {
+        index_t data_bytes = 0;
+        recv_buff  = MPI_BOTTOM;
+        recv_count = 1;
+        return create_mpi_datatype(node,recv_dtype,data_bytes);
+    }
+
+    node.set(schema);
+    recv_buff  = node.data_ptr();
+    recv_count = (int)schema.total_bytes_compact();
+    recv_dtype = MPI_BYTE;
+    return MPI_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+// Checks that the node passed to a scatter or all to all has a child
+// for each rank. With same_schemas, every child must also have the same
+// layout as the first child.
+//
+// Returns an error message, or an empty string if the node is ok. The
+// message is raised on all ranks via check_root_error or 
+// check_any_error, so no rank is left waiting in a collective.
+//---------------------------------------------------------------------------//
+static std::string
+check_children_per_rank(const Node &node,
+                        int m_size,
+                        bool same_schemas,
+                        const std::string &method)
+{
+    std::ostringstream oss;
+
+    if(node.number_of_children() != m_size)
+    {
+        oss << "<relay::mpi::" << method << "> the send node must"
+            << " have one child per rank. (communicator size: "
+            << m_size << ", number of children: " 
+            << node.number_of_children() << ")";
+    }
+    else if(same_schemas)
+    {
+        const Schema &ref = node.child(0).schema();
+        for(index_t i=1; i < m_size; i++)
+        {
+            if(!same_layout(node.child(i).schema(),ref,false))
+            {
+                oss << "<relay::mpi::" << method << "> all children of"
+                    << " the send node must have the same schema."
+                    << " (child " << i << " differs from child 0)";
+                break;
+            }
+        }
+    }
+
+    return oss.str();
+}
+
+//---------------------------------------------------------------------------//
+// Shares an error message found on root with all ranks and throws it on
+// every rank. Does nothing if root's message is empty.
+//---------------------------------------------------------------------------//
+static int
+check_root_error(const std::string &err,
+                 int root,
+                 MPI_Comm mpi_comm)
+{
+    int err_len = (int)err.size();
+    int mpi_error = MPI_Bcast(&err_len,1,MPI_INT,root,mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(err_len == 0)
+    {
+        return mpi_error;
+    }
+
+    std::vector<char> err_buff(err.begin(),err.end());
+    err_buff.resize((size_t)err_len);
+    mpi_error = MPI_Bcast(&err_buff[0],err_len,MPI_CHAR,root,mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    CONDUIT_ERROR(std::string(err_buff.begin(),err_buff.end()));
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// Like check_root_error, for checks made on every rank: if any rank has
+// an error message, all ranks throw the message of the lowest such rank.
+//---------------------------------------------------------------------------//
+static int
+check_any_error(const std::string &err,
+                MPI_Comm mpi_comm)
+{
+    int m_size = mpi::size(mpi_comm);
+    int err_rank = err.empty() ? m_size : mpi::rank(mpi_comm);
+    int first_err_rank = m_size;
+    int mpi_error = MPI_Allreduce(&err_rank,
+                                  &first_err_rank,
+                                  1,
+                                  MPI_INT,
+                                  MPI_MIN,
+                                  mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(first_err_rank < m_size)
+    {
+        mpi_error = check_root_error(err,first_err_rank,mpi_comm);
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// Encodes the schemas of the children of a compact node for a scatterv
+// or all_to_allv. Consecutive children with the same layout share one
+// encoding, so identical schemas are serialized once. A rank's schema
+// is skipped (schema_len 0) if it is the last one sent to that rank.
+//
+// headers holds (schema_len, data_len, schema_hash) for each rank.
+//---------------------------------------------------------------------------//
+static void
+encode_child_schemas(const Node &n_compact,
+                     std::map<int,uint64> &sent_hashes,
+                     std::vector<uint8> &schemas,
+                     std::vector<uint64> &headers,
+                     std::vector<int> &schema_counts,
+                     std::vector<int> &schema_displs,
+                     std::vector<int> &data_counts,
+                     std::vector<int> &data_displs)
+{
+    int m_size = (int)n_compact.number_of_children();
+
+    headers.resize(3 * m_size);
+    schema_counts.resize(m_size);
+    schema_displs.resize(m_size);
+    data_counts.resize(m_size);
+    data_displs.resize(m_size);
+
+    std::vector<uint8> child_schema;
+    uint64 schema_hash  = 0;
+    int    schema_displ = 0;
+    int    schema_len   = 0;
+    int    data_displ   = 0;
+
+    for(int i=0; i < m_size; i++)
+    {
+        const Node &child = n_compact.child(i);
+
+        if(i == 0 || 
+           !same_layout(child.schema(),n_compact.child(i-1).schema(),false))
+        {
+            schema_hash  = compact_schema_data(child.schema(),child_schema);
+            schema_displ = (int)schemas.size();
+            schema_len   = (int)child_schema.size();
+            schemas.insert(schemas.end(),
+                           child_schema.begin(),
+                           child_schema.end());
+        }
+
+        int curr_schema_len = schema_len;
+        std::map<int,uint64>::iterator itr = sent_hashes.find(i);
+        if(itr != sent_hashes.end() && itr->second == schema_hash)
+        {
+            curr_schema_len = 0;
+        }
+        sent_hashes[i] = schema_hash;
+
+        int data_len = (int)child.total_bytes_compact();
+
+        headers[3*i]     = (uint64)curr_schema_len;
+        headers[3*i + 1] = (uint64)data_len;
+        headers[3*i + 2] = schema_hash;
+
+        schema_counts[i] = curr_schema_len;
+        schema_displs[i] = schema_displ;
+
+        data_counts[i] = data_len;
+        data_displs[i] = data_displ;
+        data_displ    += data_len;
+    }
+}
+
+//---------------------------------------------------------------------------//
+int
+broadcast(Node &node,
+          int root,
+          MPI_Comm mpi_comm)
+{
+    Schema *rcv_schema = NULL;
+    int mpi_error = broadcast_schema(node.schema(),
+                                     root,
+                                     BCAST_KIND_BROADCAST,
+                                     mpi_comm,
+                                     rcv_schema);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-     for (int i = 0; i < count; ++i)
-     {
-         requests[i]._recvData->update(*(requests[i]._externalData));
+    void         *buff  = NULL;
+    int           count = 0;
+    MPI_Datatype  dtype = MPI_BYTE;
 
-         requests[i]._request = justrequests[i];
-         delete requests[i]._externalData;
-         requests[i]._externalData = 0;
-     }
+    if(mpi::rank(mpi_comm) == root)
+    {
+        // the data is sent directly from the node's memory
+        index_t data_bytes = 0;
+        buff  = MPI_BOTTOM;
+        count = 1;
+        mpi_error = create_mpi_datatype(node,dtype,data_bytes);
+    }
+    else
+    {
+        mpi_error = prepare_recv(node,*rcv_schema,buff,count,dtype);
+    }
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-     delete [] justrequests;
+    mpi_error = MPI_Bcast(buff, count, dtype, root, mpi_comm);
+
+    if(dtype != MPI_BYTE)
+    {
+        MPI_Type_free(&dtype);
+    }
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+scatter(Node &send_node,
+        Node &recv_node,
+        int root,
+        MPI_Comm mpi_comm)
+{
+    int m_size = mpi::size(mpi_comm);
+    int m_rank = mpi::rank(mpi_comm);
+
+    Node   n_snd_compact;
+    Schema s_empty;
+    const Schema *snd_schema = &s_empty;
+
+    std::string err;
+    if(m_rank == root)
+    {
+        err = check_children_per_rank(send_node,m_size,true,"scatter");
+    }
+    int mpi_error = check_root_error(err,root,mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(m_rank == root)
+    {
+        send_node.compact_to(n_snd_compact);
+        snd_schema = &n_snd_compact.child(0).schema();
+    }
+
+    // all children share the first child's schema, so only one 
+    // schema is sent
+    Schema *rcv_schema = NULL;
+    mpi_error = broadcast_schema(*snd_schema,
+                                 root,
+                                 BCAST_KIND_SCATTER,
+                                 mpi_comm,
+                                 rcv_schema);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    int data_len = (int)rcv_schema->total_bytes_compact();
+
+    void         *buff  = NULL;
+    int           count = 0;
+    MPI_Datatype  dtype = MPI_BYTE;
+    mpi_error = prepare_recv(recv_node,*rcv_schema,buff,count,dtype);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    mpi_error = MPI_Scatter(n_snd_compact.data_ptr(),
+                            data_len,
+                            MPI_BYTE,
+                            buff,
+                            count,
+                            dtype,
+                            root,
+                            mpi_comm);
+
+    if(dtype != MPI_BYTE)
+    {
+        MPI_Type_free(&dtype);
+    }
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+scatterv(Node &send_node,
+         Node &recv_node,
+         int root,
+         MPI_Comm mpi_comm)
+{
+    int m_size = mpi::size(mpi_comm);
+    int m_rank = mpi::rank(mpi_comm);
+
+    SchemaCache *cache = schema_cache(mpi_comm);
+
+    Node n_snd_compact;
+
+    std::vector<uint8>  snd_schemas;
+    std::vector<uint64> snd_headers;
+    std::vector<int>    schema_snd_counts;
+    std::vector<int>    schema_snd_displs;
+    std::vector<int>    data_snd_counts;
+    std::vector<int>    data_snd_displs;
+
+    std::string err;
+    if(m_rank == root)
+    {
+        err = check_children_per_rank(send_node,m_size,false,"scatterv");
+    }
+    int mpi_error = check_root_error(err,root,mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    // we only need snd params on the scatter root
+    if(m_rank == root)
+    {
+        send_node.compact_to(n_snd_compact);
+        encode_child_schemas(n_snd_compact,
+                             cache->m_scatterv_send,
+                             snd_schemas,
+                             snd_headers,
+                             schema_snd_counts,
+                             schema_snd_displs,
+                             data_snd_counts,
+                             data_snd_displs);
+    }
+
+    uint64 header[3];
+    mpi_error = MPI_Scatter(snd_headers.empty() ? NULL : &snd_headers[0],
+                            3,
+                            MPI_UINT64_T,
+                            header,
+                            3,
+                            MPI_UINT64_T,
+                            root,
+                            mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    int    schema_len  = (int)header[0];
+    uint64 schema_hash = header[2];
+
+    std::vector<uint8> schema_rcv_buff((size_t)schema_len);
+
+    mpi_error = MPI_Scatterv(snd_schemas.empty() ? NULL : &snd_schemas[0],
+                             schema_snd_counts.empty() ? NULL : 
+                                                    &schema_snd_counts[0],
+                             schema_snd_displs.empty() ? NULL :
+                                                    &schema_snd_displs[0],
+                             MPI_CHAR,
+                             schema_len > 0 ? &schema_rcv_buff[0] : NULL,
+                             schema_len,
+                             MPI_CHAR,
+                             root,
+                             mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    SchemaCache::Entry &entry = cache->m_scatterv_recv[root];
+    Schema *rcv_schema = NULL;
+    if(schema_len > 0)
+    {
+        rcv_schema = cache_schema(entry,
+                                  schema_hash,
+                                  &schema_rcv_buff[0],
+                                  schema_len);
+    }
+    else
+    {
+        rcv_schema = cached_schema(entry,schema_hash,root);
+    }
+
+    void         *buff  = NULL;
+    int           count = 0;
+    MPI_Datatype  dtype = MPI_BYTE;
+    mpi_error = prepare_recv(recv_node,*rcv_schema,buff,count,dtype);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    mpi_error = MPI_Scatterv(n_snd_compact.data_ptr(),
+                             data_snd_counts.empty() ? NULL :
+                                                   &data_snd_counts[0],
+                             data_snd_displs.empty() ? NULL :
+                                                   &data_snd_displs[0],
+                             MPI_BYTE,
+                             buff,
+                             count,
+                             dtype,
+                             root,
+                             mpi_comm);
+
+    if(dtype != MPI_BYTE)
+    {
+        MPI_Type_free(&dtype);
+    }
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+all_to_all(Node &send_node,
+           Node &recv_node,
+           MPI_Comm mpi_comm)
+{
+    int m_size = mpi::size(mpi_comm);
+
+    std::string err = check_children_per_rank(send_node,
+                                              m_size,
+                                              true,
+                                              "all_to_all");
+
+    Node n_snd_compact;
+    Schema s_rcv;
+    // each rank receives using its own schema, so all ranks must agree.
+    // the check always hashes the binary encoding, since ranks may use 
+    // different schema protocols
+    uint64 schema_hash = 0;
+    if(err.empty())
+    {
+        send_node.compact_to(n_snd_compact);
+        n_snd_compact.child(0).schema().compact_to(s_rcv);
+
+        std::vector<uint8> schema_data;
+        s_rcv.serialize(schema_data);
+        schema_hash = utils::hash_bytes(&schema_data[0],
+                                        (index_t)schema_data.size());
+    }
+
+    // the send node check and the schema check share one reduction:
+    // m_size - (lowest rank with an error), or 0 if no rank has one,
+    // followed by max(hash) and max(~hash) == ~min(hash)
+    uint64 checks[3] = {err.empty() ? 0 : 
+                                      (uint64)(m_size - mpi::rank(mpi_comm)),
+                        schema_hash,
+                        ~schema_hash};
+    uint64 checks_max[3] = {0, 0, 0};
+    int mpi_error = MPI_Allreduce(checks,
+                                  checks_max,
+                                  3,
+                                  MPI_UINT64_T,
+                                  MPI_MAX,
+                                  mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(checks_max[0] != 0)
+    {
+        mpi_error = check_root_error(err,
+                                     m_size - (int)checks_max[0],
+                                     mpi_comm);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    if(checks_max[1] != ~checks_max[2])
+    {
+        CONDUIT_ERROR("<relay::mpi::all_to_all> all ranks must send "
+                      "children with the same schema.");
+    }
+
+    int data_len = (int)s_rcv.total_bytes_compact();
+
+    recv_node.list_of(s_rcv,m_size);
+
+    mpi_error = MPI_Alltoall(n_snd_compact.data_ptr(),
+                             data_len,
+                             MPI_BYTE,
+                             recv_node.data_ptr(),
+                             data_len,
+                             MPI_BYTE,
+                             mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+all_to_allv(Node &send_node,
+            Node &recv_node,
+            MPI_Comm mpi_comm)
+{
+    int m_size = mpi::size(mpi_comm);
+
+    int mpi_error = check_any_error(check_children_per_rank(send_node,
+                                                            m_size,
+                                                            false,
+                                                            "all_to_allv"),
+                                    mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    SchemaCache *cache = schema_cache(mpi_comm);
+
+    Node n_snd_compact;
+    send_node.compact_to(n_snd_compact);
+
+    std::vector<uint8>  snd_schemas;
+    std::vector<uint64> snd_headers;
+    std::vector<int>    schema_snd_counts;
+    std::vector<int>    schema_snd_displs;
+    std::vector<int>    data_snd_counts;
+    std::vector<int>    data_snd_displs;
+
+    encode_child_schemas(n_snd_compact,
+                         cache->m_all_to_allv_send,
+                         snd_schemas,
+                         snd_headers,
+                         schema_snd_counts,
+                         schema_snd_displs,
+                         data_snd_counts,
+                         data_snd_displs);
+
+    // exchange schema and data sizes
+    Node n_rcv_sizes;
+    Schema s;
+    s["schema_len"].set(DataType::uint64());
+    s["data_len"].set(DataType::uint64());
+    s["schema_hash"].set(DataType::uint64());
+    n_rcv_sizes.list_of(s,m_size);
+
+    mpi_error = MPI_Alltoall(&snd_headers[0],
+                             3,
+                             MPI_UINT64_T,
+                             n_rcv_sizes.data_ptr(),
+                             3,
+                             MPI_UINT64_T,
+                             mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    std::vector<int> schema_rcv_counts(m_size);
+    std::vector<int> schema_rcv_displs(m_size);
+    std::vector<int> data_rcv_counts(m_size);
+    std::vector<int> data_rcv_displs(m_size);
+
+    int schema_curr_displ = 0;
+    int data_curr_displ   = 0;
+    int i=0;
+
+    NodeIterator itr = n_rcv_sizes.children();
+    while(itr.has_next())
+    {
+        Node &curr = itr.next();
+
+        int schema_curr_count = (int)curr["schema_len"].as_uint64();
+        int data_curr_count   = (int)curr["data_len"].as_uint64();
+
+        schema_rcv_counts[i] = schema_curr_count;
+        schema_rcv_displs[i] = schema_curr_displ;
+        schema_curr_displ   += schema_curr_count;
+
+        data_rcv_counts[i] = data_curr_count;
+        data_rcv_displs[i] = data_curr_displ;
+        data_curr_displ   += data_curr_count;
+
+        i++;
+    }
+
+    std::vector<char> schema_rcv_buff((size_t)schema_curr_displ);
+
+    mpi_error = MPI_Alltoallv(snd_schemas.empty() ? NULL : &snd_schemas[0],
+                              &schema_snd_counts[0],
+                              &schema_snd_displs[0],
+                              MPI_CHAR,
+                              schema_rcv_buff.empty() ? NULL :
+                                                       &schema_rcv_buff[0],
+                              &schema_rcv_counts[0],
+                              &schema_rcv_displs[0],
+                              MPI_CHAR,
+                              mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    // decode any new schemas, and allocate data to hold the result
+    Schema *rcv_schema = gathered_schema(cache,
+                                         ALL_TO_ALLV_CACHE_KEY,
+                                         n_rcv_sizes,
+                                         schema_rcv_buff.empty() ? NULL :
+                                                      &schema_rcv_buff[0],
+                                         &schema_rcv_displs[0]);
+
+    char *data_rcv_buff = gathered_data_ptr(recv_node,*rcv_schema);
+
+    mpi_error = MPI_Alltoallv(n_snd_compact.data_ptr(),
+                              &data_snd_counts[0],
+                              &data_snd_displs[0],
+                              MPI_BYTE,
+                              data_rcv_buff,
+                              &data_rcv_counts[0],
+                              &data_rcv_displs[0],
+                              MPI_BYTE,
+                              mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+
+//---------------------------------------------------------------------------//
+// Nonblocking gather support
+//
+// The v variants need three exchanges: sizes, schemas, then data. Only
+// the root (or every rank for all_gatherv) can post the later exchanges
+// once the earlier ones complete, so they run on a communicator 
+// duplicated for the request. This keeps them from matching other 
+// collectives posted on the caller's communicator in the meantime. 
+//---------------------------------------------------------------------------//
+enum GatherRequestStage
+{
+    GATHER_STAGE_DUP     = 0,
+    GATHER_STAGE_SIZES   = 1,
+    GATHER_STAGE_SCHEMAS = 2,
+    GATHER_STAGE_DATA    = 3,
+    GATHER_STAGE_DONE    = 4
+};
+
+//---------------------------------------------------------------------------//
+static void
+init_gather_request(ConduitMPIGatherRequest *request,
+                    Node &send_node,
+                    Node &recv_node,
+                    int root,
+                    MPI_Comm mpi_comm)
+{
+    request->_request = MPI_REQUEST_NULL;
+    request->_comm    = mpi_comm;
+    request->_root    = root;
+    request->_stage   = GATHER_STAGE_DATA;
+    request->_externalData = new Node();
+    request->_recvData     = &recv_node;
+    send_node.compact_to(request->_externalData->fetch("send"));
+}
+
+//---------------------------------------------------------------------------//
+// posts the next exchange of a v variant gather once the current one
+// has completed
+//---------------------------------------------------------------------------//
+static int
+gatherv_request_advance(ConduitMPIGatherRequest *request)
+{
+    Node &state      = *request->_externalData;
+    Node &n_snd      = state["send"];
+    MPI_Comm comm    = request->_comm;
+    int  root        = request->_root;
+    int  m_size      = mpi::size(comm);
+    int  m_rank      = mpi::rank(comm);
+    // the root, or every rank for the all_gatherv case
+    bool is_rcv      = (root < 0 || m_rank == root);
+    int  mpi_error   = MPI_SUCCESS;
+
+    if(request->_stage == GATHER_STAGE_DUP)
+    {
+        std::vector<uint8> schema_data;
+        encode_schema(n_snd.schema(),schema_data);
+        state["schema"].set(schema_data);
+
+        state["sizes/send"].set(DataType::c_int(2));
+        int *snd_sizes = state["sizes/send"].value();
+        snd_sizes[0] = (int)schema_data.size();
+        snd_sizes[1] = (int)n_snd.total_bytes_compact();
+
+        int *rcv_sizes = NULL;
+        if(is_rcv)
+        {
+            state["sizes/recv"].set(DataType::c_int(2 * m_size));
+            rcv_sizes = state["sizes/recv"].value();
+        }
+
+        if(root < 0)
+        {
+            mpi_error = MPI_Iallgather(snd_sizes, 2, MPI_INT,
+                                       rcv_sizes, 2, MPI_INT,
+                                       comm,
+                                       &request->_request);
+        }
+        else
+        {
+            mpi_error = MPI_Igather(snd_sizes, 2, MPI_INT,
+                                    rcv_sizes, 2, MPI_INT,
+                                    root,
+                                    comm,
+                                    &request->_request);
+        }
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        request->_stage = GATHER_STAGE_SIZES;
+    }
+    else if(request->_stage == GATHER_STAGE_SIZES)
+    {
+        int  *schema_rcv_counts = NULL;
+        int  *schema_rcv_displs = NULL;
+        char *schema_rcv_buff   = NULL;
+
+        if(is_rcv)
+        {
+            state["schemas/counts"].set(DataType::c_int(m_size));
+            state["schemas/displs"].set(DataType::c_int(m_size));
+            state["data/counts"].set(DataType::c_int(m_size));
+            state["data/displs"].set(DataType::c_int(m_size));
+
+            schema_rcv_counts = state["schemas/counts"].value();
+            schema_rcv_displs = state["schemas/displs"].value();
+            int *data_rcv_counts = state["data/counts"].value();
+            int *data_rcv_displs = state["data/displs"].value();
+            int *rcv_sizes = state["sizes/recv"].value();
+
+            int schema_curr_displ = 0;
+            int data_curr_displ   = 0;
+            for(int i=0; i < m_size; i++)
+            {
+                schema_rcv_counts[i] = rcv_sizes[2*i];
+                schema_rcv_displs[i] = schema_curr_displ;
+                schema_curr_displ   += rcv_sizes[2*i];
+
+                data_rcv_counts[i] = rcv_sizes[2*i+1];
+                data_rcv_displs[i] = data_curr_displ;
+                data_curr_displ   += rcv_sizes[2*i+1];
+            }
+
+            state["schemas/data"].set(DataType::c_char(schema_curr_displ));
+            schema_rcv_buff = state["schemas/data"].value();
+        }
+
+        Node &n_schema = state["schema"];
+        if(root < 0)
+        {
+            mpi_error = MPI_Iallgatherv(n_schema.data_ptr(),
+                                        (int)n_schema.dtype().number_of_elements(),
+                                        MPI_CHAR,
+                                        schema_rcv_buff,
+                                        schema_rcv_counts,
+                                        schema_rcv_displs,
+                                        MPI_CHAR,
+                                        comm,
+                                        &request->_request);
+        }
+        else
+        {
+            mpi_error = MPI_Igatherv(n_schema.data_ptr(),
+                                     (int)n_schema.dtype().number_of_elements(),
+                                     MPI_CHAR,
+                                     schema_rcv_buff,
+                                     schema_rcv_counts,
+                                     schema_rcv_displs,
+                                     MPI_CHAR,
+                                     root,
+                                     comm,
+                                     &request->_request);
+        }
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        request->_stage = GATHER_STAGE_SCHEMAS;
+    }
+    else if(request->_stage == GATHER_STAGE_SCHEMAS)
+    {
+        int  *data_rcv_counts = NULL;
+        int  *data_rcv_displs = NULL;
+        char *data_rcv_buff   = NULL;
+
+        if(is_rcv)
+        {
+            int *schema_rcv_counts = state["schemas/counts"].value();
+            int *schema_rcv_displs = state["schemas/displs"].value();
+            char *schema_rcv_buff  = state["schemas/data"].value();
+
+            // decode all schemas, compact them.
+            Schema s_tmp;
+            for(int i=0; i < m_size; i++)
+            {
+                Schema &s = s_tmp.append();
+                decode_schema((uint8*)&schema_rcv_buff[schema_rcv_displs[i]],
+                              schema_rcv_counts[i],
+                              s);
+            }
+            Schema rcv_schema;
+            s_tmp.compact_to(rcv_schema);
+
+            // allocate data to hold the gather result
+            request->_recvData->set(rcv_schema);
+            data_rcv_buff   = (char*)request->_recvData->data_ptr();
+            data_rcv_counts = state["data/counts"].value();
+            data_rcv_displs = state["data/displs"].value();
+        }
+
+        if(root < 0)
+        {
+            mpi_error = MPI_Iallgatherv(n_snd.data_ptr(),
+                                        (int)n_snd.total_bytes_compact(),
+                                        MPI_CHAR,
+                                        data_rcv_buff,
+                                        data_rcv_counts,
+                                        data_rcv_displs,
+                                        MPI_CHAR,
+                                        comm,
+                                        &request->_request);
+        }
+        else
+        {
+            mpi_error = MPI_Igatherv(n_snd.data_ptr(),
+                                     (int)n_snd.total_bytes_compact(),
+                                     MPI_CHAR,
+                                     data_rcv_buff,
+                                     data_rcv_counts,
+                                     data_rcv_displs,
+                                     MPI_CHAR,
+                                     root,
+                                     comm,
+                                     &request->_request);
+        }
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        request->_stage = GATHER_STAGE_DATA;
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// progresses a gather request, blocking until it completes if requested
+//---------------------------------------------------------------------------//
+static int
+gather_request_progress(ConduitMPIGatherRequest *request,
+                        bool block,
+                        int *flag,
+                        MPI_Status *status)
+{
+    int mpi_error = MPI_SUCCESS;
+    *flag = 0;
+
+    while(request->_stage != GATHER_STAGE_DONE)
+    {
+        int done = 0;
+        if(block)
+        {
+            mpi_error = MPI_Wait(&request->_request, status);
+            done = 1;
+        }
+        else
+        {
+            mpi_error = MPI_Test(&request->_request, &done, status);
+        }
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+        if(!done)
+        {
+            return mpi_error;
+        }
 
-     return mpi_error; 
+        if(request->_stage == GATHER_STAGE_DATA)
+        {
+            // v variants run on a duplicated communicator 
+            if(request->_externalData->has_child("schema"))
+            {
+                mpi_error = MPI_Comm_free(&request->_comm);
+                CONDUIT_CHECK_MPI_ERROR(mpi_error);
+            }
+            delete request->_externalData;
+            request->_externalData = NULL;
+            request->_recvData = NULL;
+            request->_stage = GATHER_STAGE_DONE;
+        }
+        else
+        {
+            mpi_error = gatherv_request_advance(request);
+            CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        }
+    }
 
+    *flag = 1;
+    return mpi_error;
 }
 
 //---------------------------------------------------------------------------//
 int
-gather(Node &send_node,
-       Node &recv_node,
-       int root,
-       MPI_Comm mpi_comm)
+igather(Node &send_node,
+        Node &recv_node,
+        int root,
+        MPI_Comm mpi_comm,
+        ConduitMPIGatherRequest *request)
 {
-    Node n_snd_compact;
-    send_node.compact_to(n_snd_compact);
-    int data_len = n_snd_compact.total_bytes_compact();
+    init_gather_request(request,send_node,recv_node,root,mpi_comm);
+    Node &n_snd = request->_externalData->fetch("send");
+    int data_len = (int)n_snd.total_bytes_compact();
 
     int m_size = mpi::size(mpi_comm);
     int m_rank = mpi::rank(mpi_comm);
 
     if(m_rank == root)
     {
-        recv_node.list_of(n_snd_compact.schema(),
+        recv_node.list_of(n_snd.schema(),
                           m_size);
     }
 
-    int mpi_error = MPI_Gather( n_snd_compact.data_ptr(), // local data
+    int mpi_error = MPI_Igather(n_snd.data_ptr(), // local data
                                 data_len, // local data len
                                 MPI_CHAR, // send chars
                                 recv_node.data_ptr(),  // rcv buffer
                                 data_len, // data len 
                                 MPI_CHAR,  // rcv chars
                                 root,
-                                mpi_comm); // mpi com
+                                mpi_comm, // mpi com
+                                &request->_request);
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
@@ -435,177 +3019,48 @@ gather(Node &send_node,
 
 //---------------------------------------------------------------------------//
 int
-all_gather(Node &send_node,
-           Node &recv_node,
-           MPI_Comm mpi_comm)
+iall_gather(Node &send_node,
+            Node &recv_node,
+            MPI_Comm mpi_comm,
+            ConduitMPIGatherRequest *request)
 {
-    Node n_snd_compact;
-    send_node.compact_to(n_snd_compact);
-    int data_len = n_snd_compact.total_bytes_compact();
-    
+    init_gather_request(request,send_node,recv_node,-1,mpi_comm);
+    Node &n_snd = request->_externalData->fetch("send");
+    int data_len = (int)n_snd.total_bytes_compact();
+
     int m_size = mpi::size(mpi_comm);
 
-    recv_node.list_of(n_snd_compact.schema(),
+    recv_node.list_of(n_snd.schema(),
                       m_size);
 
-    int mpi_error = MPI_Allgather( n_snd_compact.data_ptr(), // local data
+    int mpi_error = MPI_Iallgather(n_snd.data_ptr(), // local data
                                    data_len, // local data len
                                    MPI_CHAR, // send chars
                                    recv_node.data_ptr(),  // rcv buffer
                                    data_len, // data len 
                                    MPI_CHAR,  // rcv chars
-                                   mpi_comm); // mpi com
+                                   mpi_comm, // mpi com
+                                   &request->_request);
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
     return mpi_error;
 }
 
-
-
 //---------------------------------------------------------------------------//
 int
-gatherv(Node &send_node,
-        Node &recv_node,
-        int root, 
-        MPI_Comm mpi_comm)
+igatherv(Node &send_node,
+         Node &recv_node,
+         int root, 
+         MPI_Comm mpi_comm,
+         ConduitMPIGatherRequest *request)
 {
-    Node n_snd_compact;
-    send_node.compact_to(n_snd_compact);
-
-    int m_size = mpi::size(mpi_comm);
-    int m_rank = mpi::rank(mpi_comm);
-
-    std::string schema_str = n_snd_compact.schema().to_json();
-
-    int schema_len = schema_str.length() + 1;
-    int data_len   = n_snd_compact.total_bytes_compact();
-    
-    // to do the conduit gatherv, first need a gather to get the 
-    // schema and data buffer sizes
-    
-    int snd_sizes[] = {schema_len, data_len};
-
-    Node n_rcv_sizes;
-
-    if( m_rank == root )
-    {
-        Schema s;
-        s["schema_len"].set(DataType::c_int());
-        s["data_len"].set(DataType::c_int());
-        n_rcv_sizes.list_of(s,m_size);
-    }
-
-    int mpi_error = MPI_Gather( snd_sizes, // local data
-                                2, // two ints per rank
-                                MPI_INT, // send ints
-                                n_rcv_sizes.data_ptr(),  // rcv buffer
-                                2,  // two ints per rank
-                                MPI_INT,  // rcv ints
-                                root,  // id of root for gather op
-                                mpi_comm); // mpi com
-
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
-                                
-    Node n_rcv_tmp;
-    
-    int  *schema_rcv_counts = NULL;
-    int  *schema_rcv_displs = NULL;
-    char *schema_rcv_buff   = NULL;
-
-    int  *data_rcv_counts = NULL;
-    int  *data_rcv_displs = NULL;
-    char *data_rcv_buff   = NULL;
-
-    // we only need rcv params on the gather root
-    if( m_rank == root )
-    {
-        // alloc data for the mpi gather counts and displ arrays
-        n_rcv_tmp["schemas/counts"].set(DataType::c_int(m_size));
-        n_rcv_tmp["schemas/displs"].set(DataType::c_int(m_size));
-
-        n_rcv_tmp["data/counts"].set(DataType::c_int(m_size));
-        n_rcv_tmp["data/displs"].set(DataType::c_int(m_size));
-
-        // get pointers to counts and displs
-        schema_rcv_counts = n_rcv_tmp["schemas/counts"].value();
-        schema_rcv_displs = n_rcv_tmp["schemas/displs"].value();
-
-        data_rcv_counts = n_rcv_tmp["data/counts"].value();
-        data_rcv_displs = n_rcv_tmp["data/displs"].value();
-
-        int schema_curr_displ = 0;
-        int data_curr_displ   = 0;
-        int i=0;
-        
-        NodeIterator itr = n_rcv_sizes.children();
-        while(itr.has_next())
-        {
-            Node &curr = itr.next();
-
-            int schema_curr_count = curr["schema_len"].value();
-            int data_curr_count   = curr["data_len"].value();
-            
-            schema_rcv_counts[i] = schema_curr_count;
-            schema_rcv_displs[i] = schema_curr_displ;
-            schema_curr_displ   += schema_curr_count;
-            
-            data_rcv_counts[i] = data_curr_count;
-            data_rcv_displs[i] = data_curr_displ;
-            data_curr_displ   += data_curr_count;
-            
-            i++;
-        }
-        
-        n_rcv_tmp["schemas/data"].set(DataType::c_char(schema_curr_displ));
-        schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
-    }
-
-    mpi_error = MPI_Gatherv( const_cast <char*>(schema_str.c_str()),
-                             schema_len,
-                             MPI_CHAR,
-                             schema_rcv_buff,
-                             schema_rcv_counts,
-                             schema_rcv_displs,
-                             MPI_CHAR,
-                             root,
-                             mpi_comm);
-
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
-
-    // build all schemas from JSON, compact them.
-    Schema rcv_schema;
-    if( m_rank == root )
-    {
-        //TODO: should we make it easer to create a compact schema?
-        Schema s_tmp;
-        for(int i=0;i < m_size; i++)
-        {
-            Schema &s = s_tmp.append();
-            s.set(&schema_rcv_buff[schema_rcv_displs[i]]);
-        }
-        
-        s_tmp.compact_to(rcv_schema);
-    }
-
-    
-    if( m_rank == root )
-    {
-        // allocate data to hold the gather result
-        recv_node.set(rcv_schema);
-        data_rcv_buff = (char*)recv_node.data_ptr();
-    }
-    
-    mpi_error = MPI_Gatherv( n_snd_compact.data_ptr(),
-                             data_len,
-                             MPI_CHAR,
-                             data_rcv_buff,
-                             data_rcv_counts,
-                             data_rcv_displs,
-                             MPI_CHAR,
-                             root,
-                             mpi_comm);
+    init_gather_request(request,send_node,recv_node,root,mpi_comm);
+    request->_stage = GATHER_STAGE_DUP;
 
+    int mpi_error = MPI_Comm_idup(mpi_comm,
+                                  &request->_comm,
+                                  &request->_request);
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
     return mpi_error;
@@ -613,136 +3068,68 @@ gatherv(Node &send_node,
 
 //---------------------------------------------------------------------------//
 int
-all_gatherv(Node &send_node,
-            Node &recv_node,
-            MPI_Comm mpi_comm)
+iall_gatherv(Node &send_node,
+             Node &recv_node,
+             MPI_Comm mpi_comm,
+             ConduitMPIGatherRequest *request)
 {
-    Node n_snd_compact;
-    send_node.compact_to(n_snd_compact);
-
-    int m_size = mpi::size(mpi_comm);
-
-    std::string schema_str = n_snd_compact.schema().to_json();
-
-    int schema_len = schema_str.length() + 1;
-    int data_len   = n_snd_compact.total_bytes_compact();
-    
-    // to do the conduit gatherv, first need a gather to get the 
-    // schema and data buffer sizes
-    
-    int snd_sizes[] = {schema_len, data_len};
-
-    Node n_rcv_sizes;
-
-    Schema s;
-    s["schema_len"].set(DataType::c_int());
-    s["data_len"].set(DataType::c_int());
-    n_rcv_sizes.list_of(s,m_size);
-
-    int mpi_error = MPI_Allgather( snd_sizes, // local data
-                                   2, // two ints per rank
-                                   MPI_INT, // send ints
-                                   n_rcv_sizes.data_ptr(),  // rcv buffer
-                                   2,  // two ints per rank
-                                   MPI_INT,  // rcv ints
-                                   mpi_comm); // mpi com
-
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
-                                
-    Node n_rcv_tmp;
-    
-    int  *schema_rcv_counts = NULL;
-    int  *schema_rcv_displs = NULL;
-    char *schema_rcv_buff   = NULL;
-
-    int  *data_rcv_counts = NULL;
-    int  *data_rcv_displs = NULL;
-    char *data_rcv_buff   = NULL;
-
-
-    // alloc data for the mpi gather counts and displ arrays
-    n_rcv_tmp["schemas/counts"].set(DataType::c_int(m_size));
-    n_rcv_tmp["schemas/displs"].set(DataType::c_int(m_size));
-
-    n_rcv_tmp["data/counts"].set(DataType::c_int(m_size));
-    n_rcv_tmp["data/displs"].set(DataType::c_int(m_size));
-
-    // get pointers to counts and displs
-    schema_rcv_counts = n_rcv_tmp["schemas/counts"].value();
-    schema_rcv_displs = n_rcv_tmp["schemas/displs"].value();
-
-    data_rcv_counts = n_rcv_tmp["data/counts"].value();
-    data_rcv_displs = n_rcv_tmp["data/displs"].value();
-
-    int schema_curr_displ = 0;
-    int data_curr_displ   = 0;
-    int i=0;
-    
-    NodeIterator itr = n_rcv_sizes.children();
-    while(itr.has_next())
-    {
-        Node &curr = itr.next();
-
-        int schema_curr_count = curr["schema_len"].value();
-        int data_curr_count   = curr["data_len"].value();
-        
-        schema_rcv_counts[i] = schema_curr_count;
-        schema_rcv_displs[i] = schema_curr_displ;
-        schema_curr_displ   += schema_curr_count;
-        
-        data_rcv_counts[i] = data_curr_count;
-        data_rcv_displs[i] = data_curr_displ;
-        data_curr_displ   += data_curr_count;
-        
-        i++;
-    }
-    
-    n_rcv_tmp["schemas/data"].set(DataType::c_char(schema_curr_displ));
-    schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
+    return igatherv(send_node,recv_node,-1,mpi_comm,request);
+}
 
-    mpi_error = MPI_Allgatherv( const_cast <char*>(schema_str.c_str()),
-                                schema_len,
-                                MPI_CHAR,
-                                schema_rcv_buff,
-                                schema_rcv_counts,
-                                schema_rcv_displs,
-                                MPI_CHAR,
-                                mpi_comm);
+//---------------------------------------------------------------------------//
+int
+wait_gather(ConduitMPIGatherRequest *request,
+            MPI_Status *status)
+{
+    int flag = 0;
+    return gather_request_progress(request,true,&flag,status);
+}
 
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+//---------------------------------------------------------------------------//
+int
+test_gather(ConduitMPIGatherRequest *request,
+            int *flag,
+            MPI_Status *status)
+{
+    return gather_request_progress(request,false,flag,status);
+}
 
-    // build all schemas from JSON, compact them.
-    Schema rcv_schema;
-    //TODO: should we make it easer to create a compact schema?
-    Schema s_tmp;
-    for(int i=0;i < m_size; i++)
+//---------------------------------------------------------------------------//
+int
+wait_all_gather(int count,
+                ConduitMPIGatherRequest requests[],
+                MPI_Status statuses[])
+{
+    // the v variants post their later exchanges as they progress, so
+    // test all of the requests in turn instead of blocking on one, 
+    // which could wait on a rank that is blocked on another request
+    int mpi_error = MPI_SUCCESS;
+    int num_done = 0;
+    std::vector<int> done(count,0);
+
+    while(num_done < count)
     {
-        Schema &s = s_tmp.append();
-        s.set(&schema_rcv_buff[schema_rcv_displs[i]]);
+        for(int i = 0; i < count; ++i)
+        {
+            if(done[i])
+            {
+                continue;
+            }
+
+            mpi_error = test_gather(&requests[i], &done[i], &statuses[i]);
+            CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+            if(done[i])
+            {
+                num_done++;
+            }
+        }
     }
-    
-    s_tmp.compact_to(rcv_schema);
-
-    // allocate data to hold the gather result
-    recv_node.set(rcv_schema);
-    data_rcv_buff = (char*)recv_node.data_ptr();
-    
-    mpi_error = MPI_Allgatherv( n_snd_compact.data_ptr(),
-                                data_len,
-                                MPI_CHAR,
-                                data_rcv_buff,
-                                data_rcv_counts,
-                                data_rcv_displs,
-                                MPI_CHAR,
-                                mpi_comm);
-
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
     return mpi_error;
 }
 
 
-
 //---------------------------------------------------------------------------//
 std::string
 about()
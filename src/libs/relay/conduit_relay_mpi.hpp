@@ -87,6 +87,20 @@ namespace mpi
         Node* _recvData;
     };
 
+    // state for the nonblocking gather variants, which may need 
+    // several exchanges (sizes, schemas, then data) to complete
+    struct ConduitMPIGatherRequest {
+        MPI_Request _request;
+        MPI_Comm _comm;
+        // gather root, -1 for the all_gather variants
+        int _root;
+        // current exchange, see wait_gather
+        int _stage;
+        // holds the compact send data and temporary buffers
+        Node* _externalData;
+        Node* _recvData;
+    };
+
 
 //-----------------------------------------------------------------------------
 /// Helpers for MPI Params
@@ -95,8 +109,28 @@ namespace mpi
     
     int CONDUIT_RELAY_API rank(MPI_Comm mpi_comm);
 
+//-----------------------------------------------------------------------------
+/// Schema encoding used by the methods below that send schemas.
+///
+/// "conduit_bin" (default) uses the compact binary encoding (see
+/// Schema::serialize), "conduit_json" sends the schema as JSON. 
+/// Receivers accept either encoding, so ranks may use different settings.
+//-----------------------------------------------------------------------------
+    void        CONDUIT_RELAY_API set_schema_protocol(const std::string &protocol);
+
+    std::string CONDUIT_RELAY_API schema_protocol();
+
 //-----------------------------------------------------------------------------
 /// Standard MPI Send Recv
+///
+/// send transfers the node's schema and data. recv reuses the passed node
+/// if it already has the sender's layout (for example from a prior recv),
+/// otherwise the node is reset to a compact copy of the sender's schema.
+///
+/// Each communicator caches the last schema exchanged with each peer and 
+/// tag. After the first exchange, a schema is only resent when it 
+/// changes, the same applies to gatherv and all_gatherv. This requires
+/// peers to exchange nodes on a communicator only via these methods. 
 //-----------------------------------------------------------------------------
 
     int CONDUIT_RELAY_API send(Node& node,
@@ -108,6 +142,25 @@ namespace mpi
                                int source,
                                int tag,
                                MPI_Comm comm);
+
+//-----------------------------------------------------------------------------
+/// Data only Send Recv
+///
+/// These only transfer leaf data, the receiving node must already have
+/// a schema compatible with the sender's. Neither the sender nor the 
+/// receiver need to be compact: the data moves directly between the
+/// nodes' memory using MPI derived datatypes, without staging copies.
+//-----------------------------------------------------------------------------
+
+    int CONDUIT_RELAY_API send_data(const Node &node,
+                                    int dest,
+                                    int tag,
+                                    MPI_Comm comm);
+
+    int CONDUIT_RELAY_API recv_data(Node &node,
+                                    int source,
+                                    int tag,
+                                    MPI_Comm comm);
 // TODO:
 // int CONDUIT_RELAY_API send_recv(Node &send_node,
 //                                int dest,
@@ -120,8 +173,35 @@ namespace mpi
 
 //-----------------------------------------------------------------------------
 /// MPI Reduce
+///
+/// Reduces each numeric leaf using the MPI datatype that matches its 
+/// dtype. All ranks must pass nodes with the same schema. The result 
+/// has the compact form of the send node's schema: if recv_node already
+/// has that layout (for example from the last reduce) it is updated in
+/// place, otherwise it is reset. Compact send nodes are reduced directly
+/// from their memory, and passing the same node as send_node and 
+/// recv_node reduces it in place.
+///
+/// Trees with mixed leaf types are reduced with one MPI call, using a
+/// derived datatype and an op that applies mpi_op to each leaf. This 
+/// supports the predefined ops, trees with mixed leaf types reduced with
+/// other ops use one MPI call per run of same typed leaves.
 //-----------------------------------------------------------------------------
-    
+
+    int CONDUIT_RELAY_API reduce(Node &send_node,
+                                 Node &recv_node,
+                                 MPI_Op mpi_op,
+                                 int root,
+                                 MPI_Comm comm);
+
+    int CONDUIT_RELAY_API all_reduce(Node &send_node,
+                                     Node &recv_node,
+                                     MPI_Op mpi_op,
+                                     MPI_Comm comm);
+
+    // these reduce the compact data of send_node as an array of 
+    // mpi_datatype elements, regardless of the leaf types. Prefer the
+    // overloads above, which use each leaf's type.
     int CONDUIT_RELAY_API reduce(Node &send_node,
                                  Node &recv_node,
                                  MPI_Datatype mpi_datatype,
@@ -130,10 +210,10 @@ namespace mpi
                                  MPI_Comm comm);
 
     int CONDUIT_RELAY_API all_reduce(Node &send_node,
-                                   Node &recv_node,
-                                   MPI_Datatype mpi_datatype,
-                                   MPI_Op mpi_op,
-                                   MPI_Comm comm);
+                                     Node &recv_node,
+                                     MPI_Datatype mpi_datatype,
+                                     MPI_Op mpi_op,
+                                     MPI_Comm comm);
 
 //-----------------------------------------------------------------------------
 /// Async MPI Send Recv
@@ -190,25 +270,100 @@ namespace mpi
                                       Node &recv_node,
                                       MPI_Comm mpi_comm);
 
+//-----------------------------------------------------------------------------
+/// Nonblocking MPI gather
+///
+/// These start a gather and return immediately, send_node may be modified
+/// once they return (its data is copied). recv_node must not be accessed
+/// until the request completes, via wait_gather or test_gather. 
+///
+/// The v variants exchange sizes and schemas before the data, completing
+/// a request progresses through these exchanges, which run on a 
+/// communicator duplicated for the request. They always send schemas, 
+/// and do not use the schema cache of the blocking variants.
+///
+/// When several v variant requests are pending, complete them in the same
+/// order on all ranks, or use wait_all_gather.
+//-----------------------------------------------------------------------------
 
-// TODO:
-//
-// int CONDUIT_RELAY_API broadcast(Node& node,
-//                                int root,
-//                                MPI_Comm comm );
-//
-// int CONDUIT_RELAY_API scatter(Node &send_node,
-//                               Node &recv_node,
-//                               int root,
-//                               MPI_Comm mpi_comm );
-//
-// int CONDUIT_RELAY_API all_to_all(Node& send_node,
-//                                  Node& recv_node,
-//                                  MPI_Comm mpi_comm);
-//
-// int CONDUIT_RELAY_API all_to_allv(Node& send_node,
-//                                   Node& recv_node,
-//                                   MPI_Comm mpi_comm);
+    int CONDUIT_RELAY_API igather(Node &send_node,
+                                  Node &recv_node,
+                                  int root,
+                                  MPI_Comm mpi_comm,
+                                  ConduitMPIGatherRequest *request);
+
+    int CONDUIT_RELAY_API iall_gather(Node &send_node,
+                                      Node &recv_node,
+                                      MPI_Comm mpi_comm,
+                                      ConduitMPIGatherRequest *request);
+
+    int CONDUIT_RELAY_API igatherv(Node &send_node,
+                                   Node &recv_node,
+                                   int root, 
+                                   MPI_Comm mpi_comm,
+                                   ConduitMPIGatherRequest *request);
+
+    int CONDUIT_RELAY_API iall_gatherv(Node &send_node,
+                                       Node &recv_node,
+                                       MPI_Comm mpi_comm,
+                                       ConduitMPIGatherRequest *request);
+
+    // blocks until the gather completes
+    int CONDUIT_RELAY_API wait_gather(ConduitMPIGatherRequest *request,
+                                      MPI_Status *status);
+
+    // progresses the gather without blocking, flag is set to 1 
+    // when it has completed
+    int CONDUIT_RELAY_API test_gather(ConduitMPIGatherRequest *request,
+                                      int *flag,
+                                      MPI_Status *status);
+
+    int CONDUIT_RELAY_API wait_all_gather(int count,
+                                          ConduitMPIGatherRequest requests[],
+                                          MPI_Status statuses[]);
+
+
+//-----------------------------------------------------------------------------
+/// MPI broadcast, scatter and all to all
+///
+/// Schemas are exchanged in their compact binary form and cached like the 
+/// gatherv schemas: a schema is only resent when it changes. Receiving 
+/// nodes that already have the incoming layout (for example from the 
+/// last call) receive the data in place, otherwise they are reset to a 
+/// compact copy of the incoming schema.
+///
+/// For scatter and the all to all variants, the send node must have one
+/// child per rank: child i is sent to rank i. Invalid send nodes raise
+/// an error on every rank of the communicator.
+//-----------------------------------------------------------------------------
+
+    // sends root's node to all other ranks
+    int CONDUIT_RELAY_API broadcast(Node &node,
+                                    int root,
+                                    MPI_Comm mpi_comm);
+
+    // the non-v variants expect identical schemas for all children
+    // (for all_to_all, on all ranks)
+    int CONDUIT_RELAY_API scatter(Node &send_node,
+                                  Node &recv_node,
+                                  int root,
+                                  MPI_Comm mpi_comm);
+
+    // recv_node is a list with the child each rank sent to this rank
+    int CONDUIT_RELAY_API all_to_all(Node &send_node,
+                                     Node &recv_node,
+                                     MPI_Comm mpi_comm);
+
+    // the v variants work for varying schemas, children with the same 
+    // schema as the previous child share one serialized schema
+    int CONDUIT_RELAY_API scatterv(Node &send_node,
+                                   Node &recv_node,
+                                   int root,
+                                   MPI_Comm mpi_comm);
+
+    int CONDUIT_RELAY_API all_to_allv(Node &send_node,
+                                      Node &recv_node,
+                                      MPI_Comm mpi_comm);
 
 
 //-----------------------------------------------------------------------------
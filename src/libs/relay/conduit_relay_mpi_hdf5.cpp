@@ -0,0 +1,1139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_mpi_hdf5.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit_relay_mpi_hdf5.hpp"
+#include "conduit_relay_mpi.hpp"
+#include "conduit_relay_hdf5.hpp"
+
+//-----------------------------------------------------------------------------
+// standard lib includes
+//-----------------------------------------------------------------------------
+#include <iostream>
+#include <map>
+#include <set>
+
+//-----------------------------------------------------------------------------
+// external lib includes
+//-----------------------------------------------------------------------------
+#include <hdf5.h>
+
+//-----------------------------------------------------------------------------
+/// The CONDUIT_CHECK_HDF5_ERROR macro is used to check error codes from HDF5.
+//-----------------------------------------------------------------------------
+#define CONDUIT_CHECK_HDF5_ERROR( hdf5_err, msg    )                \
+{                                                                   \
+    if( hdf5_err < 0 )                                              \
+    {                                                               \
+        std::ostringstream hdf5_err_oss;                            \
+        hdf5_err_oss << "HDF5 Error code "                          \
+            <<  hdf5_err                                            \
+            << " " << msg;                                          \
+        CONDUIT_ERROR( hdf5_err_oss.str());                         \
+    }                                                               \
+}
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::mpi --
+//-----------------------------------------------------------------------------
+namespace mpi
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::mpi::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+//---------------------------------------------------------------------------//
+// Private helpers
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// name of the dataset that holds the per rank element counts of all 
+// leaves, reserved in shared files
+//---------------------------------------------------------------------------//
+static const std::string rank_counts_path = "conduit_rank_counts";
+
+//---------------------------------------------------------------------------//
+// Layout of a leaf of the shared file, from the view of this rank.
+//
+// Each entry is a leaf path, the conduit type id used for its dataset, 
+// this rank's number of elements (-1 if this rank doesn't have the leaf),
+// the offset of this rank's elements in the dataset, and the total 
+// number of elements of all ranks.
+//---------------------------------------------------------------------------//
+struct SharedLeafLayout
+{
+    std::string  path;
+    index_t      dtype_id;
+    int64        count;
+    int64        offset;
+    int64        total;
+};
+
+//---------------------------------------------------------------------------//
+// If any rank has an error message, returns the message of the lowest
+// such rank on all ranks, otherwise an empty string. Callers throw after 
+// cleaning up, so that no rank is left waiting in a collective.
+//---------------------------------------------------------------------------//
+static std::string
+agree_on_error(const std::string &err,
+               MPI_Comm mpi_comm)
+{
+    int m_size = mpi::size(mpi_comm);
+    int err_rank = err.empty() ? m_size : mpi::rank(mpi_comm);
+    int first_err_rank = m_size;
+    MPI_Allreduce(&err_rank, &first_err_rank, 1, MPI_INT, MPI_MIN, mpi_comm);
+
+    if(first_err_rank == m_size)
+    {
+        return std::string();
+    }
+
+    int err_len = (int)err.size();
+    MPI_Bcast(&err_len, 1, MPI_INT, first_err_rank, mpi_comm);
+
+    std::vector<char> err_buff(err.begin(),err.end());
+    err_buff.resize((size_t)err_len);
+    MPI_Bcast(&err_buff[0], err_len, MPI_CHAR, first_err_rank, mpi_comm);
+
+    return std::string(err_buff.begin(),err_buff.end());
+}
+
+//---------------------------------------------------------------------------//
+// computes each leaf's offset for this rank (the sum of the counts of the 
+// lower ranks) and total number of elements
+//---------------------------------------------------------------------------//
+static void
+compute_shared_offsets(const std::vector<int64> &counts,
+                       MPI_Comm mpi_comm,
+                       std::vector<int64> &offsets,
+                       std::vector<int64> &totals)
+{
+    int num_leaves = (int)counts.size();
+    offsets.assign(counts.size(),0);
+    totals.assign(counts.size(),0);
+
+    if(num_leaves == 0)
+    {
+        return;
+    }
+
+    // ranks without a leaf don't add to the offsets
+    std::vector<int64> num_eles(counts.size(),0);
+    for(int i = 0; i < num_leaves; i++)
+    {
+        if(counts[i] > 0)
+        {
+            num_eles[i] = counts[i];
+        }
+    }
+
+    MPI_Exscan(&num_eles[0], &offsets[0], num_leaves,
+               MPI_INT64_T, MPI_SUM, mpi_comm);
+
+    // the result of MPI_Exscan is undefined on rank 0
+    if(mpi::rank(mpi_comm) == 0)
+    {
+        offsets.assign(counts.size(),0);
+    }
+
+    MPI_Allreduce(&num_eles[0], &totals[0], num_leaves,
+                  MPI_INT64_T, MPI_SUM, mpi_comm);
+}
+
+//---------------------------------------------------------------------------//
+// single element dtype used to create a shared leaf's dataset
+//---------------------------------------------------------------------------//
+static DataType
+shared_leaf_dtype(index_t dtype_id)
+{
+    if(dtype_id == DataType::CHAR8_STR_ID)
+    {
+        return DataType::char8_str(1);
+    }
+    return DataType::default_dtype(dtype_id);
+}
+
+//---------------------------------------------------------------------------//
+// collects the paths and nodes for the leaves of the passed tree
+//---------------------------------------------------------------------------//
+static void
+collect_leaves(const Node &node,
+               const std::string &path,
+               std::vector<std::string> &leaf_paths,
+               std::vector<const Node*> &leaves)
+{
+    const DataType &dt = node.dtype();
+
+    if(dt.is_number() || dt.is_string())
+    {
+        leaf_paths.push_back(path);
+        leaves.push_back(&node);
+    }
+    else if(dt.is_object())
+    {
+        NodeConstIterator itr = node.children();
+        while(itr.has_next())
+        {
+            const Node &child = itr.next();
+            std::string child_path = itr.name();
+            if(!path.empty())
+            {
+                child_path = path + "/" + child_path;
+            }
+            collect_leaves(child, child_path, leaf_paths, leaves);
+        }
+    }
+    else if(dt.is_list())
+    {
+        CONDUIT_ERROR("HDF5 write doesn't support LIST_ID nodes "
+                      "(path: \"" << path << "\")");
+    }
+    // empty leaves are skipped
+}
+
+//---------------------------------------------------------------------------//
+// gathers the leaf paths and types of all ranks and constructs the union 
+// layout, in order of first appearance by rank. Element counts aren't 
+// gathered, offsets and totals come from compute_shared_offsets.
+//---------------------------------------------------------------------------//
+static void
+agree_on_shared_layout(const std::vector<std::string> &leaf_paths,
+                       const std::vector<const Node*> &leaves,
+                       MPI_Comm mpi_comm,
+                       std::vector<SharedLeafLayout> &layout)
+{
+    int m_size = mpi::size(mpi_comm);
+
+    Node n_desc;
+    Node &n_leaves = n_desc["leaves"];
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        Node &n_leaf = n_leaves.append();
+        n_leaf["path"] = leaf_paths[i];
+        n_leaf["dtype_id"].set_int64(leaves[i]->dtype().id());
+    }
+
+    Node n_all_desc;
+    mpi::all_gatherv(n_desc, n_all_desc, mpi_comm);
+
+    std::map<std::string,size_t> layout_idx;
+    layout.clear();
+
+    for(int r = 0; r < m_size; r++)
+    {
+        if(!n_all_desc[r].has_child("leaves"))
+        {
+            continue;
+        }
+
+        const Node &n_rank_leaves = n_all_desc[r]["leaves"];
+        NodeConstIterator itr = n_rank_leaves.children();
+        while(itr.has_next())
+        {
+            const Node &n_leaf = itr.next();
+            std::string path = n_leaf["path"].as_string();
+            index_t dtype_id = (index_t) n_leaf["dtype_id"].as_int64();
+
+            std::map<std::string,size_t>::iterator l_itr;
+            l_itr = layout_idx.find(path);
+            if(l_itr == layout_idx.end())
+            {
+                layout_idx[path] = layout.size();
+                layout.push_back(SharedLeafLayout());
+                SharedLeafLayout &entry = layout.back();
+                entry.path = path;
+                entry.dtype_id = dtype_id;
+                entry.count  = -1;
+                entry.offset = 0;
+                entry.total  = 0;
+            }
+            else if(layout[l_itr->second].dtype_id != dtype_id)
+            {
+                CONDUIT_ERROR("Leaf \"" << path << "\" has different "
+                              "types across ranks: "
+                              << DataType::id_to_name(
+                                            layout[l_itr->second].dtype_id)
+                              << " vs "
+                              << DataType::id_to_name(dtype_id)
+                              << " (rank " << r << ")");
+            }
+        }
+    }
+
+    for(size_t i = 0; i < layout.size(); i++)
+    {
+        const std::string &path = layout[i].path;
+
+        // the rank counts dataset name is reserved
+        if(path == rank_counts_path ||
+           path.compare(0, rank_counts_path.size() + 1,
+                        rank_counts_path + "/") == 0)
+        {
+            CONDUIT_ERROR("\"" << rank_counts_path << "\" is reserved in"
+                          " shared HDF5 files (path: \"" << path << "\")");
+        }
+
+        // a path can't be a leaf on one rank and a group on another
+        size_t pos = path.find('/');
+        while(pos != std::string::npos)
+        {
+            std::string parent_path = path.substr(0,pos);
+            if(layout_idx.find(parent_path) != layout_idx.end())
+            {
+                CONDUIT_ERROR("\"" << parent_path << "\" is a leaf on some"
+                              " ranks and a parent of \"" << path 
+                              << "\" on others");
+            }
+            pos = path.find('/',pos+1);
+        }
+    }
+
+    // this rank's counts, then offsets and totals from all ranks
+    std::vector<int64> counts(layout.size(),-1);
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        counts[layout_idx[leaf_paths[i]]] = 
+                                    leaves[i]->dtype().number_of_elements();
+    }
+
+    std::vector<int64> offsets;
+    std::vector<int64> totals;
+    compute_shared_offsets(counts, mpi_comm, offsets, totals);
+
+    for(size_t i = 0; i < layout.size(); i++)
+    {
+        layout[i].count  = counts[i];
+        layout[i].offset = offsets[i];
+        layout[i].total  = totals[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+// creates the groups for all of the leaf paths, the datasets, and the 
+// rank counts dataset
+//---------------------------------------------------------------------------//
+static void
+create_shared_datasets(hid_t h5_file_id,
+                       const std::vector<SharedLeafLayout> &layout,
+                       int num_ranks)
+{
+    // preserve creation order
+    hid_t h5_gc_plist = H5Pcreate(H5P_GROUP_CREATE);
+    CONDUIT_CHECK_HDF5_ERROR(h5_gc_plist,
+                             "Failed to create H5P_GROUP_CREATE property "
+                             << " list");
+
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_link_creation_order(h5_gc_plist,
+                        ( H5P_CRT_ORDER_TRACKED |  H5P_CRT_ORDER_INDEXED) ),
+                             "Failed to set creation order options for "
+                             << "property list");
+
+    std::set<std::string> groups;
+
+    hid_t h5_aspace_id = H5Screate(H5S_SCALAR);
+    CONDUIT_CHECK_HDF5_ERROR(h5_aspace_id,
+                             "Failed to create HDF5 scalar Dataspace");
+
+    for(size_t i = 0; i < layout.size(); i++)
+    {
+        const SharedLeafLayout &entry = layout[i];
+
+        // create any parent groups
+        size_t pos = entry.path.find('/');
+        while(pos != std::string::npos)
+        {
+            std::string group_path = entry.path.substr(0,pos);
+            if(groups.find(group_path) == groups.end())
+            {
+                hid_t h5_group_id = H5Gcreate(h5_file_id,
+                                              group_path.c_str(),
+                                              H5P_DEFAULT,
+                                              h5_gc_plist,
+                                              H5P_DEFAULT);
+                CONDUIT_CHECK_HDF5_ERROR(h5_group_id,
+                                         "Failed to create HDF5 Group "
+                                         << group_path);
+                CONDUIT_CHECK_HDF5_ERROR(H5Gclose(h5_group_id),
+                                         "Failed to close HDF5 Group "
+                                         << group_path);
+                groups.insert(group_path);
+            }
+            pos = entry.path.find('/',pos+1);
+        }
+
+        DataType leaf_dtype = shared_leaf_dtype(entry.dtype_id);
+        hid_t h5_dtype_id = relay::io::conduit_dtype_to_hdf5_dtype(leaf_dtype,
+                                                                entry.path);
+
+        hsize_t num_eles = (hsize_t) entry.total;
+        hid_t h5_dspace_id = H5Screate_simple(1,
+                                              &num_eles,
+                                              NULL);
+        CONDUIT_CHECK_HDF5_ERROR(h5_dspace_id,
+                                 "Failed to create HDF5 Dataspace for "
+                                 << entry.path);
+
+        hid_t h5_dset_id = H5Dcreate(h5_file_id,
+                                     entry.path.c_str(),
+                                     h5_dtype_id,
+                                     h5_dspace_id,
+                                     H5P_DEFAULT,
+                                     H5P_DEFAULT,
+                                     H5P_DEFAULT);
+        CONDUIT_CHECK_HDF5_ERROR(h5_dset_id,
+                                 "Failed to create HDF5 Dataset "
+                                 << entry.path);
+
+        // record the leaf's column in the rank counts dataset
+        int64 leaf_index = (int64) i;
+        hid_t h5_attr_id = H5Acreate(h5_dset_id,
+                                     "conduit_leaf_index",
+                                     H5T_STD_I64LE,
+                                     h5_aspace_id,
+                                     H5P_DEFAULT,
+                                     H5P_DEFAULT);
+        CONDUIT_CHECK_HDF5_ERROR(h5_attr_id,
+                                 "Failed to create HDF5 Attribute for "
+                                 << entry.path);
+        CONDUIT_CHECK_HDF5_ERROR(H5Awrite(h5_attr_id,
+                                          H5T_NATIVE_INT64,
+                                          &leaf_index),
+                                 "Failed to write HDF5 Attribute for "
+                                 << entry.path);
+
+        H5Aclose(h5_attr_id);
+        H5Sclose(h5_dspace_id);
+        CONDUIT_CHECK_HDF5_ERROR(H5Dclose(h5_dset_id),
+                                 "Failed to close HDF5 Dataset "
+                                 << entry.path);
+    }
+
+    H5Sclose(h5_aspace_id);
+    H5Pclose(h5_gc_plist);
+
+    // one row of element counts (-1 for missing leaves) per rank
+    if(!layout.empty())
+    {
+        hsize_t dims[2] = { (hsize_t) num_ranks, (hsize_t) layout.size() };
+        hid_t h5_dspace_id = H5Screate_simple(2, dims, NULL);
+        CONDUIT_CHECK_HDF5_ERROR(h5_dspace_id,
+                                 "Failed to create HDF5 Dataspace for "
+                                 << rank_counts_path);
+
+        hid_t h5_dset_id = H5Dcreate(h5_file_id,
+                                     rank_counts_path.c_str(),
+                                     H5T_STD_I64LE,
+                                     h5_dspace_id,
+                                     H5P_DEFAULT,
+                                     H5P_DEFAULT,
+                                     H5P_DEFAULT);
+        CONDUIT_CHECK_HDF5_ERROR(h5_dset_id,
+                                 "Failed to create HDF5 Dataset "
+                                 << rank_counts_path);
+
+        H5Sclose(h5_dspace_id);
+        CONDUIT_CHECK_HDF5_ERROR(H5Dclose(h5_dset_id),
+                                 "Failed to close HDF5 Dataset "
+                                 << rank_counts_path);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// selects a block of a dataset, or nothing if count is zero
+//---------------------------------------------------------------------------//
+static void
+select_block(hid_t h5_dset_id,
+             const std::string &ref_path,
+             int rank,
+             const hsize_t *offset,
+             const hsize_t *count,
+             hid_t &h5_fspace_id,
+             hid_t &h5_mspace_id)
+{
+    h5_fspace_id = H5Dget_space(h5_dset_id);
+    CONDUIT_CHECK_HDF5_ERROR(h5_fspace_id,
+                             "Failed to get HDF5 Dataspace for "
+                             << ref_path);
+
+    hsize_t num_eles = 1;
+    for(int i = 0; i < rank; i++)
+    {
+        num_eles *= count[i];
+    }
+    h5_mspace_id = H5Screate_simple(1, &num_eles, NULL);
+
+    if(num_eles > 0)
+    {
+        CONDUIT_CHECK_HDF5_ERROR(H5Sselect_hyperslab(h5_fspace_id,
+                                                     H5S_SELECT_SET,
+                                                     offset,
+                                                     NULL,
+                                                     count,
+                                                     NULL),
+                                 "Failed to select HDF5 hyperslab for "
+                                 << ref_path);
+    }
+    else
+    {
+        H5Sselect_none(h5_fspace_id);
+        H5Sselect_none(h5_mspace_id);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// selects this rank's portion of a leaf's dataset
+//---------------------------------------------------------------------------//
+static void
+select_rank_portion(const SharedLeafLayout &entry,
+                    hid_t h5_dset_id,
+                    hid_t &h5_fspace_id,
+                    hid_t &h5_mspace_id)
+{
+    hsize_t offset = (hsize_t) entry.offset;
+    hsize_t count  = entry.count > 0 ? (hsize_t) entry.count : 0;
+    select_block(h5_dset_id, entry.path, 1, &offset, &count,
+                 h5_fspace_id, h5_mspace_id);
+}
+
+//---------------------------------------------------------------------------//
+// writes (or reads) this rank's row of the rank counts dataset
+//---------------------------------------------------------------------------//
+static void
+transfer_rank_counts(hid_t h5_file_id,
+                     int rank,
+                     hid_t h5_dxpl_id,
+                     std::vector<int64> &counts,
+                     bool write)
+{
+    hid_t h5_dset_id = H5Dopen(h5_file_id,
+                               rank_counts_path.c_str(),
+                               H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR(h5_dset_id,
+                             "Failed to open HDF5 Dataset "
+                             << rank_counts_path);
+
+    hsize_t offset[2] = { (hsize_t) rank, 0 };
+    hsize_t count[2]  = { 1, (hsize_t) counts.size() };
+    hid_t h5_fspace_id = -1;
+    hid_t h5_mspace_id = -1;
+    select_block(h5_dset_id, rank_counts_path, 2, offset, count,
+                 h5_fspace_id, h5_mspace_id);
+
+    herr_t h5_status = -1;
+    if(write)
+    {
+        h5_status = H5Dwrite(h5_dset_id,
+                             H5T_NATIVE_INT64,
+                             h5_mspace_id,
+                             h5_fspace_id,
+                             h5_dxpl_id,
+                             &counts[0]);
+    }
+    else
+    {
+        h5_status = H5Dread(h5_dset_id,
+                            H5T_NATIVE_INT64,
+                            h5_mspace_id,
+                            h5_fspace_id,
+                            h5_dxpl_id,
+                            &counts[0]);
+    }
+
+    H5Sclose(h5_mspace_id);
+    H5Sclose(h5_fspace_id);
+    H5Dclose(h5_dset_id);
+
+    CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                             "Failed to transfer HDF5 Dataset "
+                             << rank_counts_path);
+}
+
+//---------------------------------------------------------------------------//
+// writes this rank's leaves and counts. With collective transfers all 
+// ranks must take part in the writes for every dataset.
+//---------------------------------------------------------------------------//
+static void
+write_rank_leaves(hid_t h5_file_id,
+                  const std::vector<SharedLeafLayout> &layout,
+                  const std::map<std::string,const Node*> &leaves,
+                  int rank,
+                  hid_t h5_dxpl_id,
+                  bool collective)
+{
+    for(size_t i = 0; i < layout.size(); i++)
+    {
+        const SharedLeafLayout &entry = layout[i];
+
+        if(!collective && entry.count <= 0)
+        {
+            continue;
+        }
+
+        hid_t h5_dset_id = H5Dopen(h5_file_id,
+                                   entry.path.c_str(),
+                                   H5P_DEFAULT);
+        CONDUIT_CHECK_HDF5_ERROR(h5_dset_id,
+                                 "Failed to open HDF5 Dataset "
+                                 << entry.path);
+
+        hid_t h5_fspace_id = -1;
+        hid_t h5_mspace_id = -1;
+        select_rank_portion(entry, h5_dset_id, h5_fspace_id, h5_mspace_id);
+
+        // use the leaf's type (for its endianness) when we have data.
+        // note: these are predefined HDF5 types, which are not closed
+        const void *data_ptr = NULL;
+        Node n_compact;
+        hid_t h5_dtype_id = -1;
+
+        std::map<std::string,const Node*>::const_iterator l_itr;
+        l_itr = leaves.find(entry.path);
+        if(entry.count > 0 && l_itr != leaves.end())
+        {
+            const Node &leaf = *l_itr->second;
+            h5_dtype_id = relay::io::conduit_dtype_to_hdf5_dtype(leaf.dtype(),
+                                                                 entry.path);
+            if(leaf.dtype().is_compact())
+            {
+                data_ptr = leaf.data_ptr();
+            }
+            else
+            {
+                leaf.compact_to(n_compact);
+                data_ptr = n_compact.data_ptr();
+            }
+        }
+        else
+        {
+            h5_dtype_id = relay::io::conduit_dtype_to_hdf5_dtype(
+                                            shared_leaf_dtype(entry.dtype_id),
+                                            entry.path);
+        }
+
+        herr_t h5_status = H5Dwrite(h5_dset_id,
+                                    h5_dtype_id,
+                                    h5_mspace_id,
+                                    h5_fspace_id,
+                                    h5_dxpl_id,
+                                    data_ptr);
+
+        H5Sclose(h5_mspace_id);
+        H5Sclose(h5_fspace_id);
+        H5Dclose(h5_dset_id);
+
+        CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                                 "Failed to write to HDF5 Dataset "
+                                 << entry.path);
+    }
+
+    if(!layout.empty())
+    {
+        std::vector<int64> counts(layout.size());
+        for(size_t i = 0; i < layout.size(); i++)
+        {
+            counts[i] = layout[i].count;
+        }
+        transfer_rank_counts(h5_file_id, rank, h5_dxpl_id, counts, true);
+    }
+}
+
+//---------------------------------------------------------------------------//
+static hid_t
+create_shared_file(const std::string &file_path,
+                   hid_t h5_fapl_id)
+{
+    // preserve creation order
+    hid_t h5_file_plist = H5Pcreate(H5P_FILE_CREATE);
+    CONDUIT_CHECK_HDF5_ERROR(h5_file_plist,
+                             "Failed to create H5P_FILE_CREATE property "
+                             << " list");
+
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_link_creation_order(h5_file_plist, 
+                        ( H5P_CRT_ORDER_TRACKED |  H5P_CRT_ORDER_INDEXED) ),
+                             "Failed to set creation order options for "
+                             << "property list");
+
+    hid_t h5_file_id = H5Fcreate(file_path.c_str(),
+                                 H5F_ACC_TRUNC,
+                                 h5_file_plist,
+                                 h5_fapl_id);
+    CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
+                             "Error opening HDF5 file for writing: " 
+                             << file_path);
+
+    H5Pclose(h5_file_plist);
+    return h5_file_id;
+}
+
+//---------------------------------------------------------------------------//
+// H5Lvisit callback used to find the leaf datasets in a shared file
+//---------------------------------------------------------------------------//
+static herr_t
+collect_dataset_paths(hid_t h5_group_id,
+                      const char *name,
+                      const H5L_info_t * /*h5_info*/,
+                      void *data)
+{
+    std::vector<std::string> *paths = (std::vector<std::string>*) data;
+    if(rank_counts_path == name)
+    {
+        return 0;
+    }
+
+    hid_t h5_obj_id = H5Oopen(h5_group_id, name, H5P_DEFAULT);
+    if(h5_obj_id < 0)
+    {
+        return -1;
+    }
+
+    if(H5Iget_type(h5_obj_id) == H5I_DATASET)
+    {
+        paths->push_back(std::string(name));
+    }
+
+    H5Oclose(h5_obj_id);
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+// reads this rank's counts, and checks that the file was written using
+// the same number of ranks
+//---------------------------------------------------------------------------//
+static void
+read_rank_counts(hid_t h5_file_id,
+                 const std::string &file_path,
+                 int rank,
+                 int num_ranks,
+                 hid_t h5_dxpl_id,
+                 size_t num_leaves,
+                 std::vector<int64> &counts)
+{
+    counts.clear();
+
+    if(H5Lexists(h5_file_id, rank_counts_path.c_str(), H5P_DEFAULT) <= 0)
+    {
+        if(num_leaves > 0)
+        {
+            CONDUIT_ERROR("HDF5 file " << file_path << " is missing \""
+                          << rank_counts_path << "\", it was not written "
+                          << "by relay::mpi::io::hdf5_write");
+        }
+        return;
+    }
+
+    hid_t h5_dset_id = H5Dopen(h5_file_id,
+                               rank_counts_path.c_str(),
+                               H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR(h5_dset_id,
+                             "Failed to open HDF5 Dataset "
+                             << rank_counts_path);
+
+    hid_t h5_dspace_id = H5Dget_space(h5_dset_id);
+    hsize_t dims[2] = {0, 0};
+    int ndims = H5Sget_simple_extent_ndims(h5_dspace_id);
+    if(ndims == 2)
+    {
+        H5Sget_simple_extent_dims(h5_dspace_id, dims, NULL);
+    }
+    H5Sclose(h5_dspace_id);
+    H5Dclose(h5_dset_id);
+
+    if(ndims != 2 || dims[1] != (hsize_t) num_leaves)
+    {
+        CONDUIT_ERROR("HDF5 file " << file_path << " has an invalid \""
+                      << rank_counts_path << "\" dataset");
+    }
+
+    if(dims[0] != (hsize_t) num_ranks)
+    {
+        CONDUIT_ERROR("HDF5 file " << file_path << " was written by "
+                      << dims[0] << " ranks, cannot read with "
+                      << num_ranks << " ranks");
+    }
+
+    counts.resize(num_leaves,-1);
+    transfer_rank_counts(h5_file_id, rank, h5_dxpl_id, counts, false);
+}
+
+//---------------------------------------------------------------------------//
+// reads the "conduit_leaf_index" attribute of a leaf dataset
+//---------------------------------------------------------------------------//
+static int64
+read_leaf_index(hid_t h5_dset_id,
+                const std::string &ref_path,
+                size_t num_leaves)
+{
+    hid_t h5_attr_id = H5Aopen(h5_dset_id,
+                               "conduit_leaf_index",
+                               H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR(h5_attr_id,
+                             "HDF5 Dataset " << ref_path 
+                             << " is missing \"conduit_leaf_index\", "
+                             << "it was not written by "
+                             << "relay::mpi::io::hdf5_write");
+
+    int64 leaf_index = -1;
+    herr_t h5_status = H5Aread(h5_attr_id, H5T_NATIVE_INT64, &leaf_index);
+    H5Aclose(h5_attr_id);
+    CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                             "Failed to read HDF5 Attribute for "
+                             << ref_path);
+
+    if(leaf_index < 0 || leaf_index >= (int64) num_leaves)
+    {
+        CONDUIT_ERROR("HDF5 Dataset " << ref_path << " has an invalid "
+                      "\"conduit_leaf_index\": " << leaf_index);
+    }
+
+    return leaf_index;
+}
+
+
+//---------------------------------------------------------------------------//
+// Public interface
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+void
+hdf5_write(const Node &node,
+           const std::string &file_path,
+           MPI_Comm mpi_comm)
+{
+    if(!node.dtype().is_object())
+    {
+        CONDUIT_ERROR("relay::mpi::io::hdf5_write requires an Object node");
+    }
+
+    int m_size = mpi::size(mpi_comm);
+    int m_rank = mpi::rank(mpi_comm);
+
+    std::vector<std::string> leaf_paths;
+    std::vector<const Node*> leaves;
+    collect_leaves(node, "", leaf_paths, leaves);
+
+    std::vector<SharedLeafLayout> layout;
+    agree_on_shared_layout(leaf_paths, leaves, mpi_comm, layout);
+
+    std::map<std::string,const Node*> leaves_map;
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        leaves_map[leaf_paths[i]] = leaves[i];
+    }
+
+#ifdef H5_HAVE_PARALLEL
+    // all ranks create the file and datasets, then write collectively 
+    hid_t h5_fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_fapl_mpio(h5_fapl_id,
+                                              mpi_comm,
+                                              MPI_INFO_NULL),
+                             "Failed to set HDF5 MPI-IO file access");
+
+    hid_t h5_file_id = create_shared_file(file_path, h5_fapl_id);
+    H5Pclose(h5_fapl_id);
+
+    create_shared_datasets(h5_file_id, layout, m_size);
+
+    hid_t h5_dxpl_id = H5Pcreate(H5P_DATASET_XFER);
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_dxpl_mpio(h5_dxpl_id,
+                                              H5FD_MPIO_COLLECTIVE),
+                             "Failed to set HDF5 collective transfer");
+
+    write_rank_leaves(h5_file_id, layout, leaves_map, m_rank,
+                      h5_dxpl_id, true);
+
+    H5Pclose(h5_dxpl_id);
+    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
+                             "Error closing HDF5 file: " << file_path);
+#else
+    // without parallel HDF5, rank 0 creates the file and datasets, and
+    // ranks write their portions in turn. The token passed along carries
+    // whether all prior ranks succeeded, so a rank after a failure skips
+    // its write, and the failure is then reported on all ranks. 
+    int ok = 1;
+    std::string err_msg;
+    if(m_rank > 0)
+    {
+        MPI_Recv(&ok, 1, MPI_INT, m_rank - 1, 0, mpi_comm, MPI_STATUS_IGNORE);
+    }
+
+    if(ok)
+    {
+        hid_t h5_file_id = -1;
+        try
+        {
+            if(m_rank == 0)
+            {
+                h5_file_id = create_shared_file(file_path, H5P_DEFAULT);
+                create_shared_datasets(h5_file_id, layout, m_size);
+            }
+            else
+            {
+                h5_file_id = H5Fopen(file_path.c_str(),
+                                     H5F_ACC_RDWR,
+                                     H5P_DEFAULT);
+                CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
+                                         "Error opening HDF5 file for "
+                                         "writing: " << file_path);
+            }
+
+            write_rank_leaves(h5_file_id, layout, leaves_map, m_rank,
+                              H5P_DEFAULT, false);
+        }
+        catch(conduit::Error &e)
+        {
+            ok = 0;
+            err_msg = e.message();
+        }
+
+        if(h5_file_id >= 0 && H5Fclose(h5_file_id) < 0 && ok)
+        {
+            ok = 0;
+            err_msg = "Error closing HDF5 file: " + file_path;
+        }
+    }
+
+    if(m_rank < m_size - 1)
+    {
+        MPI_Send(&ok, 1, MPI_INT, m_rank + 1, 0, mpi_comm);
+    }
+
+    err_msg = agree_on_error(err_msg, mpi_comm);
+    if(!err_msg.empty())
+    {
+        CONDUIT_ERROR(err_msg);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read(const std::string &file_path,
+          Node &node,
+          MPI_Comm mpi_comm)
+{
+    int m_size = mpi::size(mpi_comm);
+    int m_rank = mpi::rank(mpi_comm);
+
+    hid_t h5_fapl_id  = H5P_DEFAULT;
+    hid_t h5_dxpl_id  = H5P_DEFAULT;
+    bool  collective  = false;
+#ifdef H5_HAVE_PARALLEL
+    h5_fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_fapl_mpio(h5_fapl_id,
+                                              mpi_comm,
+                                              MPI_INFO_NULL),
+                             "Failed to set HDF5 MPI-IO file access");
+    h5_dxpl_id = H5Pcreate(H5P_DATASET_XFER);
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_dxpl_mpio(h5_dxpl_id,
+                                              H5FD_MPIO_COLLECTIVE),
+                             "Failed to set HDF5 collective transfer");
+    collective = true;
+#endif
+
+    node.reset();
+
+    // errors are agreed on by all ranks before they throw, so a failure
+    // on one rank doesn't leave the others waiting in a collective
+    hid_t h5_file_id = -1;
+    std::vector<std::string> paths;
+    std::vector<int64> counts;
+    std::string err_msg;
+
+    try
+    {
+        h5_file_id = H5Fopen(file_path.c_str(),
+                             H5F_ACC_RDONLY,
+                             h5_fapl_id);
+        CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
+                                 "Error opening HDF5 file for reading: " 
+                                 << file_path);
+
+        CONDUIT_CHECK_HDF5_ERROR(H5Lvisit(h5_file_id,
+                                          H5_INDEX_CRT_ORDER,
+                                          H5_ITER_INC,
+                                          collect_dataset_paths,
+                                          &paths),
+                                 "Error traversing HDF5 file: " 
+                                 << file_path);
+
+        read_rank_counts(h5_file_id, file_path, m_rank, m_size, 
+                         h5_dxpl_id, paths.size(), counts);
+    }
+    catch(conduit::Error &e)
+    {
+        err_msg = e.message();
+    }
+
+    err_msg = agree_on_error(err_msg, mpi_comm);
+
+    if(err_msg.empty())
+    {
+        std::vector<int64> offsets;
+        std::vector<int64> totals;
+        compute_shared_offsets(counts, mpi_comm, offsets, totals);
+
+        try
+        {
+            for(size_t i = 0; i < paths.size(); i++)
+            {
+                hid_t h5_dset_id = H5Dopen(h5_file_id,
+                                           paths[i].c_str(),
+                                           H5P_DEFAULT);
+                CONDUIT_CHECK_HDF5_ERROR(h5_dset_id,
+                                         "Failed to open HDF5 Dataset "
+                                         << paths[i]);
+
+                int64 leaf_index = read_leaf_index(h5_dset_id,
+                                                   paths[i],
+                                                   paths.size());
+
+                SharedLeafLayout entry;
+                entry.path   = paths[i];
+                entry.count  = counts[leaf_index];
+                entry.offset = offsets[leaf_index];
+                entry.total  = totals[leaf_index];
+
+                herr_t h5_status = 0;
+                if(entry.count >= 0 || collective)
+                {
+                    hid_t h5_fspace_id = -1;
+                    hid_t h5_mspace_id = -1;
+                    select_rank_portion(entry, h5_dset_id,
+                                        h5_fspace_id, h5_mspace_id);
+
+                    hid_t h5_dtype_id = H5Dget_type(h5_dset_id);
+                    void *data_ptr = NULL;
+                    if(entry.count >= 0)
+                    {
+                        DataType dt = relay::io::hdf5_dtype_to_conduit_dtype(
+                                                                h5_dtype_id,
+                                                                entry.count,
+                                                                paths[i]);
+                        Node &leaf = node.fetch(paths[i]);
+                        leaf.set(dt);
+                        data_ptr = leaf.data_ptr();
+                    }
+
+                    h5_status = H5Dread(h5_dset_id,
+                                        h5_dtype_id,
+                                        h5_mspace_id,
+                                        h5_fspace_id,
+                                        h5_dxpl_id,
+                                        data_ptr);
+
+                    H5Tclose(h5_dtype_id);
+                    H5Sclose(h5_mspace_id);
+                    H5Sclose(h5_fspace_id);
+                }
+
+                H5Dclose(h5_dset_id);
+                CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                                         "Failed to read HDF5 Dataset "
+                                         << paths[i]);
+            }
+        }
+        catch(conduit::Error &e)
+        {
+            err_msg = e.message();
+        }
+
+        err_msg = agree_on_error(err_msg, mpi_comm);
+    }
+
+    if(collective)
+    {
+        H5Pclose(h5_dxpl_id);
+        H5Pclose(h5_fapl_id);
+    }
+
+    if(h5_file_id >= 0 && H5Fclose(h5_file_id) < 0 && err_msg.empty())
+    {
+        err_msg = "Error closing HDF5 file: " + file_path;
+    }
+
+    if(!err_msg.empty())
+    {
+        node.reset();
+        CONDUIT_ERROR(err_msg);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::mpi::io --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::mpi --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,145 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_mpi_hdf5.hpp
+///
+//-----------------------------------------------------------------------------
+
+
+#ifndef CONDUIT_RELAY_MPI_HDF5_HPP
+#define CONDUIT_RELAY_MPI_HDF5_HPP
+
+//-----------------------------------------------------------------------------
+// external lib includes
+//-----------------------------------------------------------------------------
+#include <mpi.h>
+
+//-----------------------------------------------------------------------------
+// conduit includes
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_relay_exports.h"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::mpi --
+//-----------------------------------------------------------------------------
+namespace mpi
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::mpi::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+//-----------------------------------------------------------------------------
+/// Collective HDF5 I/O of a Node distributed across the ranks of a 
+/// communicator, using a single shared file.
+///
+/// hdf5_write agrees on the union of the leaf paths of all ranks. Each 
+/// leaf path becomes one 1D dataset that holds the concatenation of that 
+/// leaf from all ranks, in rank order. Ranks may have different sized 
+/// leaves or omit leaves, but a leaf path must use the same type on all
+/// ranks that provide it. Each rank's offset in a dataset comes from an
+/// exclusive scan of the ranks' element counts. The per rank element 
+/// counts (-1 for ranks without the leaf) are stored in a 
+/// "conduit_rank_counts" dataset (one row per rank, one column per leaf),
+/// each leaf dataset records its column in a "conduit_leaf_index" 
+/// attribute. The "conduit_rank_counts" path is reserved.
+///
+/// hdf5_read reads each rank's portion back, it requires a communicator
+/// with the same number of ranks used to write the file. Errors are 
+/// reported on all ranks.
+///
+/// When HDF5 is built with parallel support, the file is opened with the
+/// MPI-IO driver and leaves are written and read with collective 
+/// hyperslab selections. Otherwise, ranks write their portions in turn.
+///
+/// Note: Like the serial HDF5 I/O, List nodes are not supported. Empty 
+/// leaves are not written.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_write(const Node &node,
+                                  const std::string &file_path,
+                                  MPI_Comm mpi_comm);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read(const std::string &file_path,
+                                 Node &node,
+                                 MPI_Comm mpi_comm);
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::mpi::io --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::mpi --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+
+#endif
@@ -52,6 +52,11 @@
 // std lib includes
 //-----------------------------------------------------------------------------
 #include <string.h>
+#include <deque>
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+#include <pthread.h>
+#endif
 
 //-----------------------------------------------------------------------------
 // external lib includes
@@ -226,6 +231,7 @@ public:
             m_server->lock_context();
             {
                 ws = new WebSocket();
+                ws->set_queue_depth(m_server->websocket_queue_depth());
                 ws->set_connection(conn);
                 m_sockets.push_back(ws);
             }
@@ -421,6 +427,42 @@ public:
             return res;
         }
 
+        //---------------------------------------------------------------------------//
+        // stops the writer threads of all websockets
+        //---------------------------------------------------------------------------//
+        void
+        stop_websocket_writers()
+        {
+            m_server->lock_context();
+            {
+                for(size_t i=0; i < m_sockets.size(); i++)
+                {
+                    m_sockets[i]->stop_writer();
+                }
+            }
+            m_server->unlock_context();
+        }
+
+        //---------------------------------------------------------------------------//
+        // returns the active websockets
+        //---------------------------------------------------------------------------//
+        void
+        active_websockets(std::vector<WebSocket*> &res)
+        {
+            res.clear();
+            m_server->lock_context();
+            {
+                for(size_t i=0; i < m_sockets.size(); i++)
+                {
+                    if(m_sockets[i]->is_connected())
+                    {
+                        res.push_back(m_sockets[i]);
+                    }
+                }
+            }
+            m_server->unlock_context();
+        }
+
         //---------------------------------------------------------------------------//
         // waits for a new websocket connection
         //---------------------------------------------------------------------------//
@@ -477,13 +519,535 @@ public:
       std::vector<WebSocket*>     m_sockets;
 };
 
+//-----------------------------------------------------------------------------
+// DeltaEncoder Class Implementation
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+DeltaEncoder::DeltaEncoder()
+: m_has_state(false),
+  m_schema_hash(0)
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+DeltaEncoder::~DeltaEncoder()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+DeltaEncoder::reset()
+{
+    m_has_state   = false;
+    m_schema_hash = 0;
+    m_leaf_hashes.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+DeltaEncoder::hash_leaves(const Node &node,
+                          std::vector<uint64> &hashes) const
+{
+    index_t nchildren = node.number_of_children();
+    if(nchildren > 0)
+    {
+        for(index_t i=0; i < nchildren; i++)
+        {
+            hash_leaves(node.child(i),hashes);
+        }
+        return;
+    }
+
+    const DataType &dt = node.dtype();
+    index_t nbytes = dt.number_of_elements() * dt.element_bytes();
+
+    if(dt.is_empty() || nbytes == 0 || 
+       dt.id() == DataType::OBJECT_ID || 
+       dt.id() == DataType::LIST_ID)
+    {
+        hashes.push_back(0);
+    }
+    else if(dt.is_compact())
+    {
+        hashes.push_back(utils::hash_bytes(node.element_ptr(0),nbytes));
+    }
+    else
+    {
+        Node n_compact;
+        node.compact_to(n_compact);
+        hashes.push_back(utils::hash_bytes(n_compact.data_ptr(),nbytes));
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+DeltaEncoder::add_changed_leaves(const Node &node,
+                                 const std::vector<uint64> &hashes,
+                                 index_t &leaf_idx,
+                                 std::vector<uint64> &changed,
+                                 Node &changed_data) const
+{
+    index_t nchildren = node.number_of_children();
+    if(nchildren > 0)
+    {
+        for(index_t i=0; i < nchildren; i++)
+        {
+            add_changed_leaves(node.child(i),
+                               hashes,
+                               leaf_idx,
+                               changed,
+                               changed_data);
+        }
+        return;
+    }
+
+    size_t idx = (size_t)leaf_idx;
+    if(hashes[idx] != m_leaf_hashes[idx])
+    {
+        changed.push_back((uint64)leaf_idx);
+        // the message is only read while encoding
+        changed_data.append().set_external(const_cast<Node&>(node));
+    }
+    leaf_idx++;
+}
+
+//-----------------------------------------------------------------------------
+bool
+DeltaEncoder::encode(const Node &data,
+                     std::vector<uint8> &msg)
+{
+    // the layout is compared via the binary encoding of the compact schema
+    Schema s_compact;
+    data.schema().compact_to(s_compact);
+    std::vector<uint8> schema_data;
+    s_compact.serialize(schema_data);
+    uint64 schema_hash = utils::hash_bytes(&schema_data[0],
+                                           (index_t)schema_data.size());
+
+    std::vector<uint64> hashes;
+    hash_leaves(data,hashes);
+
+    Node n_msg;
+    if(!m_has_state || schema_hash != m_schema_hash)
+    {
+        n_msg["delta"] = (uint8)0;
+        n_msg["data"].set_external(const_cast<Node&>(data));
+    }
+    else
+    {
+        std::vector<uint64> changed;
+        Node changed_data;
+        index_t leaf_idx = 0;
+        add_changed_leaves(data,hashes,leaf_idx,changed,changed_data);
+
+        if(changed.empty())
+        {
+            return false;
+        }
+
+        n_msg["delta"] = (uint8)1;
+        n_msg["leaves"].set(changed);
+        n_msg["data"].set_external(changed_data);
+    }
+
+    n_msg.serialize_sbin(msg);
+
+    m_has_state   = true;
+    m_schema_hash = schema_hash;
+    m_leaf_hashes.swap(hashes);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// WebSocketSendQueue Class Implementation
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+// an encoded websocket message
+//---------------------------------------------------------------------------//
+struct WebSocketFrame
+{
+    int                 opcode;
+    bool                delta;
+    std::vector<uint8>  data;
+};
+
+//---------------------------------------------------------------------------//
+// bounded queue of frames, written to a connection by a writer thread
+//---------------------------------------------------------------------------//
+class WebSocketSendQueue
+{
+public:
+                WebSocketSendQueue();
+               ~WebSocketSendQueue();
+
+    // starts the writer thread for connection
+    void        start(mg_connection *connection);
+    // drops any queued frames and joins the writer thread
+    void        stop();
+
+    // drops frames until there is room for one more, returns true if
+    // a delta frame was dropped since the last call (here or in push)
+    bool        make_room();
+    // queues a frame, swaps out msg
+    void        push(int opcode,
+                     std::vector<uint8> &msg,
+                     bool delta);
+
+    void        set_depth(index_t depth);
+    index_t     depth() const;
+    index_t     number_of_frames() const;
+    void        stats(Node &stats) const;
+
+private:
+    void        lock() const;
+    void        unlock() const;
+    // drops the oldest frame, or all frames if any are delta frames
+    bool        drop_frames();
+    // writes a frame, returns false if the connection failed 
+    bool        write(mg_connection *connection,
+                      const WebSocketFrame &frame);
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    static void *writer_main(void *queue);
+    void         writer_loop();
+#endif
+
+    mg_connection              *m_connection;
+    index_t                     m_depth;
+    std::deque<WebSocketFrame>  m_frames;
+    bool                        m_failed;
+    // set when a delta frame is dropped, the next delta must be full
+    bool                        m_delta_dropped;
+
+    // stats
+    index_t                     m_max_frames;
+    index_t                     m_frames_sent;
+    index_t                     m_bytes_sent;
+    index_t                     m_frames_dropped;
+    index_t                     m_write_errors;
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    pthread_t                   m_thread;
+    mutable pthread_mutex_t     m_mutex;
+    // signaled when a frame is queued or on stop
+    pthread_cond_t              m_cond;
+    bool                        m_running;
+#endif
+};
+
+//---------------------------------------------------------------------------//
+WebSocketSendQueue::WebSocketSendQueue()
+: m_connection(NULL),
+  m_depth(4),
+  m_failed(false),
+  m_delta_dropped(false),
+  m_max_frames(0),
+  m_frames_sent(0),
+  m_bytes_sent(0),
+  m_frames_dropped(0),
+  m_write_errors(0)
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    m_running = false;
+    pthread_mutex_init(&m_mutex,NULL);
+    pthread_cond_init(&m_cond,NULL);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+WebSocketSendQueue::~WebSocketSendQueue()
+{
+    stop();
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    pthread_cond_destroy(&m_cond);
+    pthread_mutex_destroy(&m_mutex);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+void
+WebSocketSendQueue::lock() const
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    pthread_mutex_lock(&m_mutex);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+void
+WebSocketSendQueue::unlock() const
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    pthread_mutex_unlock(&m_mutex);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+void
+WebSocketSendQueue::start(mg_connection *connection)
+{
+    stop();
+
+    lock();
+    m_connection    = connection;
+    m_failed        = false;
+    m_delta_dropped = false;
+    unlock();
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    m_running = true;
+    if(pthread_create(&m_thread,
+                      NULL,
+                      WebSocketSendQueue::writer_main,
+                      this) != 0)
+    {
+        m_running = false;
+        CONDUIT_ERROR("WebSocket: failed to start writer thread");
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+void
+WebSocketSendQueue::stop()
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    lock();
+    bool running = m_running;
+    m_running = false;
+    pthread_cond_signal(&m_cond);
+    unlock();
+
+    if(running)
+    {
+        pthread_join(m_thread,NULL);
+    }
+#endif
+
+    lock();
+    // frames can't be sent once the connection is gone
+    m_frames_dropped += (index_t)m_frames.size();
+    m_frames.clear();
+    m_connection = NULL;
+    unlock();
+}
+
+//---------------------------------------------------------------------------//
+bool
+WebSocketSendQueue::drop_frames()
+{
+    bool has_delta = false;
+    for(size_t i=0; i < m_frames.size() && !has_delta; i++)
+    {
+        has_delta = m_frames[i].delta;
+    }
+
+    if(has_delta)
+    {
+        // later deltas are meaningless without the dropped one
+        m_frames_dropped += (index_t)m_frames.size();
+        m_frames.clear();
+        m_delta_dropped = true;
+    }
+    else if(!m_frames.empty())
+    {
+        m_frames_dropped++;
+        m_frames.pop_front();
+    }
+
+    return has_delta;
+}
+
+//---------------------------------------------------------------------------//
+bool
+WebSocketSendQueue::make_room()
+{
+    lock();
+    while((index_t)m_frames.size() >= m_depth && !m_frames.empty())
+    {
+        drop_frames();
+    }
+    bool res = m_delta_dropped;
+    m_delta_dropped = false;
+    unlock();
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+WebSocketSendQueue::push(int opcode,
+                         std::vector<uint8> &msg,
+                         bool delta)
+{
+    lock();
+
+    if(m_connection == NULL || m_failed)
+    {
+        m_frames_dropped++;
+        unlock();
+        return;
+    }
+
+    while((index_t)m_frames.size() >= m_depth && !m_frames.empty())
+    {
+        drop_frames();
+    }
+
+    m_frames.push_back(WebSocketFrame());
+    WebSocketFrame &frame = m_frames.back();
+    frame.opcode = opcode;
+    frame.delta  = delta;
+    frame.data.swap(msg);
+
+    if((index_t)m_frames.size() > m_max_frames)
+    {
+        m_max_frames = (index_t)m_frames.size();
+    }
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    pthread_cond_signal(&m_cond);
+    unlock();
+#else
+    // no writer thread, write in the calling thread
+    mg_connection *connection = m_connection;
+    WebSocketFrame wframe;
+    wframe.opcode = frame.opcode;
+    wframe.data.swap(frame.data);
+    m_frames.pop_front();
+    unlock();
+    write(connection,wframe);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+bool
+WebSocketSendQueue::write(mg_connection *connection,
+                          const WebSocketFrame &frame)
+{
+    const char *data = frame.data.empty() ? "" :
+                                            (const char*)&frame.data[0];
+    // mg_websocket_write locks the connection, so we don't need the 
+    // server wide context lock here
+    int res = mg_websocket_write(connection,
+                                 frame.opcode,
+                                 data,
+                                 frame.data.size());
+
+    lock();
+    if(res > 0)
+    {
+        m_frames_sent++;
+        m_bytes_sent += (index_t)frame.data.size();
+    }
+    else
+    {
+        // the client is gone or stuck, stop writing to it
+        m_write_errors++;
+        m_failed = true;
+        m_frames_dropped += (index_t)m_frames.size() + 1;
+        m_frames.clear();
+    }
+    unlock();
+
+    return res > 0;
+}
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+//---------------------------------------------------------------------------//
+void *
+WebSocketSendQueue::writer_main(void *queue)
+{
+    static_cast<WebSocketSendQueue*>(queue)->writer_loop();
+    return NULL;
+}
+
+//---------------------------------------------------------------------------//
+void
+WebSocketSendQueue::writer_loop()
+{
+    while(true)
+    {
+        lock();
+        while(m_frames.empty() && m_running)
+        {
+            pthread_cond_wait(&m_cond,&m_mutex);
+        }
+
+        if(!m_running)
+        {
+            unlock();
+            return;
+        }
+
+        WebSocketFrame frame;
+        frame.opcode = m_frames.front().opcode;
+        frame.data.swap(m_frames.front().data);
+        m_frames.pop_front();
+        mg_connection *connection = m_connection;
+        unlock();
+
+        write(connection,frame);
+    }
+}
+#endif
+
+//---------------------------------------------------------------------------//
+void
+WebSocketSendQueue::set_depth(index_t depth)
+{
+    lock();
+    m_depth = depth < 1 ? 1 : depth;
+    unlock();
+}
+
+//---------------------------------------------------------------------------//
+index_t
+WebSocketSendQueue::depth() const
+{
+    lock();
+    index_t res = m_depth;
+    unlock();
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+WebSocketSendQueue::number_of_frames() const
+{
+    lock();
+    index_t res = (index_t)m_frames.size();
+    unlock();
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+WebSocketSendQueue::stats(Node &stats) const
+{
+    lock();
+    stats["connected"]        = (int64)(m_connection != NULL && !m_failed);
+    stats["queued"]           = (int64)m_frames.size();
+    stats["queue_depth"]      = (int64)m_depth;
+    stats["max_queued"]       = (int64)m_max_frames;
+    stats["messages_sent"]    = (int64)m_frames_sent;
+    stats["bytes_sent"]       = (int64)m_bytes_sent;
+    stats["messages_dropped"] = (int64)m_frames_dropped;
+    stats["write_errors"]     = (int64)m_write_errors;
+    unlock();
+}
+
 //-----------------------------------------------------------------------------
 // WebSocket Class Implementation
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
 WebSocket::WebSocket()
-: m_connection(NULL)
+: m_connection(NULL),
+  m_queue(new WebSocketSendQueue())
 {
     // empty
 }
@@ -492,7 +1056,8 @@ WebSocket::WebSocket()
 //-----------------------------------------------------------------------------
 WebSocket::~WebSocket()
 {
-    // empty
+    // joins the writer thread
+    delete m_queue;
 }
 
 
@@ -501,6 +1066,69 @@ void
 WebSocket::set_connection(mg_connection *connection)
 {
     m_connection = connection;
+
+    if(connection != NULL)
+    {
+        // a new client has no prior state to apply deltas to
+        m_delta_encoder.reset();
+        m_queue->start(connection);
+    }
+    else
+    {
+        m_queue->stop();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::stop_writer()
+{
+    m_queue->stop();
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::set_queue_depth(index_t depth)
+{
+    m_queue->set_depth(depth);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+WebSocket::queue_depth() const
+{
+    return m_queue->depth();
+}
+
+//-----------------------------------------------------------------------------
+index_t
+WebSocket::number_of_queued_messages() const
+{
+    return m_queue->number_of_frames();
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::stats(Node &stats) const
+{
+    stats.reset();
+    m_queue->stats(stats);
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::queue_message(int opcode,
+                         std::vector<uint8> &msg,
+                         bool delta)
+{
+    m_queue->push(opcode,msg,delta);
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::reset_delta()
+{
+    m_delta_encoder.reset();
 }
 
 //-----------------------------------------------------------------------------
@@ -545,6 +1173,32 @@ WebSocket::unlock_context()
     }
 }
 
+//-----------------------------------------------------------------------------
+// encodes data for the non-delta protocols, returns the websocket opcode
+//-----------------------------------------------------------------------------
+static int
+encode_websocket_message(const Node &data,
+                         const std::string &protocol,
+                         std::vector<uint8> &msg)
+{
+    // "conduit_sbin" is sent as a single binary frame 
+    // (see Node::serialize_sbin)
+    if(protocol == "conduit_sbin")
+    {
+        data.serialize_sbin(msg);
+        return WEBSOCKET_OPCODE_BINARY;
+    }
+
+    // convert our node to json using the requested conduit protocol
+    std::ostringstream oss;
+    data.to_json_stream(oss,protocol);
+    
+    // str() returns a copy, so only fetch it once
+    const std::string json = oss.str();
+    msg.assign(json.begin(),json.end());
+    return WEBSOCKET_OPCODE_TEXT;
+}
+
 //-----------------------------------------------------------------------------
 void
 WebSocket::send(const Node &data,
@@ -556,22 +1210,29 @@ WebSocket::send(const Node &data,
         return;
     }
 
-    // convert our node to json using the requested conduit protocol
-    std::ostringstream oss;
-    data.to_json_stream(oss,protocol);
-    
-    // get the length of our  message data.
-    size_t        msg_len = oss.str().size();
+    std::vector<uint8> msg;
 
-    lock_context();
+    if(protocol == "conduit_sbin_delta")
     {
-        // send our message via civetweb's websocket interface
-        mg_websocket_write(m_connection,
-                           WEBSOCKET_OPCODE_TEXT,
-                           oss.str().c_str(),
-                           msg_len);
+        // if a delta is dropped the client can't apply the ones after it,
+        // so start over with a full message
+        if(m_queue->make_room())
+        {
+            m_delta_encoder.reset();
+        }
+
+        if(!m_delta_encoder.encode(data,msg))
+        {
+            // nothing changed since the last send
+            return;
+        }
+
+        queue_message(WEBSOCKET_OPCODE_BINARY,msg,true);
+        return;
     }
-    unlock_context();
+
+    int opcode = encode_websocket_message(data,protocol,msg);
+    queue_message(opcode,msg,false);
 }
 
 
@@ -585,6 +1246,7 @@ WebServer::WebServer()
   m_doc_root(""),
   m_address("127.0.0.1"),
   m_port(9000),
+  m_num_threads(8),
   m_ssl_cert_file(""),
   m_htpasswd_auth_domain("localhost"),
   m_htpasswd_auth_file(""),
@@ -592,6 +1254,7 @@ WebServer::WebServer()
   m_entangle_gateway(""),
   m_using_entangle(false),
   m_running(false),
+  m_websocket_queue_depth(4),
   m_server(NULL),
   m_dispatch(NULL)
 {
@@ -667,6 +1330,21 @@ WebServer::set_port(int port)
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+WebServer::set_number_of_threads(int num_threads)
+{
+    if(is_running())
+    {
+        CONDUIT_WARN("Cannot set web server number of threads"
+                        " while server is running");
+    }
+    else
+    {
+        m_num_threads = num_threads < 2 ? 2 : num_threads;
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 void
@@ -834,6 +1512,121 @@ WebServer::websocket(index_t ms_poll,
 }
 
 
+//-----------------------------------------------------------------------------
+index_t
+WebServer::broadcast(const Node &data,
+                     const std::string &protocol)
+{
+    if(m_dispatch == NULL)
+    {
+        return 0;
+    }
+
+    std::vector<WebSocket*> sockets;
+    m_dispatch->active_websockets(sockets);
+
+    if(sockets.empty())
+    {
+        return 0;
+    }
+
+    if(protocol == "conduit_sbin_delta")
+    {
+        // each client has its own delta state
+        for(size_t i=0; i < sockets.size(); i++)
+        {
+            sockets[i]->send(data,protocol);
+        }
+        return (index_t)sockets.size();
+    }
+
+    // encode once, each queue gets a copy
+    std::vector<uint8> msg;
+    int opcode = encode_websocket_message(data,protocol,msg);
+
+    std::vector<uint8> msg_copy;
+    for(size_t i=0; i < sockets.size(); i++)
+    {
+        if(i + 1 < sockets.size())
+        {
+            msg_copy = msg;
+            sockets[i]->queue_message(opcode,msg_copy,false);
+        }
+        else
+        {
+            sockets[i]->queue_message(opcode,msg,false);
+        }
+    }
+
+    return (index_t)sockets.size();
+}
+
+//-----------------------------------------------------------------------------
+void
+WebServer::set_websocket_queue_depth(index_t depth)
+{
+    m_websocket_queue_depth = depth < 1 ? 1 : depth;
+
+    if(m_dispatch != NULL)
+    {
+        std::vector<WebSocket*> sockets;
+        m_dispatch->active_websockets(sockets);
+        for(size_t i=0; i < sockets.size(); i++)
+        {
+            sockets[i]->set_queue_depth(m_websocket_queue_depth);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+index_t
+WebServer::websocket_queue_depth() const
+{
+    return m_websocket_queue_depth;
+}
+
+//-----------------------------------------------------------------------------
+void
+WebServer::websocket_stats(Node &stats)
+{
+    stats.reset();
+    stats["connections"]      = (int64)0;
+    stats["queued"]           = (int64)0;
+    stats["messages_sent"]    = (int64)0;
+    stats["bytes_sent"]       = (int64)0;
+    stats["messages_dropped"] = (int64)0;
+    stats["websockets"].set(DataType::list());
+
+    if(m_dispatch == NULL)
+    {
+        return;
+    }
+
+    std::vector<WebSocket*> sockets;
+    m_dispatch->active_websockets(sockets);
+
+    int64 queued  = 0;
+    int64 sent    = 0;
+    int64 bytes   = 0;
+    int64 dropped = 0;
+
+    for(size_t i=0; i < sockets.size(); i++)
+    {
+        Node &ws_stats = stats["websockets"].append();
+        sockets[i]->stats(ws_stats);
+        queued  += ws_stats["queued"].to_int64();
+        sent    += ws_stats["messages_sent"].to_int64();
+        bytes   += ws_stats["bytes_sent"].to_int64();
+        dropped += ws_stats["messages_dropped"].to_int64();
+    }
+
+    stats["connections"]      = (int64)sockets.size();
+    stats["queued"]           = queued;
+    stats["messages_sent"]    = sent;
+    stats["bytes_sent"]       = bytes;
+    stats["messages_dropped"] = dropped;
+}
+
 //-----------------------------------------------------------------------------
 void
 WebServer::lock_context()
@@ -916,10 +1709,14 @@ WebServer::serve(bool block)
     
     std::string addy_and_port = oss.str();
 
+    std::ostringstream num_threads_oss;
+    num_threads_oss << m_num_threads;
+    std::string num_threads = num_threads_oss.str();
+
     // setup civetweb options
     const char *options[] = { "document_root",   m_doc_root.c_str(),
                               "listening_ports", addy_and_port.c_str(),
-                              "num_threads",     "2",
+                              "num_threads",     num_threads.c_str(),
                                // place holders for ssl, auth domain and 
                                // auth file options
                                NULL, NULL, 
@@ -1050,6 +1847,10 @@ WebServer::shutdown()
         m_running = false;
         m_using_entangle = false;
 
+        // join the websocket writer threads while their 
+        // connections are still valid
+        m_dispatch->stop_websocket_writers();
+
         delete m_server;
         delete m_handler;
         delete m_dispatch;
@@ -151,6 +151,11 @@ public:
     ///   default port:    9000
     void set_port(int port);
 
+    /// the number of civetweb worker threads, each active websocket 
+    /// holds one of these threads
+    ///   default: 8
+    void set_number_of_threads(int num_threads);
+
     /// options for htpasswd authentication 
     ///   defaults: {not used}
     void set_htpasswd_auth_domain(const std::string &domain);
@@ -195,6 +200,28 @@ public:
     WebSocket  *websocket(index_t ms_poll = 100,
                           index_t ms_timeout = 60000);
 
+    /// sends data to all active websockets, returns the number of 
+    /// websockets the message was queued for. 
+    ///
+    /// the message is encoded once and queued for each websocket's 
+    /// writer thread (see WebSocket::send). "conduit_sbin_delta" 
+    /// messages are encoded per websocket.
+    index_t     broadcast(const Node &data,
+                          const std::string &protocol="json");
+
+    /// max number of messages queued per websocket before older
+    /// messages are dropped (default: 4)
+    void        set_websocket_queue_depth(index_t depth);
+    index_t     websocket_queue_depth() const;
+
+    /// websocket send metrics:
+    ///   connections:      number of active websockets
+    ///   queued:           messages waiting to be written
+    ///   messages_sent, bytes_sent, messages_dropped: totals
+    ///   websockets:       list with each active websocket's stats
+    ///                     (see WebSocket::stats)
+    void        websocket_stats(Node &stats);
+
     /// returns the request handler used by this server instance
     WebRequestHandler *handler();
     
@@ -209,6 +236,7 @@ private:
     std::string             m_doc_root;
     std::string             m_address;
     int                     m_port;
+    int                     m_num_threads;
 
     std::string             m_ssl_cert_file;
 
@@ -221,26 +249,108 @@ private:
 
     bool                    m_running;
 
+    index_t                 m_websocket_queue_depth;
+
     CivetServer            *m_server;
     CivetDispatchHandler   *m_dispatch;
 
 };
 
+//-----------------------------------------------------------------------------
+/// -- Delta Encoder for the "conduit_sbin_delta" WebSocket protocol -
+//-----------------------------------------------------------------------------
+///
+/// Encodes a node as a "conduit_sbin" message (see Node::serialize_sbin)
+/// that only carries the leaves that changed since the last encode.
+///
+/// The first message, and any message after the node's layout changes,
+/// is a full message:
+///    delta: 0
+///    data:  the node
+///
+/// Other messages only hold the changed leaves:
+///    delta:  1
+///    leaves: uint64 array, depth first indices of the changed leaves 
+///            (every node without children counts as a leaf)
+///    data:   list with the changed leaves, in the same order
+///
+/// Changes are detected by hashing each leaf's data.
+//-----------------------------------------------------------------------------
+class CONDUIT_RELAY_API DeltaEncoder
+{
+public:
+                   DeltaEncoder();
+                  ~DeltaEncoder();
+
+    /// encodes the next message, returns false (and leaves msg 
+    /// untouched) if nothing changed since the last message.
+    bool           encode(const Node &data,
+                          std::vector<uint8> &msg);
+
+    /// forces the next message to be a full message
+    void           reset();
+
+private:
+    void           hash_leaves(const Node &node,
+                               std::vector<uint64> &hashes) const;
+    void           add_changed_leaves(const Node &node,
+                                      const std::vector<uint64> &hashes,
+                                      index_t &leaf_idx,
+                                      std::vector<uint64> &changed,
+                                      Node &changed_data) const;
+
+    bool                 m_has_state;
+    uint64               m_schema_hash;
+    std::vector<uint64>  m_leaf_hashes;
+};
+
+// forward declare internal send queue class
+class WebSocketSendQueue;
+
 //-----------------------------------------------------------------------------
 /// -- WebSocket Connection Interface -
 //-----------------------------------------------------------------------------
 //
 /// The lifetimes of our WebSocket instances are managed by the 
 /// WebServer and its RequestHandler instance
+///
+/// Each WebSocket has a bounded send queue and a writer thread, so a
+/// slow client does not stall the sending thread. When the queue is
+/// full the oldest message is dropped. If a dropped message is a
+/// "conduit_sbin_delta" message, all queued messages are dropped and
+/// the next delta send carries the full node.
 // 
 class CONDUIT_RELAY_API WebSocket
 {
 public:
     friend class CivetDispatchHandler;
+    friend class WebServer;
     
+    // encodes data and queues it for the writer thread.
+    //
+    // protocol is a conduit json protocol, sent as a text frame, or 
+    // "conduit_sbin", sent as a binary frame (see Node::serialize_sbin)
+    //
+    // "conduit_sbin_delta" sends binary frames with only the leaves that
+    // changed since the last "conduit_sbin_delta" send on this websocket
+    // (see DeltaEncoder), no frame is sent if nothing changed. 
     void           send(const Node &data,
                         const std::string &protocol="json");
 
+    // the next "conduit_sbin_delta" send will send the full node
+    void           reset_delta();
+
+    // max number of queued messages (default: 4)
+    void           set_queue_depth(index_t depth);
+    index_t        queue_depth() const;
+    // number of messages waiting for the writer thread
+    index_t        number_of_queued_messages() const;
+
+    // send metrics:
+    //   connected, queued, queue_depth, max_queued,
+    //   messages_sent, bytes_sent, messages_dropped, write_errors
+    void           stats(Node &stats) const;
+
     // todo: receive? 
 
     bool           is_connected() const;
@@ -254,8 +364,17 @@ private:
     virtual       ~WebSocket();
 
     void           set_connection(mg_connection *connection);
+    // stops the writer thread, used on server shutdown
+    void           stop_writer();
+
+    // queues an encoded message, opcode is a websocket frame opcode
+    void           queue_message(int opcode,
+                                 std::vector<uint8> &msg,
+                                 bool delta);
 
-    mg_connection  *m_connection;
+    mg_connection       *m_connection;
+    DeltaEncoder         m_delta_encoder;
+    WebSocketSendQueue  *m_queue;
 };
 
 
@@ -0,0 +1,345 @@
+/*
+###############################################################################
+# Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+# 
+# Produced at the Lawrence Livermore National Laboratory
+# 
+# LLNL-CODE-666778
+# 
+# All rights reserved.
+# 
+# This file is part of Conduit. 
+# 
+# For details, see: http://software.llnl.gov/conduit/.
+# 
+# Please also read conduit/LICENSE
+# 
+# Redistribution and use in source and binary forms, with or without 
+# modification, are permitted provided that the following conditions are met:
+# 
+# * Redistributions of source code must retain the above copyright notice, 
+#   this list of conditions and the disclaimer below.
+# 
+# * Redistributions in binary form must reproduce the above copyright notice,
+#   this list of conditions and the disclaimer (as noted below) in the
+#   documentation and/or other materials provided with the distribution.
+# 
+# * Neither the name of the LLNS/LLNL nor the names of its contributors may
+#   be used to endorse or promote products derived from this software without
+#   specific prior written permission.
+# 
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+# LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+# DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+# DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+# OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+# HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+# STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+# IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+# POSSIBILITY OF SUCH DAMAGE.
+# 
+###############################################################################
+*/
+
+//-----------------------------------------------------------------------------
+// Decoder for binary "conduit_sbin" messages (see Node::serialize_sbin)
+// and for the "conduit_sbin_delta" websocket protocol (see 
+// relay::web::DeltaEncoder).
+//
+// Decoded nodes are plain js values:
+//   object: {name: child, ...} (in schema order)
+//   list:   [child, ...]
+//   leaf:   {dtype: "float64", number_of_elements: n, value: v}
+//           v is a typed array, or a string for char8_str leaves.
+//           int64 and uint64 values are converted to (float64) numbers.
+//-----------------------------------------------------------------------------
+
+var conduitSbinDTypes = {
+    0:  {name: "empty",     bytes: 0},
+    1:  {name: "object",    bytes: 0},
+    2:  {name: "list",      bytes: 0},
+    3:  {name: "int8",      bytes: 1, array: Int8Array,    get: "getInt8"},
+    4:  {name: "int16",     bytes: 2, array: Int16Array,   get: "getInt16"},
+    5:  {name: "int32",     bytes: 4, array: Int32Array,   get: "getInt32"},
+    6:  {name: "int64",     bytes: 8, array: Float64Array, get: "int64"},
+    7:  {name: "uint8",     bytes: 1, array: Uint8Array,   get: "getUint8"},
+    8:  {name: "uint16",    bytes: 2, array: Uint16Array,  get: "getUint16"},
+    9:  {name: "uint32",    bytes: 4, array: Uint32Array,  get: "getUint32"},
+    10: {name: "uint64",    bytes: 8, array: Float64Array, get: "uint64"},
+    11: {name: "float32",   bytes: 4, array: Float32Array, get: "getFloat32"},
+    12: {name: "float64",   bytes: 8, array: Float64Array, get: "getFloat64"},
+    13: {name: "char8_str", bytes: 1}
+};
+
+// endianness ids: 0 (machine default), 1 (big), 2 (little)
+var conduitSbinLittleEndian = new Uint8Array(new Uint16Array([1]).buffer)[0] === 1;
+
+//-----------------------------------------------------------------------------
+// reads LEB128 varints from a Uint8Array
+//-----------------------------------------------------------------------------
+var ConduitSbinReader = function (bytes, pos, end) {
+    this.bytes = bytes;
+    this.pos   = pos;
+    this.end   = end;
+};
+
+ConduitSbinReader.prototype.varint = function () {
+    var res = 0;
+    var scale = 1;
+    while (true) {
+        if (this.pos >= this.end) {
+            throw new Error("conduit_sbin: truncated binary schema");
+        }
+        var b = this.bytes[this.pos++];
+        res += (b & 0x7f) * scale;
+        if ((b & 0x80) === 0) {
+            return res;
+        }
+        scale *= 128;
+    }
+};
+
+ConduitSbinReader.prototype.svarint = function () {
+    // zigzag decoding
+    var u = this.varint();
+    return (u % 2) ? -(u + 1) / 2 : u / 2;
+};
+
+ConduitSbinReader.prototype.string = function (len) {
+    var res = "";
+    for (var i = 0; i < len; i++) {
+        res += String.fromCharCode(this.bytes[this.pos + i]);
+    }
+    this.pos += len;
+    // names are utf8
+    try {
+        return decodeURIComponent(escape(res));
+    } catch (e) {
+        return res;
+    }
+};
+
+//-----------------------------------------------------------------------------
+// reads a uint64 from a DataView as a number
+//-----------------------------------------------------------------------------
+var conduitSbinReadUint64 = function (view, pos, little) {
+    var lo = view.getUint32(pos + (little ? 0 : 4), little);
+    var hi = view.getUint32(pos + (little ? 4 : 0), little);
+    return hi * 4294967296 + lo;
+};
+
+var conduitSbinReadInt64 = function (view, pos, little) {
+    var lo = view.getUint32(pos + (little ? 0 : 4), little);
+    var hi = view.getInt32(pos + (little ? 4 : 0), little);
+    return hi * 4294967296 + lo;
+};
+
+//-----------------------------------------------------------------------------
+// decodes a leaf's values from the data section
+//-----------------------------------------------------------------------------
+var conduitSbinLeafValue = function (view, data_offset, dt, leaf) {
+    var n = leaf.num_ele;
+    var start = data_offset + leaf.offset;
+
+    if (dt.name === "char8_str") {
+        var str = "";
+        for (var i = 0; i < n; i++) {
+            var c = view.getUint8(start + i * leaf.stride);
+            if (c === 0) {
+                break;
+            }
+            str += String.fromCharCode(c);
+        }
+        return str;
+    }
+
+    var little = (leaf.endianness === 2) ||
+                 (leaf.endianness === 0 && conduitSbinLittleEndian);
+
+    // view the message in place when possible
+    if (dt.array !== Float64Array || dt.name === "float64") {
+        if (little === conduitSbinLittleEndian &&
+            leaf.stride === dt.bytes &&
+            leaf.ele_bytes === dt.bytes &&
+            (view.byteOffset + start) % dt.bytes === 0) {
+            return new dt.array(view.buffer, view.byteOffset + start, n);
+        }
+    }
+
+    var res = new dt.array(n);
+    for (var j = 0; j < n; j++) {
+        var pos = start + j * leaf.stride;
+        if (dt.get === "int64") {
+            res[j] = conduitSbinReadInt64(view, pos, little);
+        } else if (dt.get === "uint64") {
+            res[j] = conduitSbinReadUint64(view, pos, little);
+        } else {
+            res[j] = view[dt.get](pos, little);
+        }
+    }
+    return res;
+};
+
+//-----------------------------------------------------------------------------
+// decodes a schema subtree and its data
+//-----------------------------------------------------------------------------
+var conduitSbinDecodeTree = function (rdr, names, state, view, data_offset) {
+    var dt_id = rdr.varint();
+    var dt = conduitSbinDTypes[dt_id];
+    if (dt === undefined) {
+        throw new Error("conduit_sbin: invalid dtype id " + dt_id);
+    }
+
+    var res, nchld, i;
+
+    if (dt.name === "object") {
+        res = {};
+        nchld = rdr.varint();
+        for (i = 0; i < nchld; i++) {
+            var name = names[rdr.varint()];
+            res[name] = conduitSbinDecodeTree(rdr, names, state, view,
+                                              data_offset);
+        }
+        return res;
+    }
+
+    if (dt.name === "list") {
+        res = [];
+        nchld = rdr.varint();
+        for (i = 0; i < nchld; i++) {
+            res.push(conduitSbinDecodeTree(rdr, names, state, view,
+                                           data_offset));
+        }
+        return res;
+    }
+
+    res = {dtype: dt.name, number_of_elements: 0, value: null};
+
+    if (dt.name !== "empty") {
+        // offsets, strides and element sizes are stored relative to 
+        // a compact layout
+        var leaf = {};
+        leaf.num_ele    = rdr.varint();
+        leaf.offset     = state.next_offset + rdr.svarint();
+        var stride      = rdr.svarint();
+        leaf.ele_bytes  = dt.bytes + rdr.svarint();
+        leaf.endianness = rdr.varint();
+        leaf.stride     = stride + leaf.ele_bytes;
+        state.next_offset = leaf.offset + 
+                            leaf.stride * (leaf.num_ele - 1) + 
+                            leaf.ele_bytes;
+
+        res.number_of_elements = leaf.num_ele;
+        res.value = conduitSbinLeafValue(view, data_offset, dt, leaf);
+    }
+
+    return res;
+};
+
+//-----------------------------------------------------------------------------
+// decodes a "conduit_sbin" message (an ArrayBuffer)
+//-----------------------------------------------------------------------------
+var conduitDecodeSbin = function (buffer) {
+    var bytes = new Uint8Array(buffer);
+    var view  = new DataView(buffer);
+
+    var magic = String.fromCharCode.apply(null, bytes.subarray(0, 8));
+    if (magic !== "CONDSBIN") {
+        throw new Error("conduit_sbin: bad magic");
+    }
+
+    var schema_offset = conduitSbinReadUint64(view, 16, true);
+    var schema_bytes  = conduitSbinReadUint64(view, 24, true);
+    var data_offset   = conduitSbinReadUint64(view, 32, true);
+
+    var rdr = new ConduitSbinReader(bytes, schema_offset,
+                                    schema_offset + schema_bytes);
+    if (bytes[rdr.pos++] !== 1) {
+        throw new Error("conduit_sbin: unsupported binary schema version");
+    }
+
+    var num_names = rdr.varint();
+    var names = [];
+    for (var i = 0; i < num_names; i++) {
+        names.push(rdr.string(rdr.varint()));
+    }
+
+    return conduitSbinDecodeTree(rdr, names, {next_offset: 0}, view,
+                                 data_offset);
+};
+
+//-----------------------------------------------------------------------------
+// Tracks the state sent with the "conduit_sbin_delta" protocol. 
+// receive() applies a message and returns the current node.
+//
+// Plain "conduit_sbin" messages (without a delta child) are returned as
+// is, they are not part of the delta stream so the delta state is kept.
+//-----------------------------------------------------------------------------
+var ConduitDeltaReceiver = function () {
+    this.node   = null;
+    this.leaves = [];
+};
+
+ConduitDeltaReceiver.prototype.receive = function (buffer) {
+    var msg = conduitDecodeSbin(buffer);
+
+    if (msg === null || Array.isArray(msg) || msg.dtype !== undefined ||
+        msg.delta === undefined || msg.data === undefined) {
+        // plain "conduit_sbin" message
+        return msg;
+    }
+
+    var is_delta = msg.delta.value[0] !== 0;
+
+    if (!is_delta) {
+        // full message, rebuild the leaf index
+        this.node   = msg.data;
+        this.leaves = [];
+        conduitSbinCollectLeaves(this.node, this.leaves);
+        return this.node;
+    }
+
+    if (this.node === null) {
+        throw new Error("conduit_sbin_delta: delta before a full message");
+    }
+
+    var idxs = msg.leaves.value;
+    for (var i = 0; i < idxs.length; i++) {
+        var dest = this.leaves[idxs[i]];
+        var src  = msg.data[i];
+        if (dest === undefined || src === undefined) {
+            throw new Error("conduit_sbin_delta: invalid leaf index " +
+                            idxs[i]);
+        }
+        dest.number_of_elements = src.number_of_elements;
+        dest.value = src.value;
+    }
+    return this.node;
+};
+
+//-----------------------------------------------------------------------------
+// collects the nodes without children in depth first order, matching
+// the leaf indices used by relay::web::DeltaEncoder
+//-----------------------------------------------------------------------------
+var conduitSbinCollectLeaves = function (node, leaves) {
+    var has_children = false;
+    if (Array.isArray(node)) {
+        for (var i = 0; i < node.length; i++) {
+            has_children = true;
+            conduitSbinCollectLeaves(node[i], leaves);
+        }
+    } else if (node !== null && node.dtype === undefined) {
+        for (var name in node) {
+            if (node.hasOwnProperty(name)) {
+                has_children = true;
+                conduitSbinCollectLeaves(node[name], leaves);
+            }
+        }
+    }
+    if (!has_children) {
+        leaves.push(node);
+    }
+};
@@ -89,10 +89,21 @@ function websocket_test()
 {
     var wsproto = (location.protocol === 'https:') ? 'wss:' : 'ws:';
     connection = new WebSocket(wsproto + '//' + window.location.host + '/websocket');
+    // binary messages are "conduit_sbin" or "conduit_sbin_delta"
+    connection.binaryType = 'arraybuffer';
+    var delta_receiver = new ConduitDeltaReceiver();
     
     connection.onmessage = function (msg) 
     {
-        console.log('WebSocket message' + msg.data);
+        if (msg.data instanceof ArrayBuffer)
+        {
+            var node = delta_receiver.receive(msg.data);
+            console.log('WebSocket binary message', node);
+        }
+        else
+        {
+            console.log('WebSocket message' + msg.data);
+        }
         connection.send('{"type":"info","message":"response from browser"}');
     }
       
@@ -1180,3 +1180,131 @@ TEST(conduit_blueprint_mesh_verify, mesh_general)
         mesh["topologies"].set(topologies);
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_verify, mesh_deep)
+{
+    Node opts, info;
+    opts["deep"] = 1;
+
+    const std::string mesh_types[] = {"uniform", "rectilinear", "structured",
+                                      "lines", "tris", "quads",
+                                      "quads_and_tris",
+                                      "quads_and_tris_offsets",
+                                      "tets", "hexs", "hexs_and_tets",
+                                      "points"};
+    const index_t num_mesh_types = sizeof(mesh_types) / sizeof(std::string);
+
+    for(index_t i = 0; i < num_mesh_types; i++)
+    {
+        Node mesh;
+        index_t npts_z = mesh_types[i] == "tets" ||
+                         mesh_types[i] == "hexs" ||
+                         mesh_types[i] == "hexs_and_tets" ? 3 : 1;
+        blueprint::mesh::examples::braid(mesh_types[i],5,5,npts_z,mesh);
+        EXPECT_TRUE(blueprint::mesh::verify(mesh,opts,info)) << mesh_types[i];
+    }
+
+    Node mesh;
+    blueprint::mesh::examples::braid("quads",10,10,1,mesh);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,opts,info));
+
+    // out of range connectivity is only found by the deep checks
+    int32_array conn = mesh["topologies/mesh/elements/connectivity"].value();
+    for(index_t i = 0; i < 20; i++)
+    {
+        conn[i*4] = 100 + i;
+    }
+
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info));
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,opts,info));
+    EXPECT_EQ(info["topologies/mesh/valid"].as_string(),"false");
+    // 5 violations and a summary of the rest
+    opts["max_errors"] = 5;
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,opts,info));
+    Node &errs = info["topologies/mesh/errors"];
+    EXPECT_EQ(errs.number_of_children(),6);
+    EXPECT_EQ(errs[0].as_string(),
+              "mesh::topology::unstructured: elements/connectivity[0] = 100"
+              " is out of range [0, 99]");
+    EXPECT_EQ(errs[5].as_string(),
+              "mesh::topology::unstructured: elements/connectivity has 15"
+              " more out of range values");
+
+    // the result does not depend on the number of threads
+    Node info_serial;
+    opts["num_threads"] = 1;
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,opts,info_serial));
+    EXPECT_EQ(info.to_json(),info_serial.to_json());
+
+    // field lengths must match the topology
+    blueprint::mesh::examples::braid("quads",10,10,1,mesh);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,opts,info));
+    mesh["fields/braid/values"].reset();
+    mesh["fields/braid/values"].set(DataType::float64(99));
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info));
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,opts,info));
+    EXPECT_EQ(info["fields/braid/valid"].as_string(),"false");
+
+    // structured dims must match the coordset
+    blueprint::mesh::examples::braid("structured",10,10,1,mesh);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,opts,info));
+    mesh["topologies/mesh/elements/dims/i"] = 5;
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,opts,info));
+
+    // mixed shape streams, indexed by element counts
+    blueprint::mesh::examples::braid("quads_and_tris",5,5,1,mesh);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,opts,info));
+    int32_array counts = mesh["topologies/mesh/elements/"
+                              "element_index/element_counts"].value();
+    counts[0] = 10;
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info));
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,opts,info));
+    EXPECT_EQ(info["topologies/mesh/valid"].as_string(),"false");
+
+    // mixed shape streams, indexed by offsets
+    blueprint::mesh::examples::braid("quads_and_tris_offsets",5,5,1,mesh);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,opts,info));
+    int32_array offsets = mesh["topologies/mesh/elements/"
+                               "element_index/offsets"].value();
+    // element 1 is a tri, it starts after the 4 entries of the first quad
+    EXPECT_EQ(offsets[1],4);
+    offsets[1] = 2;
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info));
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,opts,info));
+    EXPECT_EQ(info["topologies/mesh/errors"][0].as_string(),
+              "mesh::topology::unstructured: elements/element_index/"
+              "offsets[0] = 0 leaves 2 stream entries for an element that"
+              " needs 4");
+
+    offsets[1] = 1000;
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,opts,info));
+    EXPECT_EQ(info["topologies/mesh/valid"].as_string(),"false");
+    offsets[1] = 4;
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,opts,info));
+
+    int32_array stream = mesh["topologies/mesh/elements/stream"].value();
+    stream[5] = 25;
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info));
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,opts,info));
+    EXPECT_EQ(info["topologies/mesh/errors"][0].as_string(),
+              "mesh::topology::unstructured: elements/stream[5] = 25"
+              " is out of range [0, 24]");
+
+    // multiple domains
+    Node doms;
+    blueprint::mesh::examples::braid("hexs",5,5,5,doms["domain0"]);
+    blueprint::mesh::examples::braid("tets",5,5,5,doms["domain1"]);
+    EXPECT_TRUE(blueprint::mesh::verify(doms,opts,info));
+    EXPECT_EQ(info["domains"].number_of_children(),2);
+
+    int32_array tets_conn = doms["domain1/topologies/mesh/elements/connectivity"].value();
+    tets_conn[3] = -1;
+    EXPECT_FALSE(blueprint::mesh::verify(doms,opts,info));
+    EXPECT_EQ(info["domains/domain0/valid"].as_string(),"true");
+    EXPECT_EQ(info["domains/domain1/valid"].as_string(),"false");
+
+    // without deep, only the structure is checked
+    opts["deep"] = 0;
+    EXPECT_TRUE(blueprint::mesh::verify(doms,opts,info));
+}
@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: b_conduit_generator.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+
+//-----------------------------------------------------------------------------
+// parse throughput for a large pure json document, vs the general
+// walk_external + compact_to path and the json_sanitize pass that 
+// strict json inputs no longer pay for
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, gen_parse_benchmark)
+{
+    index_t num_fields = 64;
+    index_t num_ele    = 16 * 1024;
+    index_t num_trials = 3;
+
+    std::ostringstream oss;
+    oss << "{";
+    for(index_t f=0; f < num_fields; f++)
+    {
+        oss << (f > 0 ? "," : "") << "\"field_" << f << "\": "
+            << "{\"name\": \"field " << f << "\", \"values\": [";
+        for(index_t i=0; i < num_ele; i++)
+        {
+            oss << (i > 0 ? "," : "") << (i * 0.25);
+        }
+        oss << "]}";
+    }
+    oss << "}";
+
+    std::string json = oss.str();
+    float64 mbytes = json.size() / 1e6;
+    Generator g(json,"json");
+
+    float64 walk_time     = 0.0;
+    float64 external_time = 0.0;
+    float64 sanitize_time = 0.0;
+
+    for(index_t t=0; t < num_trials; t++)
+    {
+        Node n;
+        utils::Timer walk_timer;
+        g.walk(n);
+        walk_time += walk_timer.elapsed();
+
+        EXPECT_TRUE(n.is_compact());
+        EXPECT_EQ(n["field_9/values"].as_float64_ptr()[num_ele-1],
+                  (num_ele-1) * 0.25);
+    }
+
+    for(index_t t=0; t < num_trials; t++)
+    {
+        Node n_ext, n_compact;
+        utils::Timer external_timer;
+        g.walk_external(n_ext);
+        n_ext.compact_to(n_compact);
+        external_time += external_timer.elapsed();
+    }
+
+    for(index_t t=0; t < num_trials; t++)
+    {
+        utils::Timer sanitize_timer;
+        std::string json_sanitized = utils::json_sanitize(json);
+        sanitize_time += sanitize_timer.elapsed();
+    }
+
+    std::cout << "pure json parse, " << mbytes << " MB" << std::endl
+              << " walk:                     " 
+              << mbytes * num_trials / walk_time << " MB/s" << std::endl
+              << " walk_external+compact_to: " 
+              << mbytes * num_trials / external_time << " MB/s" << std::endl
+              << " json_sanitize:            " 
+              << mbytes * num_trials / sanitize_time << " MB/s" << std::endl;
+}
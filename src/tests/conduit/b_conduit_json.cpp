@@ -0,0 +1,152 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: b_conduit_json.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <cstdlib>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, base64_json_benchmark)
+{
+    index_t num_ele = 1000000;
+    index_t num_trials = 4;
+
+    std::vector<float64> vals(num_ele);
+    for(index_t i=0; i < num_ele; i++)
+    {
+        vals[i] = 1.0 / (float64)(i + 1);
+    }
+
+    Node n;
+    n["vals"].set_external(vals);
+    float64 mbytes = (float64)(num_ele * 8) / 1e6;
+
+    float64 enc_time = 0.0;
+    float64 dec_time = 0.0;
+    for(index_t t=0; t < num_trials; t++)
+    {
+        utils::Timer enc_timer;
+        std::string base64_json = n.to_json("conduit_base64_json");
+        enc_time += enc_timer.elapsed();
+
+        utils::Timer dec_timer;
+        Generator g(base64_json,"conduit_base64_json");
+        Node nparse;
+        g.walk(nparse);
+        dec_time += dec_timer.elapsed();
+
+        EXPECT_EQ(nparse["vals"].as_float64_ptr()[num_ele-1],
+                  vals[num_ele-1]);
+    }
+
+    std::cout << "conduit_base64_json, " << num_ele << " float64 elements"
+              << std::endl
+              << " encode: " << mbytes * num_trials / enc_time
+              << " MB/s" << std::endl
+              << " decode: " << mbytes * num_trials / dec_time
+              << " MB/s" << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, to_json_benchmark)
+{
+    index_t num_ele = 250000;
+    index_t num_trials = 4;
+
+    std::vector<float64> f64_vals(num_ele);
+    std::vector<int64>   i64_vals(num_ele);
+    for(index_t i=0; i < num_ele; i++)
+    {
+        f64_vals[i] = 1.0 / (float64)(i + 1) + (float64)i;
+        i64_vals[i] = i * 7919 - num_ele;
+    }
+
+    Node n;
+    n["f64"].set_external(f64_vals);
+    n["i64"].set_external(i64_vals);
+
+    const char *protos[] = {"json","conduit_json"};
+
+    for(index_t p=0; p < 2; p++)
+    {
+        float64 f64_time  = 0.0;
+        float64 i64_time  = 0.0;
+        float64 f64_bytes = 0.0;
+        float64 i64_bytes = 0.0;
+
+        for(index_t t=0; t < num_trials; t++)
+        {
+            std::ostringstream f64_oss;
+            utils::Timer f64_timer;
+            n["f64"].to_json_stream(f64_oss,protos[p]);
+            f64_time  += f64_timer.elapsed();
+            f64_bytes += (float64) f64_oss.str().size();
+
+            std::ostringstream i64_oss;
+            utils::Timer i64_timer;
+            n["i64"].to_json_stream(i64_oss,protos[p]);
+            i64_time  += i64_timer.elapsed();
+            i64_bytes += (float64) i64_oss.str().size();
+        }
+
+        std::cout << protos[p] << ", " << num_ele << " elements" << std::endl
+                  << " float64 to_json: " << f64_bytes / f64_time / 1e6
+                  << " MB/s" << std::endl
+                  << " int64 to_json:   " << i64_bytes / i64_time / 1e6
+                  << " MB/s" << std::endl;
+    }
+}
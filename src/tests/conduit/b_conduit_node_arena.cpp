@@ -0,0 +1,130 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: b_conduit_node_arena.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+
+//-----------------------------------------------------------------------------
+// helper that builds a multi-domain style tree with num_doms * num_fields
+// leaves
+void
+build_tree(Node &n, index_t num_doms, index_t num_fields)
+{
+    std::ostringstream oss;
+    for(index_t d=0; d < num_doms; d++)
+    {
+        oss.str("");
+        oss << "domain_" << d;
+        Node &dom = n[oss.str()];
+        dom["state/cycle"] = (int64) d;
+        Node &fields = dom["fields"];
+        for(index_t f=0; f < num_fields; f++)
+        {
+            oss.str("");
+            oss << "field_" << f;
+            Node &fld = fields[oss.str()];
+            fld["association"] = "element";
+            fld["values"] = (float64) (d * num_fields + f);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// build and destroy benchmark, compares heap and arena allocation
+//-----------------------------------------------------------------------------
+TEST(conduit_node_arena, build_destroy_benchmark)
+{
+    index_t num_doms   = 100;
+    index_t num_fields = 100;
+    index_t num_trials = 3;
+
+    float64 heap_time  = 0.0;
+    float64 arena_time = 0.0;
+
+    // the source tree is built once, the timed region constructs the 
+    // node hierarchy from its schema (Node::walk_schema) and copies it
+    // (Node::set), then destroys both trees.
+    Node src;
+    build_tree(src,num_doms,num_fields);
+    const Schema &src_schema = src.schema();
+
+    for(index_t t=0; t < num_trials; t++)
+    {
+        utils::Timer heap_timer;
+        {
+            Node n(src_schema);
+            Node n_copy(src);
+        }
+        heap_time += heap_timer.elapsed();
+
+        utils::Timer arena_timer;
+        {
+            Node n;
+            n.enable_arena();
+            n.set(src_schema);
+            Node n_copy;
+            n_copy.enable_arena();
+            n_copy.set(src);
+        }
+        arena_time += arena_timer.elapsed();
+    }
+
+    std::cout << "build + copy + destroy of "
+              << num_doms * num_fields << " fields "
+              << "(avg of " << num_trials << " trials)" << std::endl
+              << " heap:  " << heap_time  / num_trials << " sec" << std::endl
+              << " arena: " << arena_time / num_trials << " sec" << std::endl;
+}
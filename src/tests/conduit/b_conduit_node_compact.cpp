@@ -0,0 +1,165 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: b_conduit_node_compact.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+
+//-----------------------------------------------------------------------------
+// copy throughput benchmark for compact_to, update, and serialize over 
+// dense and strided float64 leaves
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compact, copy_benchmark)
+{
+    index_t num_ele    = 4 * 1024 * 1024;
+    index_t num_trials = 3;
+    float64 gbytes = (float64)(num_ele * sizeof(float64)) / 1e9;
+
+    std::vector<float64> vals((size_t)(2 * num_ele),1.0);
+
+    for(index_t s=0; s < 2; s++)
+    {
+        bool strided = (s == 1);
+        Node n;
+        if(strided)
+        {
+            n["vals"].set_external(DataType::float64(num_ele,0,16),&vals[0]);
+        }
+        else
+        {
+            n["vals"].set_external(DataType::float64(num_ele),&vals[0]);
+        }
+
+        Node n_dest;
+        n_dest["vals"].set(DataType::float64(num_ele));
+        std::vector<uint8> bytes;
+
+        float64 compact_time   = 0.0;
+        float64 update_time    = 0.0;
+        float64 serialize_time = 0.0;
+
+        for(index_t t=0; t < num_trials; t++)
+        {
+            Node nc;
+            utils::Timer compact_timer;
+            n.compact_to(nc);
+            compact_time += compact_timer.elapsed();
+
+            utils::Timer update_timer;
+            n_dest.update(n);
+            update_time += update_timer.elapsed();
+
+            utils::Timer serialize_timer;
+            n.serialize(bytes);
+            serialize_time += serialize_timer.elapsed();
+
+            EXPECT_EQ(nc["vals"].as_float64_ptr()[num_ele-1],1.0);
+            EXPECT_EQ(n_dest["vals"].as_float64_ptr()[num_ele-1],1.0);
+        }
+
+        std::cout << (strided ? "strided" : "dense")
+                  << " float64 leaf, " << num_ele << " elements" << std::endl
+                  << " compact_to: " << gbytes * num_trials / compact_time
+                  << " GB/s" << std::endl
+                  << " update:     " << gbytes * num_trials / update_time
+                  << " GB/s" << std::endl
+                  << " serialize:  " << gbytes * num_trials / serialize_time
+                  << " GB/s" << std::endl;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// compact_to and serialize time vs tree depth, for a chain where each 
+// level holds a leaf and the next level. The time per level should stay 
+// flat as the depth grows.
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compact, deep_tree_benchmark)
+{
+    index_t depths[] = {250, 500, 1000, 2000};
+
+    for(index_t d=0; d < 4; d++)
+    {
+        index_t depth = depths[d];
+        Node n;
+        Node *curr = &n;
+        for(index_t i=0; i < depth; i++)
+        {
+            curr->fetch("v") = (float64) i;
+            curr = &curr->fetch("next");
+        }
+        curr->set((float64) depth);
+
+        utils::Timer compact_timer;
+        Node nc;
+        n.compact_to(nc);
+        float64 compact_time = compact_timer.elapsed();
+
+        std::vector<uint8> bytes;
+        utils::Timer serialize_timer;
+        n.serialize(bytes);
+        float64 serialize_time = serialize_timer.elapsed();
+
+        EXPECT_EQ(nc.total_bytes_compact(),(depth + 1) * 8);
+        EXPECT_EQ(bytes.size(),(size_t)((depth + 1) * 8));
+        EXPECT_EQ(((float64*)&bytes[0])[depth],(float64)depth);
+
+        std::cout << "depth " << depth 
+                  << " compact_to: " << compact_time << " sec ("
+                  << 1e6 * compact_time / depth << " us/level)"
+                  << " serialize: " << serialize_time << " sec ("
+                  << 1e6 * serialize_time / depth << " us/level)"
+                  << std::endl;
+    }
+}
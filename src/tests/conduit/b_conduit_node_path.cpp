@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: b_conduit_node_path.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+
+//-----------------------------------------------------------------------------
+// repeated fetch benchmark, compares string paths and pre-parsed paths
+//-----------------------------------------------------------------------------
+TEST(conduit_node_path, fetch_benchmark)
+{
+    index_t num_fields = 100;
+    index_t num_iters  = 100000;
+
+    Node n;
+    std::ostringstream oss;
+    for(index_t f=0; f < num_fields; f++)
+    {
+        oss.str("");
+        oss << "domain_0/fields/field_" << f << "/values";
+        n[oss.str()] = (float64) f;
+    }
+
+    std::string str_path("domain_0/fields/field_50/values");
+    Path path(str_path);
+
+    float64 str_sum = 0.0;
+    utils::Timer str_timer;
+    for(index_t i=0; i < num_iters; i++)
+    {
+        str_sum += n.fetch(str_path).as_float64();
+    }
+    float64 str_time = str_timer.elapsed();
+
+    float64 path_sum = 0.0;
+    utils::Timer path_timer;
+    for(index_t i=0; i < num_iters; i++)
+    {
+        path_sum += n.fetch(path).as_float64();
+    }
+    float64 path_time = path_timer.elapsed();
+
+    EXPECT_EQ(str_sum,path_sum);
+
+    std::cout << num_iters << " fetches of a 4 level path" << std::endl
+              << " string path: " << str_time  << " sec" << std::endl
+              << " Path:        " << path_time << " sec" << std::endl;
+}
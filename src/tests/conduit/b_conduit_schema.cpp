@@ -0,0 +1,161 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2015, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://llnl.github.io/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: b_conduit_schema.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+
+using namespace conduit;
+
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, schema_binary_vs_json_benchmark)
+{
+    // a deep schema with small leaves, typical of mpi messages
+    Schema s;
+    std::ostringstream oss;
+    for(index_t i=0; i < 20; i++)
+    {
+        oss.str("");
+        oss << "domain_" << i;
+        Schema &dom = s[oss.str()];
+        dom["coordsets/coords/type"] = DataType::char8_str(9);
+        dom["coordsets/coords/values/x"] = DataType::float64(8);
+        dom["coordsets/coords/values/y"] = DataType::float64(8);
+        dom["topologies/mesh/type"] = DataType::char8_str(12);
+        dom["topologies/mesh/coordset"] = DataType::char8_str(7);
+        dom["fields/pressure/association"] = DataType::char8_str(8);
+        dom["fields/pressure/values"] = DataType::float64(4);
+    }
+    Schema s_c;
+    s.compact_to(s_c);
+
+    index_t num_iters = 200;
+
+    utils::Timer t_json;
+    index_t json_bytes = 0;
+    for(index_t i=0; i < num_iters; i++)
+    {
+        std::string json = s_c.to_json();
+        json_bytes = (index_t)json.size();
+        Schema s_res(json);
+        EXPECT_EQ(s_res.total_bytes_compact(),s_c.total_bytes_compact());
+    }
+    float64 json_time = t_json.elapsed();
+
+    utils::Timer t_bin;
+    index_t bin_bytes = 0;
+    std::vector<uint8> bin;
+    for(index_t i=0; i < num_iters; i++)
+    {
+        s_c.serialize(bin);
+        bin_bytes = (index_t)bin.size();
+        Schema s_res;
+        s_res.deserialize(bin);
+        EXPECT_EQ(s_res.total_bytes_compact(),s_c.total_bytes_compact());
+    }
+    float64 bin_time = t_bin.elapsed();
+
+    Schema s_res;
+    s_res.deserialize(bin);
+    EXPECT_TRUE(s_c.equals(s_res));
+
+    std::cout << "json   encode + parse: " << json_time 
+              << " s, " << json_bytes << " bytes" << std::endl
+              << "binary encode + parse: " << bin_time
+              << " s, " << bin_bytes  << " bytes" << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, schema_child_lookup_benchmark)
+{
+    index_t num_lookups = 200000;
+    std::ostringstream oss;
+
+    for(index_t num_children = 10; 
+        num_children <= 100000; 
+        num_children *= 10)
+    {
+        Schema s;
+        std::vector<std::string> paths;
+        for(index_t i=0; i < num_children; i++)
+        {
+            oss.str("");
+            oss << "child_" << i;
+            s["fields"][oss.str()]["values"].set(DataType::float64(10));
+            paths.push_back("fields/" + oss.str() + "/values");
+        }
+
+        const Schema &s_const = s;
+
+        index_t num_found = 0;
+        utils::Timer t;
+        for(index_t i=0; i < num_lookups; i++)
+        {
+            // stride through the children to defeat caching
+            size_t idx = (size_t)((i * 7919) % num_children);
+            const Schema &s_leaf = s_const.fetch_child(paths[idx]);
+            if(s_leaf.dtype().number_of_elements() == 10)
+            {
+                num_found++;
+            }
+        }
+        float64 elapsed = t.elapsed();
+
+        EXPECT_EQ(num_found,num_lookups);
+
+        std::cout << num_children << " children: "
+                  << num_lookups / elapsed 
+                  << " path lookups / sec" << std::endl;
+    }
+}
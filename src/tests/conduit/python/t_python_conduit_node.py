@@ -229,6 +229,93 @@ class Test_Conduit_Node(unittest.TestCase):
             for i in range(len(ext_data)):
                 self.assertEqual(n.value()[i], ext_data[i])
 
+    def test_set_external_multi_dim(self):
+        types = ['int8', 'int32', 'uint16', 'uint64', 'float32', 'float64']
+        for type in types:
+            ext_data = array(range(24), dtype=type).reshape(4,6)
+            n = Node()
+            n.set_external(ext_data)
+            self.assertEqual(n.dtype().number_of_elements(), 24)
+            ext_data[2,3] = 11
+            self.assertEqual(n.value()[15], 11)
+            # a column is described by a single stride
+            col_data = ext_data[:,1:2]
+            n.set_external(col_data)
+            self.assertEqual(n.dtype().number_of_elements(), 4)
+            n.value()[3] = 42
+            self.assertEqual(ext_data[3,1], 42)
+
+    def test_set_external_multi_stride_error(self):
+        ext_data = array(range(24), dtype='float64').reshape(4,6)[:,0:2]
+        n = Node()
+        with self.assertRaises(TypeError):
+            n.set_external(ext_data)
+
+    def test_set_multi_dim_copy(self):
+        base_data = array(range(24), dtype='int64').reshape(4,6)
+        src_data  = base_data[::2,1:5]
+        n = Node()
+        n.set(src_data)
+        self.assertEqual(n.dtype().number_of_elements(), 8)
+        vals = n.value()
+        self.assertTrue(array_equal(vals,src_data.flatten()))
+        base_data[0,1] = 99
+        self.assertEqual(vals[0], 1)
+
+    def test_value_is_view(self):
+        n = Node()
+        n['a'] = array(range(10), dtype='float32')
+        v = n['a']
+        v[3] = 33
+        self.assertEqual(n['a'][3], 33)
+        # the view keeps the node's memory alive
+        del n
+        self.assertEqual(v[3], 33)
+        self.assertEqual(v[9], 9)
+
+    def test_fetch_value_is_view(self):
+        n = Node()
+        n['a/b'] = array(range(10), dtype='float64')
+        v = n.fetch('a').fetch('b').value()
+        m = memoryview(n.fetch('a/b'))
+        c = [itr.node().value() for itr in n.fetch('a').children()]
+        # views of child nodes keep the root node's memory alive
+        del n
+        junk = [ones(10) for i in range(100)]
+        self.assertEqual(v[5], 5)
+        self.assertEqual(m[5], 5)
+        self.assertEqual(c[0][5], 5)
+        v[5] = 55
+        self.assertEqual(m[5], 55)
+
+    def test_buffer_protocol(self):
+        types = ['int8', 'int16', 'int32', 'int64',
+                 'uint8', 'uint16', 'uint32', 'uint64',
+                 'float32', 'float64']
+        for type in types:
+            n = Node()
+            n['a'] = array(range(10), dtype=type)
+            na = n.fetch('a')
+            m = memoryview(na)
+            self.assertEqual(m.shape, (10,))
+            self.assertEqual(m.itemsize, dtype(type).itemsize)
+            a = asarray(na)
+            self.assertEqual(a.dtype, dtype(type))
+            a[4] = 44
+            self.assertEqual(n['a'][4], 44)
+        # strided leaf
+        base_data = array(range(20), dtype='float64')
+        n = Node()
+        n.set_external(base_data[1:16:3])
+        a = asarray(n)
+        self.assertEqual(a.strides, (24,))
+        self.assertTrue(array_equal(a,base_data[1:16:3]))
+        # only numeric leaves can be exported
+        n = Node()
+        n['a'] = 'string'
+        with self.assertRaises(BufferError):
+            memoryview(n.fetch('a'))
+
 if __name__ == '__main__':
     unittest.main()
 
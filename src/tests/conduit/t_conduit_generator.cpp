@@ -51,6 +51,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <sstream>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -443,6 +444,169 @@ TEST(conduit_generator, gen_endianness)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, gen_compact_pure_json)
+{
+    std::string json = "{\"a\": 1, \"b\": -2.5e3, \"c\": \"str\","
+                       " \"d\": [1, 2, 3], \"e\": [1, 2.5],"
+                       " \"f\": {\"g\": true, \"h\": null},"
+                       " \"i\": [\"x\", {\"j\": 18446744073709551615}],"
+                       " \"k\": [], \"l\": {}} // trailing comment";
+
+    Generator g(json,"json");
+    Node n;
+    g.walk(n);
+    n.print();
+
+    EXPECT_TRUE(n.is_compact());
+    EXPECT_EQ(n["a"].as_int64(),1);
+    EXPECT_EQ(n["b"].as_float64(),-2500.0);
+    EXPECT_EQ(n["c"].as_string(),"str");
+    EXPECT_EQ(n["d"].as_int64_ptr()[2],3);
+    EXPECT_EQ(n["e"].as_float64_ptr()[1],2.5);
+    EXPECT_EQ(n["f/g"].as_uint8(),1);
+    EXPECT_TRUE(n["f/h"].dtype().is_empty());
+    EXPECT_EQ(n["i"][0].as_string(),"x");
+    EXPECT_EQ(n["i"][1]["j"].as_uint64(),18446744073709551615ULL);
+    EXPECT_TRUE(n["k"].dtype().is_list());
+    EXPECT_TRUE(n["l"].dtype().is_object());
+
+    // matches the general (external + compact_to) path
+    Node n_ext, n_compact;
+    g.walk_external(n_ext);
+    n_ext.compact_to(n_compact);
+    EXPECT_EQ(n.to_json(),n_compact.to_json());
+    EXPECT_EQ(n.schema().to_json(),n_compact.schema().to_json());
+
+    // keys with '/' expand into nested children via the general path
+    Generator g_path("{\"a/b\": 1, \"a/c\": \"s\"}","json");
+    Node n_path;
+    g_path.walk(n_path);
+    EXPECT_EQ(n_path["a/b"].as_int64(),1);
+    EXPECT_EQ(n_path["a/c"].as_string(),"s");
+
+    // duplicate keys are an error
+    Generator g_dup("{\"a\": 1, \"a\": 2}","json");
+    Node n_dup;
+    EXPECT_THROW(g_dup.walk(n_dup),conduit::Error);
+}
 
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, gen_compact_conduit_json)
+{
+    Node n;
+    n["a"] = (int32) 10;
+    n["b"] = "a string value";
+    n["c/d"].set(DataType::float32(4));
+    float32 *d_ptr = n["c/d"].value();
+    for(int i=0; i < 4; i++)
+    {
+        d_ptr[i] = i * 0.5f;
+    }
+    n["c/e"] = "another string";
+    n["f"].append() = (uint8) 3;
+    n["f"].append() = (int16) -4;
+
+    // conduit_json with inline values, strings land at non-zero offsets
+    Generator g(n.to_json("conduit_json"),"conduit_json");
+    Node n_parse;
+    g.walk(n_parse);
+    n_parse.print_detailed();
+
+    EXPECT_TRUE(n_parse.is_compact());
+    EXPECT_EQ(n_parse.to_json(),n.to_json());
+    EXPECT_EQ(n_parse["b"].as_string(),"a string value");
+    EXPECT_EQ(n_parse["c/e"].as_string(),"another string");
+
+    // quoteless schema with explicit offsets and strides is compacted
+    Generator g_strided("{a: {dtype: float64, number_of_elements: 2,"
+                        " offset: 16, stride: 16, value: [1.0, 2.0]},"
+                        " b: {dtype: int8, value: -1}}",
+                        "conduit_json");
+    Node n_strided;
+    g_strided.walk(n_strided);
+    EXPECT_TRUE(n_strided.is_compact());
+    EXPECT_EQ(n_strided.total_bytes_compact(),17);
+    EXPECT_EQ(n_strided["a"].as_float64_ptr()[1],2.0);
+    EXPECT_EQ(n_strided["b"].as_int8(),-1);
+}
 
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, gen_from_stream)
+{
+    Node n;
+    n["a"] = (int32) 10;
+    n["b"] = "a \"quoted\" string";
+    n["c/d"].set(DataType::float32(4));
+    float32 *d_ptr = n["c/d"].value();
+    for(int i=0; i < 4; i++)
+    {
+        d_ptr[i] = i * 0.5f;
+    }
+    n["c/e"].set(DataType::uint64(3));
+    n["f"].append() = (uint8) 3;
+    n["f"].append() = "list string";
+    n["g"];
+
+    std::string protocols[] = {"json", "conduit_json"};
+
+    for(int p=0; p < 2; p++)
+    {
+        std::string json = n.to_json(protocols[p]);
+        Node n_str;
+        Generator g_str(json,protocols[p]);
+        g_str.walk(n_str);
+
+        std::istringstream iss(json);
+        Node n_stream;
+        Generator g_stream;
+        g_stream.set_protocol(protocols[p]);
+        g_stream.walk(iss,n_stream);
+
+        EXPECT_TRUE(n_stream.is_compact());
+        EXPECT_EQ(n_stream.to_json(),n_str.to_json());
+        EXPECT_EQ(n_stream.schema().to_json(),n_str.schema().to_json());
+    }
+
+    // mixed arrays become lists, numeric arrays become leaves
+    std::istringstream iss_json("[[1, 2.5], [1, \"a\", [true]], []]");
+    Node n_json;
+    Generator g_json;
+    g_json.set_protocol("json");
+    g_json.walk(iss_json,n_json);
+    n_json.print();
+    EXPECT_EQ(n_json[0].as_float64_ptr()[1],2.5);
+    EXPECT_EQ(n_json[1][0].as_int64(),1);
+    EXPECT_EQ(n_json[1][1].as_string(),"a");
+    EXPECT_EQ(n_json[1][2][0].as_uint8(),1);
+    EXPECT_TRUE(n_json[2].dtype().is_list());
+
+    // the numbers seen before a non number keep their own types
+    std::istringstream iss_runs("[1, 2, 2.5, 3, 18446744073709551615, \"a\"]");
+    Node n_runs;
+    g_json.walk(iss_runs,n_runs);
+    EXPECT_EQ(n_runs.number_of_children(),6);
+    EXPECT_EQ(n_runs[1].as_int64(),2);
+    EXPECT_EQ(n_runs[2].as_float64(),2.5);
+    EXPECT_EQ(n_runs[3].as_int64(),3);
+    EXPECT_TRUE(n_runs[4].dtype().is_uint64());
+    EXPECT_EQ(n_runs[5].as_string(),"a");
+
+    // quoteless input and list_of schemas use the in memory fallback
+    std::istringstream iss_qless("{a: {dtype: {x: float64}, length: 2},"
+                                 " b: {dtype: int16, value: [1, 2]}}");
+    Node n_qless;
+    Generator g_qless;
+    g_qless.walk(iss_qless,n_qless);
+    EXPECT_EQ(n_qless["a"].number_of_children(),2);
+    EXPECT_EQ(n_qless["b"].as_int16_ptr()[1],2);
+
+    // errors are still reported
+    std::istringstream iss_err("{\"v\": {\"dtype\": \"int32\","
+                               " \"number_of_elements\": 2,"
+                               " \"value\": [1, 2, 3]}}");
+    Node n_err;
+    Generator g_err;
+    EXPECT_THROW(g_err.walk(iss_err,n_err),conduit::Error);
+}
 
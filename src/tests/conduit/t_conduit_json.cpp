@@ -51,6 +51,9 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <sstream>
+#include <vector>
+#include <cstdlib>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -401,6 +404,46 @@ TEST(conduit_json, to_base64_json_2)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_json, to_base64_json_strided)
+{
+    // odd sized and strided leaves, so base64 groups span leaves
+    uint8    bytes[7] = {1, 2, 3, 4, 5, 6, 7};
+    float64  vals[10];
+    for(int i=0;i<10;i++)
+    {
+        vals[i] = i * 1.5;
+    }
+
+    Node n;
+    n["bytes"].set_external(DataType::uint8(7),bytes);
+    n["evens"].set_external(DataType::float64(5,0,16),vals);
+    n["sub/str"] = "hello";
+    n["sub/odds"].set_external(DataType::float64(5,8,16),vals);
+    n["sub/c"].set_int16(-3);
+
+    std::string base64_json = n.to_json("conduit_base64_json");
+
+    Node nparse;
+    Generator g(base64_json,"conduit_base64_json");
+    g.walk(nparse);
+
+    // same as encoding the compact data
+    Node n_compact;
+    n.compact_to(n_compact);
+    EXPECT_EQ(nparse.to_json(),n_compact.to_json());
+
+    float64 *evens = nparse["evens"].value();
+    float64 *odds  = nparse["sub/odds"].value();
+    for(int i=0;i<5;i++)
+    {
+        EXPECT_EQ(evens[i],vals[2*i]);
+        EXPECT_EQ(odds[i],vals[2*i+1]);
+    }
+    EXPECT_EQ(nparse["sub/str"].as_string(),"hello");
+    EXPECT_EQ(nparse["sub/c"].as_int16(),-3);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_json, check_empty)
 {
@@ -595,6 +638,110 @@ TEST(conduit_json, json_schema_preserve_floats)
 
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_json, json_float_format)
+{
+    // same layout as "%.15g", with the shortest digits that round trip
+    EXPECT_EQ(utils::float64_to_string(0.1),"0.1");
+    EXPECT_EQ(utils::float64_to_string(-2.5),"-2.5");
+    EXPECT_EQ(utils::float64_to_string(100.0),"100.0");
+    EXPECT_EQ(utils::float64_to_string(0.0),"0.0");
+    EXPECT_EQ(utils::float64_to_string(1.0/3.0),"0.3333333333333333");
+    EXPECT_EQ(utils::float64_to_string(1e-5),"1e-05");
+    EXPECT_EQ(utils::float64_to_string(0.0001234),"0.0001234");
+    EXPECT_EQ(utils::float64_to_string(1.5e300),"1.5e+300");
+    EXPECT_EQ(utils::float64_to_string(123456789012345.0),
+              "123456789012345.0");
+
+    // float32 values use float32 precision
+    Node n;
+    n.set_float32(0.1f);
+    EXPECT_EQ(n.to_json(),"0.1");
+    n.set_float32(16777216.0f);
+    EXPECT_EQ(n.to_json(),"16777216.0");
+    n.set_float32(3.4028235e38f);
+    EXPECT_EQ(n.to_json(),"3.4028235e+38");
+
+    n.set_int64(-9223372036854775807LL - 1);
+    EXPECT_EQ(n.to_json(),"-9223372036854775808");
+    n.set_uint64(18446744073709551615ULL);
+    EXPECT_EQ(n.to_json(),"18446744073709551615");
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, json_float_round_trip)
+{
+    // check the text for a range of bit patterns converts back to 
+    // exactly the same values
+    index_t num_ele = 100000;
+    std::vector<float64> f64_vals(num_ele);
+    std::vector<float32> f32_vals(num_ele);
+
+    uint64 bits = 88172645463325252ULL;
+    for(index_t i=0; i < num_ele; i++)
+    {
+        bits ^= bits << 13;
+        bits ^= bits >> 7;
+        bits ^= bits << 17;
+        // keep the values finite
+        uint64 b64 = bits & ~(0x7FFULL << 52);
+        b64 |= (uint64)(i % 2047) << 52;
+        memcpy(&f64_vals[i],&b64,8);
+        uint32 b32 = (uint32)(bits & ~(0xFFULL << 23));
+        b32 |= (uint32)(i % 255) << 23;
+        memcpy(&f32_vals[i],&b32,4);
+    }
+
+    Node n;
+    n["f64"].set_external(f64_vals);
+    n["f32"].set_external(f32_vals);
+
+    std::string f64_json = n["f64"].to_json();
+    std::string f32_json = n["f32"].to_json();
+
+    // skip "[" and use strtod to consume each value
+    const char *f64_ptr = f64_json.c_str() + 1;
+    const char *f32_ptr = f32_json.c_str() + 1;
+    index_t f64_mismatch = 0;
+    index_t f32_mismatch = 0;
+    for(index_t i=0; i < num_ele; i++)
+    {
+        char *end = NULL;
+        float64 f64_val = strtod(f64_ptr,&end);
+        f64_ptr = end + 1;
+        if(memcmp(&f64_val,&f64_vals[i],8) != 0)
+            f64_mismatch++;
+
+        float32 f32_val = strtof(f32_ptr,&end);
+        f32_ptr = end + 1;
+        if(memcmp(&f32_val,&f32_vals[i],4) != 0)
+            f32_mismatch++;
+    }
 
+    EXPECT_EQ(f64_mismatch,0);
+    EXPECT_EQ(f32_mismatch,0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, json_zero_length_arrays)
+{
+    Node n;
+    n["f64"].set(DataType::float64(0));
+    n["i32"].set(DataType::int32(0));
+    n["val"] = 42;
 
+    std::string json = n.to_json("conduit_json");
+    EXPECT_TRUE(json.find("\"value\": []") != std::string::npos);
 
+    Generator g(json,"conduit_json");
+    Node n_parse;
+    g.walk(n_parse);
+
+    EXPECT_EQ(n_parse["f64"].dtype().number_of_elements(),0);
+    EXPECT_TRUE(n_parse["f64"].dtype().is_float64());
+    EXPECT_EQ(n_parse["i32"].dtype().number_of_elements(),0);
+    EXPECT_TRUE(n_parse["i32"].dtype().is_int32());
+    EXPECT_EQ(n_parse["val"].to_int64(),42);
+
+    EXPECT_EQ(n["f64"].to_json(),"[]");
+}
@@ -0,0 +1,192 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_arena.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// helper that builds a multi-domain style tree with num_doms * num_fields
+// leaves
+void
+build_tree(Node &n, index_t num_doms, index_t num_fields)
+{
+    std::ostringstream oss;
+    for(index_t d=0; d < num_doms; d++)
+    {
+        oss.str("");
+        oss << "domain_" << d;
+        Node &dom = n[oss.str()];
+        dom["state/cycle"] = (int64) d;
+        Node &fields = dom["fields"];
+        for(index_t f=0; f < num_fields; f++)
+        {
+            oss.str("");
+            oss << "field_" << f;
+            Node &fld = fields[oss.str()];
+            fld["association"] = "element";
+            fld["values"] = (float64) (d * num_fields + f);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_arena, arena_basic)
+{
+    Arena a(256);
+    void *p0 = a.allocate(40);
+    void *p1 = a.allocate(40);
+    EXPECT_TRUE(p0 != p1);
+    EXPECT_EQ(a.number_of_live_allocations(),2);
+    EXPECT_EQ(a.number_of_blocks(),1);
+
+    // returned storage is reused for the same size
+    a.deallocate(p1,40);
+    EXPECT_EQ(a.number_of_live_allocations(),1);
+    void *p2 = a.allocate(40);
+    EXPECT_EQ(p1,p2);
+
+    // requests larger than the block size get their own block
+    a.allocate(1024);
+    EXPECT_EQ(a.number_of_blocks(),2);
+    EXPECT_TRUE(a.total_bytes_reserved() >= 1024 + 256);
+
+    a.release();
+    EXPECT_EQ(a.number_of_blocks(),0);
+    EXPECT_EQ(a.total_bytes_reserved(),0);
+    EXPECT_EQ(a.number_of_live_allocations(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_arena, node_build_and_reset)
+{
+    Node n;
+    n.enable_arena();
+    EXPECT_TRUE(n.arena() != NULL);
+
+    build_tree(n,4,3);
+
+    EXPECT_EQ(n.number_of_children(),4);
+    EXPECT_EQ(n["domain_2/fields/field_1/values"].as_float64(),7.0);
+    EXPECT_EQ(n["domain_3/state/cycle"].as_int64(),3);
+    EXPECT_EQ(n["domain_0/fields/field_2/association"].as_string(),
+              "element");
+    EXPECT_EQ(n["domain_1/fields/field_0"].path(),"domain_1/fields/field_0");
+
+    const Arena *a = n.arena();
+    EXPECT_TRUE(a->number_of_blocks() > 0);
+    EXPECT_TRUE(a->number_of_live_allocations() > 0);
+
+    // removing returns storage to the arena 
+    index_t live = a->number_of_live_allocations();
+    n.remove("domain_3");
+    EXPECT_TRUE(a->number_of_live_allocations() < live);
+    EXPECT_FALSE(n.has_path("domain_3"));
+    EXPECT_EQ(n["domain_2/fields/field_1/values"].as_float64(),7.0);
+
+    // reset frees all blocks, the node can be reused with the arena
+    n.reset();
+    EXPECT_EQ(a->number_of_blocks(),0);
+    EXPECT_EQ(a->number_of_live_allocations(),0);
+
+    build_tree(n,2,2);
+    EXPECT_EQ(n["domain_1/fields/field_1/values"].as_float64(),3.0);
+    EXPECT_TRUE(a->number_of_blocks() > 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_arena, node_copy_compact_and_list)
+{
+    Node src;
+    build_tree(src,3,3);
+    src["lst"].append() = (int32) 10;
+    src["lst"].append() = (int32) 20;
+
+    Node n;
+    n.enable_arena();
+    n.set(src);
+    EXPECT_EQ(n.to_json(),src.to_json());
+    EXPECT_EQ(n["lst"][1].as_int32(),20);
+    
+    // copies into a non-arena node are independent of the arena
+    Node n_copy(n);
+    EXPECT_TRUE(n_copy.arena() == NULL);
+    n.reset();
+    EXPECT_EQ(n_copy.to_json(),src.to_json());
+
+    // compact_to and generator paths use the arena as well
+    Node nc;
+    nc.enable_arena();
+    src.compact_to(nc);
+    EXPECT_EQ(nc.to_json(),src.to_json());
+    EXPECT_TRUE(nc.arena()->number_of_live_allocations() > 0);
+
+    Node ng;
+    ng.enable_arena();
+    Generator g(src.to_json(),"json");
+    g.walk(ng);
+    EXPECT_EQ(ng["domain_1/fields/field_2/values"].to_float64(),5.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_arena, enable_errors)
+{
+    Node n;
+    n["a/b"] = 1;
+    // not allowed on a node with children
+    EXPECT_THROW(n.enable_arena(),conduit::Error);
+    // not allowed on a non-root node
+    Node &n_b = n["c"];
+    EXPECT_THROW(n_b.enable_arena(),conduit::Error);
+}
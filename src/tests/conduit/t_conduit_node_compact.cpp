@@ -51,6 +51,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <vector>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -144,3 +145,43 @@ TEST(conduit_node_compact, compact_3)
         EXPECT_EQ(n_arr[i],nc_arr[i]);
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compact, compact_strided_element_sizes)
+{
+    // exercise each element size used by the strided copy
+    std::vector<uint8> buff(20 * 8 * 3,0);
+    for(size_t i=0; i < buff.size(); i++)
+    {
+        buff[i] = (uint8)i;
+    }
+
+    index_t ele_ids[] = {DataType::UINT8_ID,
+                         DataType::UINT16_ID,
+                         DataType::UINT32_ID,
+                         DataType::UINT64_ID};
+
+    for(index_t t=0; t < 4; t++)
+    {
+        index_t ele_bytes = DataType::default_bytes(ele_ids[t]);
+        index_t stride = 3 * ele_bytes;
+
+        Node n;
+        n.set_external(DataType(ele_ids[t],20,ele_bytes,stride,
+                                ele_bytes,Endianness::DEFAULT_ID),
+                       &buff[0]);
+
+        Node nc;
+        n.compact_to(nc);
+        EXPECT_TRUE(nc.is_compact());
+        EXPECT_EQ(nc.total_bytes_compact(),20 * ele_bytes);
+
+        const uint8 *nc_ptr = (const uint8*)nc.data_ptr();
+        for(index_t i=0; i < 20; i++)
+        {
+            EXPECT_EQ(memcmp(nc_ptr + i * ele_bytes,
+                             &buff[(size_t)(ele_bytes + i * stride)],
+                             (size_t)ele_bytes),0);
+        }
+    }
+}
@@ -0,0 +1,206 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_path.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_path, path_components)
+{
+    Path p("a/b/c");
+    EXPECT_EQ(p.number_of_components(),3);
+    EXPECT_EQ(p.component(0),"a");
+    EXPECT_EQ(p.component(1),"b");
+    EXPECT_EQ(p.component(2),"c");
+    EXPECT_EQ(p.to_string(),"a/b/c");
+
+    // trailing separator does not add a component
+    p.set("a/b/");
+    EXPECT_EQ(p.number_of_components(),2);
+    EXPECT_EQ(p.to_string(),"a/b");
+
+    p.set("");
+    EXPECT_EQ(p.number_of_components(),0);
+
+    Path p_copy(Path("../x"));
+    EXPECT_EQ(p_copy.number_of_components(),2);
+    EXPECT_EQ(p_copy.component(0),"..");
+
+    EXPECT_THROW(p_copy.component(2),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_path, fetch_and_has_path)
+{
+    Node n;
+    n["a/b/c"] = (int64) 10;
+    n["a/b/d"] = (float64) 3.5;
+    n["a/e"]   = "hello";
+
+    Path p_c("a/b/c");
+    Path p_d("a/b/d");
+    Path p_e("a/e");
+    Path p_miss("a/b/z");
+
+    EXPECT_TRUE(n.has_path(p_c));
+    EXPECT_TRUE(n.has_path(p_d));
+    EXPECT_TRUE(n.has_path(p_e));
+    EXPECT_FALSE(n.has_path(p_miss));
+    // leaves are not objects
+    EXPECT_FALSE(n.has_path(Path("a/e/f")));
+
+    EXPECT_EQ(n.fetch(p_c).as_int64(),10);
+    EXPECT_EQ(n[p_d].as_float64(),3.5);
+    EXPECT_EQ(n.fetch(p_e).as_string(),"hello");
+
+    // the same node as the string fetch
+    EXPECT_EQ(&n.fetch(p_c),&n["a/b/c"]);
+
+    const Node &n_const = n;
+    EXPECT_EQ(&n_const.fetch(p_c),&n["a/b/c"]);
+    EXPECT_EQ(&n_const[p_d],&n["a/b/d"]);
+    EXPECT_EQ(n_const.fetch_ptr(p_miss),(const Node*)NULL);
+    EXPECT_THROW(n_const.fetch(p_miss),conduit::Error);
+    EXPECT_THROW(n.fetch_child(p_miss),conduit::Error);
+    EXPECT_FALSE(n.has_path(p_miss));
+
+    // schema interface
+    EXPECT_TRUE(n.schema().has_path(p_c));
+    EXPECT_EQ(&n.schema().fetch_child(p_c),n.fetch(p_c).schema_ptr());
+    EXPECT_THROW(n.schema().fetch_child(p_miss),conduit::Error);
+
+    // parent refs
+    Node &b = n["a/b"];
+    EXPECT_EQ(&b.fetch(Path("../e")),&n["a/e"]);
+    EXPECT_TRUE(b.has_path(Path("../../a/b/c")));
+    EXPECT_FALSE(n.has_path(Path("../a")));
+    EXPECT_THROW(n.fetch(Path("../a")),conduit::Error);
+
+    // non-const fetch creates the missing path
+    EXPECT_EQ(n.fetch(p_miss).dtype().id(),DataType::EMPTY_ID);
+    EXPECT_TRUE(n.has_path("a/b/z"));
+    EXPECT_EQ(&n.fetch(p_miss),&n["a/b/z"]);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_path, layout_changes)
+{
+    Node n;
+    n["a/x"] = (int32) 1;
+    n["a/y"] = (int32) 2;
+    n["a/z"] = (int32) 3;
+
+    Path p("a/z");
+    EXPECT_EQ(n[p].as_int32(),3);
+
+    // removing a sibling shifts the index of "z"
+    n["a"].remove("x");
+    EXPECT_EQ(n[p].as_int32(),3);
+    EXPECT_EQ(n[p].as_int32(),3);
+
+    // a different tree with a different layout
+    Node other;
+    other["b"] = (int32) 10;
+    other["a/q"] = (int32) 11;
+    other["a/w"] = (int32) 12;
+    other["a/z"] = (int32) 13;
+    EXPECT_EQ(other[p].as_int32(),13);
+    EXPECT_EQ(n[p].as_int32(),3);
+
+    // a child with the same name in a different slot 
+    n.remove("a");
+    EXPECT_FALSE(n.has_path(p));
+    n["c"] = (int32) 20;
+    n["a/z"] = (int32) 21;
+    EXPECT_EQ(n[p].as_int32(),21);
+
+    // a leaf replaced by an object
+    Path p_deep("a/z/w");
+    EXPECT_FALSE(n.has_path(p_deep));
+    n["a/z"].reset();
+    n["a/z/w"] = (int32) 22;
+    EXPECT_EQ(n[p_deep].as_int32(),22);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_path, set_path)
+{
+    Node n;
+    Path p_a("state/cycle");
+    Path p_b("state/time");
+    Path p_c("fields/pressure/values");
+    Path p_d("fields/pressure/association");
+
+    n.set_path(p_a,(int64)100);
+    n.set_path(p_b,(float64)1.5);
+
+    std::vector<float64> vals(10,2.0);
+    n.set_path(p_c,vals);
+    n.set_path(p_d,std::string("element"));
+
+    EXPECT_EQ(n["state/cycle"].as_int64(),100);
+    EXPECT_EQ(n["state/time"].as_float64(),1.5);
+    EXPECT_EQ(n["fields/pressure/values"].dtype().number_of_elements(),10);
+    EXPECT_EQ(n["fields/pressure/values"].as_float64_ptr()[9],2.0);
+    EXPECT_EQ(n["fields/pressure/association"].as_string(),"element");
+
+    // overwrite in place
+    n.set_path(p_a,(int64)101);
+    EXPECT_EQ(n["state/cycle"].as_int64(),101);
+
+    Node other;
+    other["x"] = (int32) 5;
+    n.set_path(Path("other"),other);
+    EXPECT_EQ(n["other/x"].as_int32(),5);
+}
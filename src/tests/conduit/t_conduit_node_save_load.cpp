@@ -453,3 +453,160 @@ TEST(conduit_node_save_load, load_save_with_childless_list)
 
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, sbin_round_trip)
+{
+    Node n;
+    n["a"] = (int32) 10;
+    n["b/c"].set(DataType::float64(5));
+    float64_array c_vals = n["b/c"].value();
+    for(index_t i=0; i < 5; i++)
+    {
+        c_vals[i] = 1.5 * i;
+    }
+    n["b/d"] = "my string";
+    n["e"].append().set((uint8)3);
+    n["e"].append().set(DataType::list());
+    n["f"].set(DataType::object());
+    n["g"];
+
+    // strided source data is compacted on save
+    int32 strided_vals[6] = {1, -1, 2, -1, 3, -1};
+    n["h"].set_external(DataType::int32(3,0,8),strided_vals);
+
+    n.save("tout_conduit_sbin_round_trip.conduit_sbin","conduit_sbin");
+    EXPECT_TRUE(Node::is_sbin_file("tout_conduit_sbin_round_trip.conduit_sbin"));
+
+    Node n_load;
+    n_load.load("tout_conduit_sbin_round_trip.conduit_sbin","conduit_sbin");
+    n_load.print_detailed();
+
+    EXPECT_EQ(n.to_json(),n_load.to_json());
+
+    EXPECT_EQ(n_load["h"].dtype().number_of_elements(),3);
+    EXPECT_EQ(n_load["h"].dtype().stride(),4);
+    EXPECT_EQ(n_load["h"].as_int32_ptr()[2],3);
+    EXPECT_TRUE(n_load["g"].dtype().is_empty());
+    EXPECT_TRUE(n_load["f"].dtype().is_object());
+    EXPECT_TRUE(n_load["e"][1].dtype().is_list());
+
+    // load with the default protocol detects the single file layout
+    Node n_detect;
+    n_detect.load("tout_conduit_sbin_round_trip.conduit_sbin");
+    EXPECT_EQ(n.to_json(),n_detect.to_json());
+
+    // existing two file layout is not mistaken for a single file
+    n.save("tout_conduit_sbin_round_trip.conduit_bin");
+    EXPECT_FALSE(Node::is_sbin_file("tout_conduit_sbin_round_trip.conduit_bin"));
+    EXPECT_FALSE(Node::is_sbin_file("tout_conduit_sbin_missing.conduit_sbin"));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, sbin_mmap)
+{
+    Node n;
+    n["a"] = (int8) 1;
+    n["b"].set(DataType::float64(3));
+    n["b"].as_float64_ptr()[2] = 42.0;
+    n["c"] = (int16) 7;
+
+    n.save("tout_conduit_sbin_mmap.conduit_sbin","conduit_sbin");
+
+    Node nmmap;
+    nmmap.mmap("tout_conduit_sbin_mmap.conduit_sbin");
+    nmmap.print_detailed();
+
+    EXPECT_EQ(nmmap["a"].as_int8(),1);
+    EXPECT_EQ(nmmap["b"].as_float64_ptr()[2],42.0);
+    EXPECT_EQ(nmmap["c"].as_int16(),7);
+
+    // each leaf in the file is aligned to 64 bytes
+    NodeConstIterator itr = nmmap.children();
+    while(itr.has_next())
+    {
+        const Node &chld = itr.next();
+        EXPECT_EQ(((size_t)chld.element_ptr(0)) % 64, 0u);
+    }
+
+    // writes through the map are visible to later loads
+    nmmap["c"] = (int16) 8;
+
+#if defined(CONDUIT_PLATFORM_WINDOWS)
+    nmmap.reset();
+#endif
+
+    Node n_load;
+    n_load.load("tout_conduit_sbin_mmap.conduit_sbin");
+    EXPECT_EQ(n_load["c"].as_int16(),8);
+    EXPECT_EQ(n_load["b"].as_float64_ptr()[2],42.0);
+
+    // releasing the map writes back the checksum of the mapped data
+    nmmap.reset();
+    n_load.load("tout_conduit_sbin_mmap.conduit_sbin");
+    EXPECT_EQ(n_load["c"].as_int16(),8);
+
+    // so later changes to the file are caught again
+    std::fstream fs("tout_conduit_sbin_mmap.conduit_sbin",
+                    std::ios_base::in  |
+                    std::ios_base::out |
+                    std::ios_base::binary);
+    fs.seekp(-1,std::ios_base::end);
+    fs.put((char)9);
+    fs.close();
+
+    EXPECT_THROW(n_load.load("tout_conduit_sbin_mmap.conduit_sbin"),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, sbin_errors)
+{
+    Node n;
+    n["a"].set(DataType::int64(16));
+    n.save("tout_conduit_sbin_errors.conduit_sbin","conduit_sbin");
+
+    std::string fname = "tout_conduit_sbin_errors.conduit_sbin";
+    std::fstream fs;
+
+    // flip a byte in the last data element
+    fs.open(fname.c_str(),
+            std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    fs.seekg(0,std::ios_base::end);
+    std::streamoff fsize = fs.tellg();
+    fs.seekp(fsize-1);
+    fs.put((char)0x5a);
+    fs.close();
+
+    Node n_load;
+    EXPECT_THROW(n_load.load(fname,"conduit_sbin"),conduit::Error);
+
+    // not a conduit_sbin file
+    n.save("tout_conduit_sbin_errors.json","json");
+    EXPECT_THROW(n_load.load("tout_conduit_sbin_errors.json","conduit_sbin"),
+                 conduit::Error);
+    EXPECT_THROW(n_load.load("tout_conduit_sbin_missing.conduit_sbin",
+                             "conduit_sbin"),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, sbin_serialize)
+{
+    Node n;
+    n["a"] = (int32) 10;
+    n["b"].set(DataType::float64(3));
+    n["c/d"] = "value";
+
+    // in memory layout matches the file layout
+    std::vector<uint8> data;
+    n.serialize_sbin(data);
+
+    n.save("tout_conduit_sbin_serialize.conduit_sbin","conduit_sbin");
+
+    std::ifstream ifs("tout_conduit_sbin_serialize.conduit_sbin",
+                      std::ios_base::binary);
+    std::vector<uint8> file_data((std::istreambuf_iterator<char>(ifs)),
+                                  std::istreambuf_iterator<char>());
+    EXPECT_EQ(data,file_data);
+    EXPECT_TRUE(data.size() > 64);
+}
@@ -239,6 +239,40 @@ TEST(conduit_node_update, update_compatible)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node_update, update_strided)
+{
+    float64 src_vals[] = {1.0, -1.0, 2.0, -2.0, 3.0, -3.0, 4.0, -4.0};
+    float64 des_vals[] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+    // strided src, dense dest
+    Node n_src;
+    n_src["a"].set_external(DataType::float64(4,0,16),src_vals);
+
+    Node n;
+    n["a"].set(DataType::float64(4));
+    float64 *n_ptr_pre_update = n["a"].as_float64_ptr();
+    n.update(n_src);
+    EXPECT_EQ(n_ptr_pre_update,n["a"].as_float64_ptr());
+
+    for(index_t i=0;i<4;i++)
+    {
+        EXPECT_EQ(n["a"].as_float64_ptr()[i],(float64)(i+1));
+    }
+
+    // dense src, strided dest, the holes in dest are preserved
+    Node n_des;
+    n_des["a"].set_external(DataType::float64(4,8,16),des_vals);
+    n_des.update_compatible(n);
+
+    for(index_t i=0;i<4;i++)
+    {
+        EXPECT_EQ(des_vals[2*i],0.0);
+        EXPECT_EQ(des_vals[2*i+1],(float64)(i+1));
+    }
+}
+
+
 //-----------------------------------------------------------------------------
 TEST(conduit_node_update, update_external)
 {
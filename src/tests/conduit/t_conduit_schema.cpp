@@ -51,6 +51,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <sstream>
 #include "gtest/gtest.h"
 
 
@@ -298,9 +299,194 @@ TEST(schema_basics, schema_errors)
     EXPECT_THROW(s.fetch_child(".."),conduit::Error);
 }
 
+//-----------------------------------------------------------------------------
+TEST(schema_basics, schema_many_children)
+{
+    Schema s;
+    index_t num_children = 1000;
+    std::ostringstream oss;
+    for(index_t i=0; i < num_children; i++)
+    {
+        oss.str("");
+        oss << "child_" << i;
+        s[oss.str()].set(DataType::int64());
+    }
+
+    EXPECT_EQ(s.number_of_children(),num_children);
+    EXPECT_EQ(s.child_index("child_0"),0);
+    EXPECT_EQ(s.child_index("child_999"),999);
+    EXPECT_TRUE(s.has_child("child_500"));
+    EXPECT_FALSE(s.has_child("child_1000"));
+    EXPECT_FALSE(s.has_child("child_"));
+    EXPECT_THROW(s.child_index("child_1000"),conduit::Error);
+
+    // removal shifts the indices of the following children
+    s.remove("child_10");
+    s.remove(0);
+    EXPECT_EQ(s.number_of_children(),num_children - 2);
+    EXPECT_FALSE(s.has_child("child_0"));
+    EXPECT_FALSE(s.has_child("child_10"));
+    EXPECT_EQ(s.child_index("child_1"),0);
+    EXPECT_EQ(s.child_index("child_11"),9);
+    EXPECT_EQ(s.child_index("child_999"),997);
+    EXPECT_EQ(s.child_name(9),"child_11");
+
+    // copies use the same indices
+    Schema s_copy(s);
+    EXPECT_TRUE(s_copy.equals(s));
+    EXPECT_EQ(s_copy.child_index("child_11"),9);
+    
+    // children can be added after removal 
+    s["child_0"].set(DataType::float32());
+    EXPECT_EQ(s.child_index("child_0"),num_children - 2);
+    EXPECT_TRUE(s["child_0"].dtype().is_float32());
+    EXPECT_FALSE(s_copy.equals(s));
+
+    // remove every third child, the rest must still be found
+    for(index_t i = s_copy.number_of_children() - 1; i >= 0; i -= 3)
+    {
+        s_copy.remove(i);
+    }
+
+    for(index_t i=0; i < s_copy.number_of_children(); i++)
+    {
+        EXPECT_EQ(s_copy.child_index(s_copy.child_name(i)),i);
+    }
+    EXPECT_FALSE(s_copy.has_child("child_999"));
+    EXPECT_TRUE(s_copy.has_child("child_998"));
+}
 
+//-----------------------------------------------------------------------------
+// path lookup microbenchmark for objects with 10 to 100k children
+//-----------------------------------------------------------------------------
+TEST(schema_basics, schema_cached_totals)
+{
+    Schema s;
+    s["a"] = DataType::float64(10);
+    s["b/c"] = DataType::int32(4);
+
+    EXPECT_EQ(s.total_bytes_compact(),96);
+    EXPECT_EQ(s.total_strided_bytes(),96);
+    EXPECT_EQ(s["b"].total_bytes_compact(),16);
+
+    // adding a child changes the totals of all ancestors
+    s["b/d"] = DataType::int64(2);
+    EXPECT_EQ(s["b"].total_bytes_compact(),32);
+    EXPECT_EQ(s.total_bytes_compact(),112);
+
+    // changing a leaf
+    s["b/c"].set(DataType::int32(4,0,8));
+    EXPECT_EQ(s.total_bytes_compact(),112);
+    EXPECT_EQ(s.total_strided_bytes(),124);
+    EXPECT_FALSE(s.is_compact());
+
+    // changing a leaf via the non-const dtype() accessor
+    s["b/c"].dtype().set_stride(4);
+    EXPECT_EQ(s.total_strided_bytes(),112);
+    EXPECT_TRUE(s.is_compact());
+
+    // removing children
+    s["b"].remove("c");
+    EXPECT_EQ(s["b"].total_bytes_compact(),16);
+    EXPECT_EQ(s.total_bytes_compact(),96);
+    s.remove("a");
+    EXPECT_EQ(s.total_bytes_compact(),16);
+
+    // lists
+    Schema &lst = s["lst"];
+    lst.append().set(DataType::uint8(3));
+    EXPECT_EQ(s.total_bytes_compact(),19);
+    lst.append().set(DataType::uint8(5));
+    EXPECT_EQ(s.total_bytes_compact(),24);
+    lst.remove((index_t)0);
+    EXPECT_EQ(s.total_bytes_compact(),21);
+
+    // replace the whole tree
+    Schema s2;
+    s2["x/y"] = DataType::float32(2);
+    s.set(s2);
+    EXPECT_EQ(s.total_bytes_compact(),8);
+    s.reset();
+    EXPECT_EQ(s.total_bytes_compact(),0);
+
+    // compacted schema
+    Schema s3;
+    s3["a"] = DataType::float64(4,0,16);
+    s3["b"] = DataType::int32(2);
+    Schema s3_c;
+    s3.compact_to(s3_c);
+    EXPECT_EQ(s3_c.total_bytes_compact(),40);
+    EXPECT_EQ(s3_c.total_strided_bytes(),40);
+    EXPECT_EQ(s3_c["b"].dtype().offset(),32);
+}
 
+//-----------------------------------------------------------------------------
+TEST(schema_basics, schema_binary_round_trip)
+{
+    Schema s;
+    s["a"] = DataType::float64(4,0,16);
+    s["b"] = DataType::int32(2,64);
+    s["c/d"] = DataType::uint8(3,100,1,1,Endianness::BIG_ID);
+    s["c/e"].append().set(DataType::int16(5,7));
+    s["c/e"].append().set(DataType::char8_str(6,200));
+    s["c/e"].append();
+    s["c/f"].set(DataType::object());
+    // repeated names share one entry in the name table
+    s["g/a"] = DataType::int64();
+    s["g/b"] = DataType::float32();
+
+    std::vector<uint8> data;
+    s.serialize(data);
+
+    Schema s_res;
+    s_res.deserialize(data);
+    
+    EXPECT_TRUE(s.equals(s_res));
+    EXPECT_EQ(s.to_json(),s_res.to_json());
+    EXPECT_EQ(s_res.child_names(),s.child_names());
+    EXPECT_TRUE(s_res.has_path("g/b"));
+
+    // much smaller than the json
+    EXPECT_LT(data.size(),s.to_json().size());
+
+    // deserialize replaces existing contents
+    s_res.deserialize(data);
+    EXPECT_TRUE(s.equals(s_res));
+
+    // empty schema
+    Schema s_empty;
+    s_empty.serialize(data);
+    s_res.deserialize(data);
+    EXPECT_TRUE(s_res.dtype().is_empty());
+}
 
+//-----------------------------------------------------------------------------
+TEST(schema_basics, schema_binary_errors)
+{
+    Schema s;
+    s["a/b"] = DataType::float64(4);
+    s["a/c"] = DataType::int32();
+
+    std::vector<uint8> data;
+    s.serialize(data);
+
+    Schema s_res;
+    // truncated
+    for(size_t i=0; i < data.size(); i++)
+    {
+        EXPECT_THROW(s_res.deserialize(&data[0],(index_t)i),conduit::Error);
+    }
+
+    // bad version
+    std::vector<uint8> bad = data;
+    bad[0] = 255;
+    EXPECT_THROW(s_res.deserialize(bad),conduit::Error);
+
+    // trailing bytes
+    bad = data;
+    bad.push_back(0);
+    EXPECT_THROW(s_res.deserialize(bad),conduit::Error);
+}
 
 //-----------------------------------------------------------------------------
 ///
@@ -171,3 +171,55 @@ TEST(conduit_serialize, compact)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_serialize, compact_offset_leaves)
+{
+    Node n;
+    n["a"] = (int64) 1;
+    n["b"] = (int64) 2;
+    n["c"] = (float64) 3.5;
+
+    // the leaves of a compacted node share one buffer, with offsets
+    Node nc;
+    n.compact_to(nc);
+    EXPECT_EQ(nc["b"].dtype().offset(),8);
+
+    std::vector<uint8> nc_bytes;
+    nc.serialize(nc_bytes);
+    EXPECT_EQ(nc_bytes.size(),24);
+
+    Node n_res(nc.schema(),&nc_bytes[0],true);
+    EXPECT_EQ(n_res["a"].as_int64(),1);
+    EXPECT_EQ(n_res["b"].as_int64(),2);
+    EXPECT_EQ(n_res["c"].as_float64(),3.5);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_serialize, strided_children)
+{
+    float64 vals[] = {1.0, -1.0, 2.0, -2.0, 3.0, -3.0};
+
+    Node n;
+    n["a"].set_external(DataType::float64(3,0,16),vals);
+    n["b"] = (int64) 10;
+
+    std::vector<uint8> nc_bytes;
+    n.serialize(nc_bytes);
+    EXPECT_EQ(nc_bytes.size(),32);
+
+    Schema nc_s;
+    n.schema().compact_to(nc_s);
+    Node nc(nc_s,&nc_bytes[0],true);
+
+    EXPECT_EQ(nc["a"].as_float64_ptr()[0],1.0);
+    EXPECT_EQ(nc["a"].as_float64_ptr()[1],2.0);
+    EXPECT_EQ(nc["a"].as_float64_ptr()[2],3.0);
+    EXPECT_EQ(nc["b"].as_int64(),10);
+
+    // serializing into a buffer that already holds data
+    n["b"] = (int64) 20;
+    n.serialize(nc_bytes);
+    EXPECT_EQ(nc_bytes.size(),32);
+    EXPECT_EQ(((int64*)&nc_bytes[24])[0],20);
+}
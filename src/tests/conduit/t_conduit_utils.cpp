@@ -52,6 +52,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <vector>
 #include "gtest/gtest.h"
 
 #include "t_config.hpp"
@@ -332,6 +333,81 @@ TEST(conduit_utils, base64_enc_dec)
     EXPECT_EQ(n_src["c"].as_int32(), n_res["c"].as_int32());
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, base64_known_values)
+{
+    // test vectors from RFC 4648
+    const char *dec_vals[] = {"", "f", "fo", "foo", "foob", "fooba", "foobar"};
+    const char *enc_vals[] = {"", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==",
+                              "Zm9vYmE=", "Zm9vYmFy"};
+
+    for(int i=0; i < 7; i++)
+    {
+        index_t nbytes = (index_t) strlen(dec_vals[i]);
+        std::vector<char> enc_buff(utils::base64_encode_buffer_size(nbytes));
+        utils::base64_encode(dec_vals[i],nbytes,&enc_buff[0]);
+        EXPECT_EQ(std::string(&enc_buff[0]),std::string(enc_vals[i]));
+
+        index_t enc_nbytes = (index_t) strlen(enc_vals[i]);
+        std::vector<char> dec_buff(utils::base64_decode_buffer_size(enc_nbytes));
+        index_t dec_nbytes = utils::base64_decode(enc_vals[i],
+                                                  enc_nbytes,
+                                                  &dec_buff[0],
+                                                  (index_t)dec_buff.size());
+        EXPECT_EQ(dec_nbytes,nbytes);
+        EXPECT_EQ(std::string(&dec_buff[0],(size_t)dec_nbytes),
+                  std::string(dec_vals[i]));
+    }
+
+    // chars outside the alphabet are skipped
+    std::string enc_ws = "Zm9v\nYm\r\nFy";
+    char dec_buff[16];
+    index_t dec_nbytes = utils::base64_decode(enc_ws.c_str(),
+                                              (index_t)enc_ws.size(),
+                                              dec_buff,
+                                              16);
+    EXPECT_EQ(std::string(dec_buff,(size_t)dec_nbytes),"foobar");
+
+    // decoding stops when the dest is full
+    dec_nbytes = utils::base64_decode("Zm9vYmFy",8,dec_buff,4);
+    EXPECT_EQ(dec_nbytes,4);
+    EXPECT_EQ(std::string(dec_buff,4),"foob");
+
+    // unpadded input is fully decoded by the unbounded form
+    memset(dec_buff,0,16);
+    utils::base64_decode("Zm9vYmE",7,dec_buff);
+    EXPECT_EQ(std::string(dec_buff),"fooba");
+    memset(dec_buff,0,16);
+    utils::base64_decode("Zm9vYg",6,dec_buff);
+    EXPECT_EQ(std::string(dec_buff),"foob");
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, base64_round_trip)
+{
+    std::vector<uint8> src(1000);
+    for(size_t i=0; i < src.size(); i++)
+    {
+        src[i] = (uint8)((i * 7919) >> 3);
+    }
+
+    for(index_t nbytes=0; nbytes < 1000; nbytes+=37)
+    {
+        std::vector<char> enc(utils::base64_encode_buffer_size(nbytes));
+        utils::base64_encode(&src[0],nbytes,&enc[0]);
+        index_t enc_nbytes = (index_t)strlen(&enc[0]);
+        EXPECT_EQ(enc_nbytes, ((nbytes + 2) / 3) * 4);
+
+        std::vector<uint8> dec(utils::base64_decode_buffer_size(enc_nbytes));
+        index_t dec_nbytes = utils::base64_decode(&enc[0],
+                                                  enc_nbytes,
+                                                  &dec[0],
+                                                  (index_t)dec.size());
+        EXPECT_EQ(dec_nbytes,nbytes);
+        EXPECT_EQ(memcmp(&dec[0],&src[0],(size_t)nbytes),0);
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_utils, dir_create_and_remove_tests)
 {
@@ -410,3 +486,37 @@ TEST(conduit_utils, file_path_split_tests)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, hasher_pieces)
+{
+    std::vector<uint8> buff(1000);
+    for(size_t i=0; i < buff.size(); i++)
+    {
+        buff[i] = (uint8)(i * 7 + 3);
+    }
+
+    // various sizes, including ones that split 32 byte stripes
+    index_t sizes[] = {0, 1, 5, 31, 32, 33, 100, 1000};
+    for(int s=0; s < 8; s++)
+    {
+        index_t nbytes = sizes[s];
+        uint64 expected = utils::hash_bytes(&buff[0],nbytes,11);
+
+        utils::Hasher whole(11);
+        whole.update(&buff[0],nbytes);
+        EXPECT_EQ(whole.digest(),expected);
+
+        utils::Hasher pieces(11);
+        index_t offset = 0;
+        index_t piece  = 1;
+        while(offset < nbytes)
+        {
+            index_t num = std::min(piece,nbytes - offset);
+            pieces.update(&buff[offset],num);
+            offset += num;
+            piece = (piece * 3) % 37 + 1;
+        }
+        EXPECT_EQ(pieces.digest(),expected);
+    }
+}
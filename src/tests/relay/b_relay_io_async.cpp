@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: b_relay_io_async.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit_relay.hpp"
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+using namespace conduit::relay;
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_async, save_benchmark)
+{
+    index_t num_vals  = 1 << 20;
+    index_t num_steps = 8;
+
+    Node n;
+    n["fields/u"].set(DataType::float64(num_vals));
+    n["fields/v"].set(DataType::float64(num_vals));
+
+    io::AsyncWriter writer;
+    writer.set_queue_depth(2);
+
+    utils::Timer sync_timer;
+    for(index_t s=0; s < num_steps; s++)
+    {
+        std::ostringstream oss;
+        oss << "tout_relay_io_async_bench_" << (s % 2) << ".conduit_bin";
+        io::save(n,oss.str());
+    }
+    float64 sync_time = sync_timer.elapsed();
+
+    utils::Timer async_timer;
+    for(index_t s=0; s < num_steps; s++)
+    {
+        std::ostringstream oss;
+        oss << "tout_relay_io_async_bench_" << (s % 2) << ".conduit_bin";
+        writer.save(n,oss.str());
+    }
+    // time the caller spent blocked in save()
+    float64 async_time = async_timer.elapsed();
+    writer.wait_all();
+
+    Node info;
+    writer.stats(info);
+
+    std::cout << "sync save:  " << sync_time  << " (s)" << std::endl
+              << "async save: " << async_time << " (s) caller time"
+              << std::endl;
+    info.print();
+
+    EXPECT_EQ(info["writes"].to_index_t(),num_steps);
+    // buffers are reused, not allocated per step
+    EXPECT_TRUE(info["buffers"].to_index_t() <= 2);
+}
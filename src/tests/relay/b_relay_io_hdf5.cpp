@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: b_relay_io_hdf5.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit_relay.hpp"
+#include "conduit_relay_hdf5.hpp"
+#include <iostream>
+#include <cmath>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+using namespace conduit::relay;
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, write_options_benchmark)
+{
+    // smooth data, similar to a simulation field
+    index_t num_eles = 2 * 1024 * 1024;
+    Node n;
+    n["field"].set(DataType::float64(num_eles));
+    float64 *field_ptr = n["field"].value();
+    for(index_t i=0; i < num_eles; i++)
+    {
+        field_ptr[i] = sin(i * 0.0001);
+    }
+
+    float64 mbytes = n.total_bytes_compact() / (1024.0 * 1024.0);
+
+    Node opts_cases;
+    // level 9 with 1024 element chunks, the original write settings
+    opts_cases["level_9_1024_eles/compression/level"]  = 9;
+    opts_cases["level_9_1024_eles/chunking/chunk_size"] = 1024 * 8;
+    opts_cases["level_9"]["compression/level"] = 9;
+    opts_cases["level_1"]["compression/level"] = 1;
+    opts_cases["none"]["compression/method"] = "none";
+
+    NodeConstIterator itr = opts_cases.children();
+    while(itr.has_next())
+    {
+        const Node &opts = itr.next();
+        std::string ofile = "tout_hdf5_wr_opts_bench_" + itr.name() + ".hdf5";
+
+        utils::Timer t;
+        io::hdf5_write(n,ofile,opts);
+        float64 elapsed = t.elapsed();
+
+        std::cout << itr.name() << ": "
+                  << mbytes / elapsed  << " MB/s"
+                  << " (" << elapsed << " s)" << std::endl;
+    }
+}
@@ -0,0 +1,208 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: b_relay_mpi_test.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit_relay_mpi.hpp"
+#include <iostream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+using namespace conduit::relay;
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, send_recv_data_benchmark) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    if(size < 2)
+    {
+        return;
+    }
+
+    // large strided field: compare staging through a compact copy
+    // with sending directly from the strided memory
+    index_t num_pts = 1000000;
+    index_t num_iters = 10;
+    std::vector<float64> xyz(num_pts*3,1.0);
+    Node n;
+    n["x"].set_external(DataType::float64(num_pts,0,24),&xyz[0]);
+
+    Node n_rcv;
+    n_rcv["x"].set(DataType::float64(num_pts));
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    utils::Timer t_staged;
+    for(index_t i=0; i < num_iters; i++)
+    {
+        if(rank == 0)
+        {
+            Node n_compact;
+            n.compact_to(n_compact);
+            mpi::send_data(n_compact,1,0,MPI_COMM_WORLD);
+        }
+        else if(rank == 1)
+        {
+            mpi::recv_data(n_rcv,0,0,MPI_COMM_WORLD);
+        }
+    }
+    float64 staged_time = t_staged.elapsed();
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    utils::Timer t_direct;
+    for(index_t i=0; i < num_iters; i++)
+    {
+        if(rank == 0)
+        {
+            mpi::send_data(n,1,0,MPI_COMM_WORLD);
+        }
+        else if(rank == 1)
+        {
+            mpi::recv_data(n_rcv,0,0,MPI_COMM_WORLD);
+        }
+    }
+    float64 direct_time = t_direct.elapsed();
+
+    if(rank == 0)
+    {
+        std::cout << "staged compact send: " << staged_time << " s" 
+                  << std::endl
+                  << "direct strided send: " << direct_time << " s"
+                  << std::endl;
+    }
+    else if(rank == 1)
+    {
+        EXPECT_EQ(n_rcv["x"].as_float64_ptr()[num_pts-1],1.0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, send_recv_schema_cache_benchmark) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    if(size < 2)
+    {
+        return;
+    }
+
+    // small messages with a deep schema
+    Node n_a;
+    Node n_b;
+    std::ostringstream oss;
+    for(int i=0; i < 50; i++)
+    {
+        oss.str("");
+        oss << "domain_" << i << "/fields/pressure/values";
+        n_a[oss.str()] = (float64) i;
+        n_b[oss.str()] = (float32) i;
+    }
+
+    index_t num_iters = 200;
+    Node n_rcv;
+
+    // alternating layouts force the schema to be resent and rebuilt
+    MPI_Barrier(MPI_COMM_WORLD);
+    utils::Timer t_changing;
+    for(index_t i=0; i < num_iters; i++)
+    {
+        if(rank == 0)
+        {
+            mpi::send( (i % 2) ? n_a : n_b,1,0,MPI_COMM_WORLD);
+        }
+        else if(rank == 1)
+        {
+            mpi::recv(n_rcv,0,0,MPI_COMM_WORLD);
+        }
+    }
+    float64 changing_time = t_changing.elapsed();
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    utils::Timer t_cached;
+    for(index_t i=0; i < num_iters; i++)
+    {
+        if(rank == 0)
+        {
+            mpi::send(n_a,1,0,MPI_COMM_WORLD);
+        }
+        else if(rank == 1)
+        {
+            mpi::recv(n_rcv,0,0,MPI_COMM_WORLD);
+        }
+    }
+    float64 cached_time = t_cached.elapsed();
+
+    if(rank == 0)
+    {
+        std::cout << "changing layout send/recv: " << changing_time << " s"
+                  << std::endl
+                  << "cached layout send/recv:   " << cached_time << " s"
+                  << std::endl;
+    }
+    else if(rank == 1)
+    {
+        EXPECT_EQ(n_rcv["domain_49/fields/pressure/values"].as_float64(),
+                  49.0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+
+    return result;
+}
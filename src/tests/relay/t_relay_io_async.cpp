@@ -0,0 +1,130 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_relay_io_async.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit_relay.hpp"
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+using namespace conduit::relay;
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_async, save_snapshot)
+{
+    Node n;
+    n["a"].set(DataType::float64(100));
+    n["b"] = "first";
+    float64_array a_vals = n["a"].value();
+    for(index_t i=0; i < 100; i++)
+    {
+        a_vals[i] = (float64) i;
+    }
+
+    io::AsyncWriter writer;
+    EXPECT_EQ(writer.queue_depth(),2);
+
+    index_t h0 = writer.save(n,"tout_relay_io_async_0.conduit_bin");
+
+    // the writer holds a snapshot, so changes after save() don't
+    // show up in the file
+    a_vals[0] = -1.0;
+    n["b"] = "second";
+
+    index_t h1 = writer.save(n,"tout_relay_io_async_1.bin","conduit_bin");
+
+    writer.wait(h0);
+    EXPECT_TRUE(writer.test(h0));
+    writer.wait_all();
+    EXPECT_TRUE(writer.test(h1));
+    EXPECT_EQ(writer.number_of_pending(),0);
+
+    Node n_load;
+    io::load("tout_relay_io_async_0.conduit_bin",n_load);
+    EXPECT_EQ(n_load["a"].as_float64_ptr()[0],0.0);
+    EXPECT_EQ(n_load["a"].as_float64_ptr()[99],99.0);
+    EXPECT_EQ(n_load["b"].as_string(),"first");
+
+    io::load("tout_relay_io_async_1.bin","conduit_bin",n_load);
+    EXPECT_EQ(n_load["a"].as_float64_ptr()[0],-1.0);
+    EXPECT_EQ(n_load["b"].as_string(),"second");
+
+    Node info;
+    writer.stats(info);
+    EXPECT_EQ(info["writes"].to_index_t(),2);
+    EXPECT_TRUE(info["bytes"].to_index_t() > 0);
+    EXPECT_TRUE(info["buffers"].to_index_t() <= 2);
+
+    // invalid handle
+    EXPECT_THROW(writer.wait(42),conduit::Error);
+    EXPECT_THROW(writer.set_queue_depth(0),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_async, save_errors)
+{
+    Node n;
+    n["a"] = 10;
+
+    io::AsyncWriter writer;
+    index_t h_bad = writer.save(n,
+                                "tout_relay_io_async_bad.bin",
+                                "bad_protocol");
+    index_t h_ok  = writer.save(n,"tout_relay_io_async_ok.json");
+
+    EXPECT_THROW(writer.wait(h_bad),conduit::Error);
+    // the error is reported once
+    EXPECT_TRUE(writer.test(h_bad));
+    writer.wait(h_ok);
+
+    writer.save(n,"tout_relay_io_async_bad.bin","bad_protocol");
+    EXPECT_THROW(writer.wait_all(),conduit::Error);
+    writer.wait_all();
+}
@@ -83,6 +83,34 @@ TEST(conduit_relay_io_basic, basic_bin)
     EXPECT_EQ(n_load["c"].as_uint32(), c_val);
 }
 
+TEST(conduit_relay_io_basic, basic_sbin)
+{
+    uint32 a_val = 20;
+    uint32 b_val = 8;
+
+    Node n;
+    n["a"] = a_val;
+    n["b"] = b_val;
+
+    // the extension selects the single file protocol
+    io::save(n, "test_conduit_relay_io_dump.conduit_sbin");
+    EXPECT_TRUE(Node::is_sbin_file("test_conduit_relay_io_dump.conduit_sbin"));
+
+    Node n_load;
+    io::load("test_conduit_relay_io_dump.conduit_sbin",n_load);
+    EXPECT_EQ(n_load["a"].as_uint32(), a_val);
+    EXPECT_EQ(n_load["b"].as_uint32(), b_val);
+
+    Node n_extra;
+    n_extra["c"] = a_val + b_val;
+    io::save_merged(n_extra, "test_conduit_relay_io_dump.conduit_sbin");
+
+    n_load.reset();
+    io::load("test_conduit_relay_io_dump.conduit_sbin",n_load);
+    EXPECT_EQ(n_load["a"].as_uint32(), a_val);
+    EXPECT_EQ(n_load["c"].as_uint32(), a_val + b_val);
+}
+
 TEST(conduit_relay_io_basic, json)
 {
     uint32 a_val = 20;
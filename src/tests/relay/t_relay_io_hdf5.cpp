@@ -689,3 +689,358 @@ TEST(conduit_relay_io_hdf5, auto_endian)
 
 
 
+
+//-----------------------------------------------------------------------------
+// helper that opens a dataset and returns its layout, number of filters
+// and chunk size
+void
+hdf5_dset_layout_info(const std::string &file_path,
+                      const std::string &dset_path,
+                      H5D_layout_t &layout,
+                      int &num_filters,
+                      hsize_t &chunk_size)
+{
+    hid_t h5_file_id = H5Fopen(file_path.c_str(),
+                               H5F_ACC_RDONLY,
+                               H5P_DEFAULT);
+    hid_t h5_dset_id = H5Dopen(h5_file_id, dset_path.c_str(), H5P_DEFAULT);
+    hid_t h5_plist_id = H5Dget_create_plist(h5_dset_id);
+
+    layout = H5Pget_layout(h5_plist_id);
+    num_filters = H5Pget_nfilters(h5_plist_id);
+    chunk_size = 0;
+    if(layout == H5D_CHUNKED)
+    {
+        H5Pget_chunk(h5_plist_id, 1, &chunk_size);
+    }
+
+    H5Pclose(h5_plist_id);
+    H5Dclose(h5_dset_id);
+    H5Fclose(h5_file_id);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, write_options)
+{
+    Node n;
+    n["small"].set(DataType::float64(10));
+    n["large"].set(DataType::float64(100000));
+    float64 *large_ptr = n["large"].value();
+    for(index_t i=0; i < 100000; i++)
+    {
+        large_ptr[i] = (float64) i;
+    }
+
+    H5D_layout_t layout;
+    int num_filters = 0;
+    hsize_t chunk_size = 0;
+
+    // defaults: compress everything, 1 MiB chunks
+    io::hdf5_write(n,"tout_hdf5_wr_opts_default.hdf5");
+    hdf5_dset_layout_info("tout_hdf5_wr_opts_default.hdf5","large",
+                          layout,num_filters,chunk_size);
+    EXPECT_EQ(layout,H5D_CHUNKED);
+    EXPECT_EQ(num_filters,2);
+    EXPECT_EQ(chunk_size,(hsize_t)100000);
+
+    // small leaves stay contiguous, chunk and compress larger ones
+    Node opts;
+    opts["compression/level"] = 1;
+    opts["compression/shuffle"] = "false";
+    opts["chunking/threshold"] = 1024;
+    opts["chunking/chunk_size"] = 8 * 1000;
+    io::hdf5_write(n,"tout_hdf5_wr_opts.hdf5",opts);
+
+    hdf5_dset_layout_info("tout_hdf5_wr_opts.hdf5","small",
+                          layout,num_filters,chunk_size);
+    EXPECT_NE(layout,H5D_CHUNKED);
+    EXPECT_EQ(num_filters,0);
+
+    hdf5_dset_layout_info("tout_hdf5_wr_opts.hdf5","large",
+                          layout,num_filters,chunk_size);
+    EXPECT_EQ(layout,H5D_CHUNKED);
+    EXPECT_EQ(num_filters,1);
+    EXPECT_EQ(chunk_size,(hsize_t)1000);
+
+    // no compression
+    opts.reset();
+    opts["compression/method"] = "none";
+    io::hdf5_write(n,"tout_hdf5_wr_opts_none.hdf5",opts);
+    hdf5_dset_layout_info("tout_hdf5_wr_opts_none.hdf5","large",
+                          layout,num_filters,chunk_size);
+    EXPECT_EQ(layout,H5D_CONTIGUOUS);
+    EXPECT_EQ(num_filters,0);
+
+    // all variants read back the same data
+    Node n_load;
+    io::hdf5_read("tout_hdf5_wr_opts.hdf5",n_load);
+    EXPECT_EQ(n_load["large"].as_float64_ptr()[99999],99999.0);
+    io::hdf5_read("tout_hdf5_wr_opts_none.hdf5",n_load);
+    EXPECT_EQ(n_load["large"].as_float64_ptr()[99999],99999.0);
+
+    // change the global defaults
+    Node orig_opts;
+    io::hdf5_options(orig_opts);
+    EXPECT_EQ(orig_opts["compression/method"].as_string(),"deflate");
+
+    io::hdf5_set_options(opts);
+    io::hdf5_write(n,"tout_hdf5_wr_opts_global.hdf5");
+    hdf5_dset_layout_info("tout_hdf5_wr_opts_global.hdf5","large",
+                          layout,num_filters,chunk_size);
+    EXPECT_EQ(layout,H5D_CONTIGUOUS);
+    io::hdf5_set_options(orig_opts);
+
+    // invalid options are an error, and don't change the defaults
+    opts["compression/method"] = "deflate";
+    opts["compression/level"] = 10;
+    EXPECT_THROW(io::hdf5_set_options(opts),Error);
+    opts["compression/method"] = "lz4";
+    opts["compression/level"] = 1;
+    EXPECT_THROW(io::hdf5_write(n,"tout_hdf5_wr_opts_bad.hdf5",opts),Error);
+
+    opts["compression/method"] = "deflate";
+    opts["compression/shuffle"] = "yes";
+    EXPECT_THROW(io::hdf5_set_options(opts),Error);
+
+    Node curr_opts;
+    io::hdf5_options(curr_opts);
+    EXPECT_EQ(curr_opts.to_json(),orig_opts.to_json());
+
+    // shuffle also accepts numeric values
+    opts.reset();
+    opts["compression/shuffle"] = 0;
+    io::hdf5_write(n,"tout_hdf5_wr_opts_shuffle_0.hdf5",opts);
+    hdf5_dset_layout_info("tout_hdf5_wr_opts_shuffle_0.hdf5","large",
+                          layout,num_filters,chunk_size);
+    EXPECT_EQ(num_filters,1);
+
+    opts["compression/shuffle"] = 1;
+    io::hdf5_write(n,"tout_hdf5_wr_opts_shuffle_1.hdf5",opts);
+    hdf5_dset_layout_info("tout_hdf5_wr_opts_shuffle_1.hdf5","large",
+                          layout,num_filters,chunk_size);
+    EXPECT_EQ(num_filters,2);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, read_schema_and_selection)
+{
+    Node n;
+    n["fields/a"].set(DataType::int64(100));
+    n["fields/b"].set(DataType::float32(10));
+    n["name"] = "mesh";
+    n["empty"];
+    int64 *a_ptr = n["fields/a"].value();
+    for(int i=0; i < 100; i++)
+    {
+        a_ptr[i] = i;
+    }
+
+    io::hdf5_write(n,"tout_hdf5_read_partial.hdf5");
+
+    // schema only
+    Schema s;
+    io::hdf5_read_schema("tout_hdf5_read_partial.hdf5",s);
+    s.print();
+    EXPECT_TRUE(s.is_compact());
+    EXPECT_EQ(s["fields/a"].dtype().id(),DataType::INT64_ID);
+    EXPECT_EQ(s["fields/a"].dtype().number_of_elements(),100);
+    EXPECT_EQ(s["fields/b"].dtype().number_of_elements(),10);
+    EXPECT_TRUE(s["empty"].dtype().is_empty());
+
+    io::hdf5_read_schema("tout_hdf5_read_partial.hdf5:fields",s);
+    EXPECT_EQ(s.number_of_children(),2);
+
+    // hyperslab selections
+    Node opts;
+    opts["offset"] = 10;
+    opts["stride"] = 3;
+    opts["size"]   = 5;
+
+    Node n_read;
+    io::hdf5_read("tout_hdf5_read_partial.hdf5","fields/a",opts,n_read);
+    EXPECT_EQ(n_read.dtype().number_of_elements(),5);
+    int64 *read_ptr = n_read.value();
+    for(int i=0; i < 5; i++)
+    {
+        EXPECT_EQ(read_ptr[i],10 + 3 * i);
+    }
+
+    // without size, read to the end
+    opts.remove("size");
+    io::hdf5_read("tout_hdf5_read_partial.hdf5","fields/a",opts,n_read);
+    EXPECT_EQ(n_read.dtype().number_of_elements(),30);
+    EXPECT_EQ(n_read.as_int64_ptr()[29],97);
+
+    // selections beyond the end are an error
+    opts["size"] = 31;
+    EXPECT_THROW(io::hdf5_read("tout_hdf5_read_partial.hdf5",
+                               "fields/a",opts,n_read),
+                 Error);
+
+    // several paths using one open file
+    hid_t h5_file_id = io::hdf5_open_file_for_read(
+                                            "tout_hdf5_read_partial.hdf5");
+    opts.reset();
+    opts["size"] = 2;
+    Node n_sel;
+    io::hdf5_read(h5_file_id,"fields/a",opts,n_sel["a"]);
+    io::hdf5_read(h5_file_id,"fields/b",opts,n_sel["b"]);
+    io::hdf5_close_file(h5_file_id);
+    EXPECT_EQ(n_sel["a"].dtype().number_of_elements(),2);
+    EXPECT_EQ(n_sel["b"].dtype().number_of_elements(),2);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, lazy_reader)
+{
+    Node n;
+    n["fields/a"].set(DataType::int64(100));
+    n["fields/b"].set(DataType::float64(10));
+    n["coords/x"].set(DataType::float64(10));
+    n["coords/x"].as_float64_ptr()[9] = 42.0;
+    n["name"] = "mesh";
+
+    io::hdf5_write(n,"tout_hdf5_lazy.hdf5");
+
+    io::HDF5LazyReader reader;
+    reader.open("tout_hdf5_lazy.hdf5");
+    EXPECT_TRUE(reader.is_open());
+    EXPECT_TRUE(reader.has_path("fields/a"));
+    EXPECT_EQ(reader.schema()["fields/a"].dtype().number_of_elements(),100);
+    EXPECT_FALSE(reader.is_loaded("fields/a"));
+
+    // leaves are read on first access
+    Node &x = reader.fetch("coords/x");
+    EXPECT_EQ(x.as_float64_ptr()[9],42.0);
+    EXPECT_TRUE(reader.is_loaded("coords/x"));
+    EXPECT_FALSE(reader.is_loaded("fields/a"));
+    // and only once
+    float64 *x_ptr = x.value();
+    EXPECT_EQ(reader.fetch("coords/x").data_ptr(),(void*)x_ptr);
+
+    // fetching a group reads the leaves under it
+    Node &fields = reader.fetch("fields");
+    EXPECT_EQ(fields.number_of_children(),2);
+    EXPECT_TRUE(reader.is_loaded("fields/a"));
+    EXPECT_TRUE(reader.is_loaded("fields/b"));
+    EXPECT_FALSE(reader.is_loaded("name"));
+
+    reader.release("fields");
+    EXPECT_FALSE(reader.is_loaded("fields/a"));
+    EXPECT_TRUE(reader.is_loaded("coords/x"));
+
+    Node &all = reader.fetch("");
+    EXPECT_EQ(all["name"].as_string(),"mesh");
+    EXPECT_EQ(all["fields/a"].dtype().number_of_elements(),100);
+
+    EXPECT_THROW(reader.fetch("bad/path"),Error);
+
+    reader.close();
+    EXPECT_FALSE(reader.is_open());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, read_into_strided_external)
+{
+    index_t num_eles = 10;
+    Node n;
+    n["x"].set(DataType::float64(num_eles));
+    n["y"].set(DataType::float64(num_eles));
+    n["z"].set(DataType::float64(num_eles));
+    float64 *x_ptr = n["x"].value();
+    float64 *y_ptr = n["y"].value();
+    float64 *z_ptr = n["z"].value();
+    for(index_t i=0; i < num_eles; i++)
+    {
+        x_ptr[i] = i;
+        y_ptr[i] = 100 + i;
+        z_ptr[i] = 200 + i;
+    }
+
+    io::hdf5_write(n,"tout_hdf5_read_strided.hdf5");
+
+    // interleaved xyz array owned by the caller
+    std::vector<float64> xyz(num_eles * 3, -1.0);
+    Node n_read;
+    n_read["x"].set_external(DataType::float64(num_eles,
+                                               0,
+                                               3 * sizeof(float64)),
+                             &xyz[0]);
+    n_read["y"].set_external(DataType::float64(num_eles,
+                                               sizeof(float64),
+                                               3 * sizeof(float64)),
+                             &xyz[0]);
+    n_read["z"].set_external(DataType::float64(num_eles,
+                                               2 * sizeof(float64),
+                                               3 * sizeof(float64)),
+                             &xyz[0]);
+
+    io::hdf5_read("tout_hdf5_read_strided.hdf5",n_read);
+
+    // data lands in the caller's memory, the views are unchanged
+    EXPECT_EQ(n_read["y"].data_ptr(),(void*)&xyz[0]);
+    EXPECT_EQ(n_read["y"].dtype().offset(),(index_t)sizeof(float64));
+    for(index_t i=0; i < num_eles; i++)
+    {
+        EXPECT_EQ(xyz[3*i],   (float64) i);
+        EXPECT_EQ(xyz[3*i+1], (float64) 100 + i);
+        EXPECT_EQ(xyz[3*i+2], (float64) 200 + i);
+    }
+
+    // a stride that isn't a multiple of the element size (packed 
+    // float64 + int32 records)
+    std::vector<uint8> packed(num_eles * 12, 0);
+    Node n_packed;
+    n_packed.set_external(DataType::float64(num_eles,0,12),&packed[0]);
+    io::hdf5_read("tout_hdf5_read_strided.hdf5","z",n_packed);
+    EXPECT_EQ(n_packed.data_ptr(),(void*)&packed[0]);
+    for(index_t i=0; i < num_eles; i++)
+    {
+        float64 val = 0;
+        memcpy(&val,&packed[i*12],sizeof(float64));
+        EXPECT_EQ(val,(float64) 200 + i);
+    }
+
+    // combined with a hyperslab selection
+    Node opts;
+    opts["offset"] = 4;
+    opts["size"]   = 3;
+    std::vector<float64> sel(6, -1.0);
+    Node n_sel;
+    n_sel.set_external(DataType::float64(3,0,2 * sizeof(float64)),&sel[0]);
+    io::hdf5_read("tout_hdf5_read_strided.hdf5","x",opts,n_sel);
+    EXPECT_EQ(sel[0],4.0);
+    EXPECT_EQ(sel[1],-1.0);
+    EXPECT_EQ(sel[2],5.0);
+    EXPECT_EQ(sel[4],6.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, async_save)
+{
+    Node n;
+    n["a"].set(DataType::float64(10));
+    n["b"] = (int32) 5;
+    float64 *a_ptr = n["a"].value();
+    for(index_t i=0; i < 10; i++)
+    {
+        a_ptr[i] = (float64) i;
+    }
+
+    // with a non thread safe HDF5 library these writes happen in the
+    // calling thread
+    io::AsyncWriter writer;
+    index_t h0 = writer.save(n,"tout_hdf5_async_save_0.hdf5");
+    n["b"] = (int32) 6;
+    index_t h1 = writer.save(n,"tout_hdf5_async_save_1.bin","hdf5");
+    writer.wait(h0);
+    writer.wait(h1);
+
+    Node n_load;
+    io::load("tout_hdf5_async_save_0.hdf5",n_load);
+    EXPECT_EQ(n_load["a"].as_float64_ptr()[9],9.0);
+    EXPECT_EQ(n_load["b"].as_int32(),5);
+
+    io::load("tout_hdf5_async_save_1.bin","hdf5",n_load);
+    EXPECT_EQ(n_load["b"].as_int32(),6);
+}
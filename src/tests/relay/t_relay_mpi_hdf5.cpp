@@ -0,0 +1,231 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_relay_mpi_hdf5.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit_relay.hpp"
+#include "conduit_relay_hdf5.hpp"
+#include "conduit_relay_mpi.hpp"
+#include "conduit_relay_mpi_hdf5.hpp"
+#include <iostream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+using namespace conduit::relay;
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_mpi_hdf5, write_read_shared_file)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    // ranks have different sized leaves, and rank 0 has an extra leaf 
+    Node n;
+    n["fields/rank"] = rank;
+    n["fields/values"].set(DataType::float64(rank + 2));
+    float64 *vals_ptr = n["fields/values"].value();
+    for(int i = 0; i < rank + 2; i++)
+    {
+        vals_ptr[i] = rank * 100 + i;
+    }
+    n["name"] = "domain";
+    if(rank == 0)
+    {
+        n["extra"].set(DataType::int32(3));
+        int32 *extra_ptr = n["extra"].value();
+        extra_ptr[0] = 1; extra_ptr[1] = 2; extra_ptr[2] = 3;
+    }
+
+    std::string ofile = "tout_relay_mpi_hdf5_shared.hdf5";
+    mpi::io::hdf5_write(n,ofile,MPI_COMM_WORLD);
+
+    // the shared file holds all ranks' data
+    if(rank == 0)
+    {
+        Node n_all;
+        relay::io::hdf5_read(ofile,n_all);
+        EXPECT_EQ(n_all["fields/rank"].dtype().number_of_elements(),size);
+        int num_vals = 0;
+        for(int r = 0; r < size; r++)
+        {
+            EXPECT_EQ(n_all["fields/rank"].as_int_ptr()[r],r);
+            num_vals += r + 2;
+        }
+        EXPECT_EQ(n_all["fields/values"].dtype().number_of_elements(),
+                  num_vals);
+        EXPECT_EQ(n_all["extra"].dtype().number_of_elements(),3);
+    }
+
+    Node n_read;
+    mpi::io::hdf5_read(ofile,n_read,MPI_COMM_WORLD);
+
+    EXPECT_EQ(n_read["fields/rank"].to_int(),rank);
+    EXPECT_EQ(n_read["fields/values"].dtype().number_of_elements(),rank+2);
+    float64 *rvals_ptr = n_read["fields/values"].value();
+    for(int i = 0; i < rank + 2; i++)
+    {
+        EXPECT_EQ(rvals_ptr[i],(float64)(rank * 100 + i));
+    }
+    EXPECT_EQ(n_read["name"].as_string(),"domain");
+    EXPECT_EQ(n_read.has_child("extra"),rank == 0);
+    if(rank == 0)
+    {
+        EXPECT_EQ(n_read["extra"].as_int32_ptr()[2],3);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_mpi_hdf5, write_errors)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+
+    // leaf types must agree across ranks
+    Node n;
+    if(rank == 0)
+    {
+        n["value"].set_int32(1);
+    }
+    else
+    {
+        n["value"].set_float64(1.0);
+    }
+
+    EXPECT_THROW(mpi::io::hdf5_write(n,
+                                     "tout_relay_mpi_hdf5_errors.hdf5",
+                                     MPI_COMM_WORLD),
+                 Error);
+
+    // a path can't be both a leaf and a group
+    n.reset();
+    if(rank == 0)
+    {
+        n["value"].set_int32(1);
+    }
+    else
+    {
+        n["value/a"].set_int32(1);
+    }
+
+    EXPECT_THROW(mpi::io::hdf5_write(n,
+                                     "tout_relay_mpi_hdf5_errors.hdf5",
+                                     MPI_COMM_WORLD),
+                 Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_mpi_hdf5, read_errors)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    Node n;
+    n["value"] = rank;
+
+    std::string ofile = "tout_relay_mpi_hdf5_read_errors.hdf5";
+    mpi::io::hdf5_write(n,ofile,MPI_COMM_WORLD);
+
+    Node n_read;
+#ifndef H5_HAVE_PARALLEL
+    // a failure on one rank is reported on all ranks
+    if(size > 1)
+    {
+        std::string ifile = ofile;
+        if(rank == size - 1)
+        {
+            ifile = "tout_relay_mpi_hdf5_missing.hdf5";
+        }
+        EXPECT_THROW(mpi::io::hdf5_read(ifile,n_read,MPI_COMM_WORLD),
+                     Error);
+    }
+#endif
+
+    // the file must be read with the number of ranks that wrote it
+    std::string sfile = "tout_relay_mpi_hdf5_read_errors_self.hdf5";
+    if(rank == 0)
+    {
+        mpi::io::hdf5_write(n,sfile,MPI_COMM_SELF);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    if(size > 1)
+    {
+        EXPECT_THROW(mpi::io::hdf5_read(sfile,n_read,MPI_COMM_WORLD),
+                     Error);
+    }
+
+    // not a shared file
+    if(rank == 0)
+    {
+        relay::io::hdf5_write(n,"tout_relay_mpi_hdf5_not_shared.hdf5");
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    EXPECT_THROW(mpi::io::hdf5_read("tout_relay_mpi_hdf5_not_shared.hdf5",
+                                    n_read,
+                                    MPI_COMM_WORLD),
+                 Error);
+
+    // the rank counts dataset name is reserved
+    n["conduit_rank_counts"] = 1;
+    EXPECT_THROW(mpi::io::hdf5_write(n,
+                                     "tout_relay_mpi_hdf5_errors.hdf5",
+                                     MPI_COMM_WORLD),
+                 Error);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+
+    return result;
+}
@@ -71,6 +71,172 @@ TEST(conduit_mpi_test, allreduce)
     EXPECT_EQ(n2["value"].as_int32(), 10);
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, reduce_mixed_types) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    Node n;
+    n["a"] = (int32)(rank + 1);
+    n["b"].set(DataType::float64(3));
+    n["c"] = (uint8)rank;
+    n["d"] = (int32)(rank * 2);
+    float64 *b_ptr = n["b"].value();
+    for(int i=0; i < 3; i++)
+    {
+        b_ptr[i] = rank * i;
+    }
+
+    int32   a_sum = 0;
+    int32   d_sum = 0;
+    float64 b_sum = 0.0;
+    for(int r=0; r < size; r++)
+    {
+        a_sum += r + 1;
+        d_sum += r * 2;
+        b_sum += r * 2;
+    }
+
+    // root is the last rank of a reversed communicator, which is 
+    // rank 0 in MPI_COMM_WORLD
+    MPI_Comm rev_comm;
+    MPI_Comm_split(MPI_COMM_WORLD, 0, size - rank, &rev_comm);
+
+    Node n_res;
+    mpi::reduce(n,n_res,MPI_SUM,size-1,rev_comm);
+    if(rank == 0)
+    {
+        EXPECT_EQ(n_res["a"].as_int32(),a_sum);
+        EXPECT_EQ(n_res["b"].as_float64_ptr()[2],b_sum);
+        EXPECT_EQ(n_res["c"].as_uint8(),(uint8)(size*(size-1)/2));
+        EXPECT_EQ(n_res["d"].as_int32(),d_sum);
+    }
+    else
+    {
+        EXPECT_TRUE(n_res.dtype().is_empty());
+    }
+    MPI_Comm_free(&rev_comm);
+
+    // compact recv nodes are reused
+    Node n_all;
+    mpi::all_reduce(n,n_all,MPI_MAX,MPI_COMM_WORLD);
+    void *all_ptr = n_all.data_ptr();
+    mpi::all_reduce(n,n_all,MPI_MAX,MPI_COMM_WORLD);
+    EXPECT_EQ(n_all.data_ptr(),all_ptr);
+    EXPECT_EQ(n_all["a"].as_int32(),size);
+    EXPECT_EQ(n_all["b"].as_float64_ptr()[1],(float64)(size-1));
+
+    // strided send node
+    float64 vals[6] = {(float64)rank, -1.0,
+                       (float64)rank, -1.0,
+                       (float64)rank, -1.0};
+    Node n_strided;
+    n_strided["vals"].set_external(DataType::float64(3,0,2*sizeof(float64)),
+                                   vals);
+    mpi::all_reduce(n_strided,n_all,MPI_MIN,MPI_COMM_WORLD);
+    EXPECT_EQ(n_all["vals"].dtype().number_of_elements(),3);
+    EXPECT_EQ(n_all["vals"].as_float64_ptr()[2],0.0);
+
+    // in place on a compact node
+    Node n_tmp;
+    n_tmp["x"] = (int64)rank;
+    n_tmp["y"] = (float32)1.0;
+    Node n_inplace;
+    n_tmp.compact_to(n_inplace);
+    void *inplace_ptr = n_inplace["x"].data_ptr();
+    mpi::all_reduce(n_inplace,n_inplace,MPI_SUM,MPI_COMM_WORLD);
+    EXPECT_EQ(n_inplace["x"].data_ptr(),inplace_ptr);
+    EXPECT_EQ(n_inplace["x"].as_int64(),(int64)(size*(size-1)/2));
+    EXPECT_EQ(n_inplace["y"].as_float32(),(float32)size);
+
+    // strings can't be reduced
+    Node n_str;
+    n_str["name"] = "value";
+    EXPECT_THROW(mpi::all_reduce(n_str,n_all,MPI_SUM,MPI_COMM_WORLD),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+// user op that sums int32 and float64 values
+//-----------------------------------------------------------------------------
+static void
+sum_int32_float64_op(void *in_vec,
+                     void *inout_vec,
+                     int *len,
+                     MPI_Datatype *dtype)
+{
+    for(int i=0; i < *len; i++)
+    {
+        if(*dtype == MPI_INT32_T)
+        {
+            ((int32*)inout_vec)[i] += ((int32*)in_vec)[i];
+        }
+        else if(*dtype == MPI_DOUBLE)
+        {
+            ((float64*)inout_vec)[i] += ((float64*)in_vec)[i];
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, reduce_ops) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    Node n;
+    n["a"] = (int32)(1 << rank);
+    n["b"] = (uint8)(1 << rank);
+    n["c"] = (float64)rank;
+
+    int32 all_bits = (1 << size) - 1;
+
+    // bitwise ops apply to the integer leaves of mixed trees
+    Node n_ints;
+    n_ints["a"] = n["a"];
+    n_ints["b"] = n["b"];
+    Node n_res;
+    mpi::all_reduce(n_ints,n_res,MPI_BOR,MPI_COMM_WORLD);
+    EXPECT_EQ(n_res["a"].as_int32(),all_bits);
+    EXPECT_EQ(n_res["b"].as_uint8(),(uint8)all_bits);
+
+    mpi::all_reduce(n,n_res,MPI_PROD,MPI_COMM_WORLD);
+    EXPECT_EQ(n_res["a"].as_int32(),(int32)(1 << (size*(size-1)/2)));
+    EXPECT_EQ(n_res["c"].as_float64(),0.0);
+
+    mpi::all_reduce(n,n_res,MPI_LOR,MPI_COMM_WORLD);
+    EXPECT_EQ(n_res["a"].as_int32(),1);
+    EXPECT_EQ(n_res["c"].as_float64(),size > 1 ? 1.0 : 0.0);
+
+    // ops that aren't predefined are applied per block of leaves 
+    // with the same type
+    MPI_Op user_op;
+    MPI_Op_create(sum_int32_float64_op,1,&user_op);
+    Node n_user;
+    n_user["a"] = (int32)rank;
+    n_user["c"] = (float64)rank;
+    mpi::all_reduce(n_user,n_res,user_op,MPI_COMM_WORLD);
+    EXPECT_EQ(n_res["a"].as_int32(),size*(size-1)/2);
+    EXPECT_EQ(n_res["c"].as_float64(),(float64)(size*(size-1)/2));
+    MPI_Op_free(&user_op);
+
+    // the overloads with an MPI datatype use it for all of the data
+    Node n_vals;
+    n_vals["a"] = (int32)rank;
+    n_vals["b"].set(DataType::int32(2));
+    n_vals["b"].as_int32_ptr()[1] = rank + 1;
+    mpi::all_reduce(n_vals,n_res,MPI_INT32_T,MPI_SUM,MPI_COMM_WORLD);
+    EXPECT_EQ(n_res["a"].as_int32(),size*(size-1)/2);
+    EXPECT_EQ(n_res["b"].as_int32_ptr()[1],size*(size+1)/2);
+
+    Node n_odd;
+    n_odd["a"].set(DataType::int8(3));
+    EXPECT_THROW(mpi::all_reduce(n_odd,n_res,MPI_INT32_T,MPI_SUM,
+                                 MPI_COMM_WORLD),
+                 conduit::Error);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_mpi_test, isend_irecv_wait) 
 {
@@ -307,6 +473,207 @@ TEST(conduit_mpi_test, gather_simple)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, send_recv) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    if(size < 2)
+    {
+        return;
+    }
+
+    if(rank == 0)
+    {
+        Node n;
+        n["a/b"] = (int32) 10;
+        n["a/c"].set(DataType::float64(3));
+        n["a/c"].as_float64_ptr()[2] = 3.5;
+        n["d"] = "my string";
+        n["e"].append().set((uint8)4);
+        // strided data is compacted before sending
+        int64 vals[4] = {1, -1, 2, -1};
+        n["f"].set_external(DataType::int64(2,0,16),vals);
+
+        mpi::send(n,1,0,MPI_COMM_WORLD);
+    }
+    else if(rank == 1)
+    {
+        Node n;
+        mpi::recv(n,0,0,MPI_COMM_WORLD);
+
+        EXPECT_EQ(n["a/b"].as_int32(),10);
+        EXPECT_EQ(n["a/c"].as_float64_ptr()[2],3.5);
+        EXPECT_EQ(n["d"].as_string(),"my string");
+        EXPECT_EQ(n["e"][0].as_uint8(),4);
+        EXPECT_EQ(n["f"].dtype().number_of_elements(),2);
+        EXPECT_EQ(n["f"].as_int64_ptr()[1],2);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, schema_protocol) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    EXPECT_EQ(mpi::schema_protocol(),"conduit_bin");
+    EXPECT_THROW(mpi::set_schema_protocol("conduit_yaml"),conduit::Error);
+    EXPECT_EQ(mpi::schema_protocol(),"conduit_bin");
+
+    // rank 0 sends json schemas, the others use the binary encoding
+    if(rank == 0)
+    {
+        mpi::set_schema_protocol("conduit_json");
+        EXPECT_EQ(mpi::schema_protocol(),"conduit_json");
+    }
+
+    Node n;
+    n["a/b"] = (int32) (10 + rank);
+    n["a/c"].set(DataType::float64(3));
+    n["a/c"].as_float64_ptr()[2] = 3.5;
+    n["d"].append().set((uint8)4);
+
+    if(size > 1)
+    {
+        // use a tag the other tests don't, so the schema is sent
+        if(rank == 0)
+        {
+            mpi::send(n,1,42,MPI_COMM_WORLD);
+        }
+        else if(rank == 1)
+        {
+            Node n_rcv;
+            mpi::recv(n_rcv,0,42,MPI_COMM_WORLD);
+            EXPECT_EQ(n_rcv["a/b"].as_int32(),10);
+            EXPECT_EQ(n_rcv["a/c"].as_float64_ptr()[2],3.5);
+            EXPECT_EQ(n_rcv["d"][0].as_uint8(),4);
+        }
+    }
+
+    Node rcv;
+    mpi::all_gatherv(n,rcv,MPI_COMM_WORLD);
+    EXPECT_EQ(rcv.number_of_children(),size);
+    for(int i=0; i < size; i++)
+    {
+        EXPECT_EQ(rcv[i]["a/b"].as_int32(),10 + i);
+        EXPECT_EQ(rcv[i]["a/c"].as_float64_ptr()[2],3.5);
+    }
+
+    mpi::set_schema_protocol("conduit_bin");
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, send_recv_data_strided) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    if(size < 2)
+    {
+        return;
+    }
+
+    // interleaved xyz on the sender, separate arrays on the receiver
+    index_t num_pts = 100;
+    std::vector<float64> xyz(num_pts*3,0.0);
+    std::vector<float64> x(num_pts,0.0);
+    std::vector<float64> y(num_pts,0.0);
+    std::vector<float64> z(num_pts,0.0);
+
+    Node n;
+    if(rank == 0)
+    {
+        for(index_t i=0; i < num_pts; i++)
+        {
+            xyz[i*3]   = i;
+            xyz[i*3+1] = 10.0 * i;
+            xyz[i*3+2] = 100.0 * i;
+        }
+        n["id"] = (int32) 42;
+        n["x"].set_external(DataType::float64(num_pts,0,24),&xyz[0]);
+        n["y"].set_external(DataType::float64(num_pts,8,24),&xyz[0]);
+        n["z"].set_external(DataType::float64(num_pts,16,24),&xyz[0]);
+
+        mpi::send_data(n,1,0,MPI_COMM_WORLD);
+    }
+    else if(rank == 1)
+    {
+        n["id"] = (int32) 0;
+        n["x"].set_external(x);
+        n["y"].set_external(y);
+        n["z"].set_external(z);
+
+        mpi::recv_data(n,0,0,MPI_COMM_WORLD);
+
+        EXPECT_EQ(n["id"].as_int32(),42);
+        for(index_t i=0; i < num_pts; i++)
+        {
+            EXPECT_EQ(x[i],(float64)i);
+            EXPECT_EQ(y[i],10.0 * i);
+            EXPECT_EQ(z[i],100.0 * i);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, send_recv_schema_cache) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    if(size < 2)
+    {
+        return;
+    }
+
+    Node n;
+    void *rcv_data_ptr = NULL;
+
+    for(int i=0; i < 6; i++)
+    {
+        // the layout changes on the 4th exchange
+        if(rank == 0)
+        {
+            n.reset();
+            n["cycle"] = (int32) i;
+            n["fields/p"].set(DataType::float64(4));
+            n["fields/p"].as_float64_ptr()[3] = 1.5 * i;
+            if(i >= 3)
+            {
+                n["fields/q"] = (int64) (10 * i);
+            }
+            mpi::send(n,1,0,MPI_COMM_WORLD);
+            // a second tag keeps its own cache entry
+            mpi::send(n["fields"],1,1,MPI_COMM_WORLD);
+        }
+        else if(rank == 1)
+        {
+            Node n_fields;
+            // receive in the opposite order on purpose
+            mpi::recv(n_fields,0,1,MPI_COMM_WORLD);
+            mpi::recv(n,0,0,MPI_COMM_WORLD);
+
+            EXPECT_EQ(n["cycle"].as_int32(),i);
+            EXPECT_EQ(n["fields/p"].as_float64_ptr()[3],1.5 * i);
+            EXPECT_EQ(n_fields["p"].as_float64_ptr()[3],1.5 * i);
+            EXPECT_EQ(n.has_path("fields/q"), i >= 3);
+            if(i >= 3)
+            {
+                EXPECT_EQ(n["fields/q"].as_int64(),10 * i);
+            }
+
+            // the node tree is reused while the layout is unchanged
+            if(i == 1 || i == 2 || i == 4 || i == 5)
+            {
+                EXPECT_EQ(n.data_ptr(),rcv_data_ptr);
+            }
+            rcv_data_ptr = n.data_ptr();
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_mpi_test, gatherv_simple) 
 {
@@ -380,6 +747,395 @@ TEST(conduit_mpi_test, allgatherv_simple)
 
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, igather_simple) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    Node n;
+    n["values/a"] = rank+1;
+    n["values/b"] = rank+2;
+
+    Node rcv;
+    Node all_rcv;
+    mpi::ConduitMPIGatherRequest req;
+    mpi::ConduitMPIGatherRequest all_req;
+    mpi::igather(n,rcv,0,MPI_COMM_WORLD,&req);
+    mpi::iall_gather(n,all_rcv,MPI_COMM_WORLD,&all_req);
+
+    // the send node's data was copied, changing it must not 
+    // change the result
+    n["values/a"] = -1;
+
+    mpi::wait_gather(&req, MPI_STATUS_IGNORE);
+    mpi::wait_gather(&all_req, MPI_STATUS_IGNORE);
+    EXPECT_TRUE(req._externalData == NULL);
+
+    if(rank == 0)
+    {
+        EXPECT_EQ(rcv.number_of_children(),size);
+        for(int i=0; i < size; i++)
+        {
+            EXPECT_EQ(rcv[i]["values/a"].as_int(),i+1);
+            EXPECT_EQ(rcv[i]["values/b"].as_int(),i+2);
+        }
+    }
+
+    EXPECT_EQ(all_rcv.number_of_children(),size);
+    for(int i=0; i < size; i++)
+    {
+        EXPECT_EQ(all_rcv[i]["values/a"].as_int(),i+1);
+        EXPECT_EQ(all_rcv[i]["values/b"].as_int(),i+2);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, igatherv_simple) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    Node n;
+    n["values/a"] = rank+1;
+    n["values/b"] = rank+2;
+    n["values/c"] = rank+3;
+    if(rank != 0)
+    {
+        n["values/d"] = rank+4;
+    }
+
+    Node rcv;
+    mpi::ConduitMPIGatherRequest req;
+    mpi::igatherv(n,rcv,0,MPI_COMM_WORLD,&req);
+
+    // other collectives on the communicator may run while the 
+    // gather is pending
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    int flag = 0;
+    while(!flag)
+    {
+        mpi::test_gather(&req, &flag, MPI_STATUS_IGNORE);
+    }
+
+    if(rank == 0)
+    {
+        EXPECT_EQ(rcv.number_of_children(),size);
+        EXPECT_EQ(rcv[0].number_of_children(),1);
+        EXPECT_EQ(rcv[0]["values"].number_of_children(),3);
+        EXPECT_EQ(rcv[0]["values/c"].as_int(),3);
+        for(int i=1; i < size; i++)
+        {
+            EXPECT_EQ(rcv[i]["values"].number_of_children(),4);
+            EXPECT_EQ(rcv[i]["values/a"].as_int(),i+1);
+            EXPECT_EQ(rcv[i]["values/d"].as_int(),i+4);
+        }
+        EXPECT_TRUE(rcv.is_compact());
+    }
+    else
+    {
+        EXPECT_TRUE(rcv.dtype().is_empty());
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, iall_gatherv_wait_all) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    Node n_a;
+    n_a["values"].set(DataType::float64(rank+1));
+    float64 *a_ptr = n_a["values"].value();
+    for(int i=0; i <= rank; i++)
+    {
+        a_ptr[i] = rank;
+    }
+
+    Node n_b;
+    n_b["rank"] = rank;
+
+    Node rcv_a;
+    Node rcv_b;
+    mpi::ConduitMPIGatherRequest reqs[2];
+    MPI_Status statuses[2];
+    mpi::iall_gatherv(n_a,rcv_a,MPI_COMM_WORLD,&reqs[0]);
+    mpi::igatherv(n_b,rcv_b,size-1,MPI_COMM_WORLD,&reqs[1]);
+
+    mpi::wait_all_gather(2,reqs,statuses);
+
+    EXPECT_EQ(rcv_a.number_of_children(),size);
+    for(int i=0; i < size; i++)
+    {
+        Node &vals = rcv_a[i]["values"];
+        EXPECT_EQ(vals.dtype().number_of_elements(),i+1);
+        EXPECT_EQ(vals.as_float64_ptr()[i],(float64)i);
+    }
+
+    if(rank == size-1)
+    {
+        EXPECT_EQ(rcv_b.number_of_children(),size);
+        for(int i=0; i < size; i++)
+        {
+            EXPECT_EQ(rcv_b[i]["rank"].as_int(),i);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, gatherv_schema_cache) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    Node rcv;
+    Node all_rcv;
+    void *all_rcv_data_ptr = NULL;
+
+    for(int i=0; i < 4; i++)
+    {
+        Node n;
+        n["values/a"] = rank + i;
+        // only rank 0's layout changes, on the 3rd exchange
+        if(rank == 0 && i >= 2)
+        {
+            n["values/b"] = rank + i + 1;
+        }
+
+        mpi::gatherv(n,rcv,0,MPI_COMM_WORLD);
+        mpi::all_gatherv(n,all_rcv,MPI_COMM_WORLD);
+
+        if(rank == 0)
+        {
+            EXPECT_EQ(rcv.number_of_children(),size);
+            EXPECT_EQ(rcv[0]["values/a"].to_int(),i);
+            EXPECT_EQ(rcv[0].has_path("values/b"), i >= 2);
+            EXPECT_EQ(rcv[size-1]["values/a"].to_int(),size-1+i);
+        }
+
+        EXPECT_EQ(all_rcv.number_of_children(),size);
+        EXPECT_EQ(all_rcv[size-1]["values/a"].to_int(),size-1+i);
+        EXPECT_EQ(all_rcv[0].has_path("values/b"), i >= 2);
+
+        if(i == 1 || i == 3)
+        {
+            EXPECT_EQ(all_rcv.data_ptr(),all_rcv_data_ptr);
+        }
+        all_rcv_data_ptr = all_rcv.data_ptr();
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, broadcast) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+    int root = size-1;
+
+    Node n;
+    void *data_ptr = NULL;
+
+    for(int i=0; i < 3; i++)
+    {
+        if(rank == root)
+        {
+            n["values/a"].set(DataType::float64(4));
+            float64 *a_ptr = n["values/a"].value();
+            for(int j=0; j < 4; j++)
+            {
+                a_ptr[j] = j + i;
+            }
+            n["name"] = "bcast";
+            // change the layout on the last broadcast
+            if(i == 2)
+            {
+                n["values/b"] = (int64)i;
+            }
+        }
+
+        mpi::broadcast(n,root,MPI_COMM_WORLD);
+
+        EXPECT_EQ(n["values/a"].dtype().number_of_elements(),4);
+        EXPECT_EQ(n["values/a"].as_float64_ptr()[3],(float64)(3+i));
+        EXPECT_EQ(n["name"].as_string(),"bcast");
+        EXPECT_EQ(n.has_path("values/b"), i == 2);
+
+        // the second broadcast has the same layout, so it is
+        // received in place
+        if(rank != root && i == 1)
+        {
+            EXPECT_EQ(n["values/a"].data_ptr(),data_ptr);
+        }
+        data_ptr = n["values/a"].data_ptr();
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, scatter) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    Node n_snd;
+    if(rank == 0)
+    {
+        for(int i=0; i < size; i++)
+        {
+            Node &dest = n_snd.append();
+            dest["rank"] = (int32)i;
+            dest["vals"].set(DataType::float64(2));
+            float64 *vals_ptr = dest["vals"].value();
+            vals_ptr[0] = i;
+            vals_ptr[1] = i * 10;
+        }
+    }
+
+    Node n_rcv;
+    mpi::scatter(n_snd,n_rcv,0,MPI_COMM_WORLD);
+    EXPECT_EQ(n_rcv["rank"].as_int32(),rank);
+    EXPECT_EQ(n_rcv["vals"].as_float64_ptr()[1],(float64)(rank*10));
+
+    // varying schemas: each rank gets rank+1 values
+    if(rank == 0)
+    {
+        n_snd.reset();
+        for(int i=0; i < size; i++)
+        {
+            Node &dest = n_snd.append();
+            dest["vals"].set(DataType::int64(i+1));
+            int64 *vals_ptr = dest["vals"].value();
+            for(int j=0; j <= i; j++)
+            {
+                vals_ptr[j] = i;
+            }
+        }
+    }
+
+    for(int i=0; i < 2; i++)
+    {
+        mpi::scatterv(n_snd,n_rcv,0,MPI_COMM_WORLD);
+        EXPECT_EQ(n_rcv["vals"].dtype().number_of_elements(),rank+1);
+        EXPECT_EQ(n_rcv["vals"].as_int64_ptr()[rank],rank);
+        EXPECT_FALSE(n_rcv.has_path("rank"));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, all_to_all) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    Node n_snd;
+    for(int i=0; i < size; i++)
+    {
+        n_snd.append()["src_dest"] = (int32)(rank * 100 + i);
+    }
+
+    Node n_rcv;
+    mpi::all_to_all(n_snd,n_rcv,MPI_COMM_WORLD);
+    EXPECT_EQ(n_rcv.number_of_children(),size);
+    for(int i=0; i < size; i++)
+    {
+        EXPECT_EQ(n_rcv[i]["src_dest"].as_int32(),i * 100 + rank);
+    }
+
+    // varying schemas: rank r sends r+1 values to each rank
+    void *data_ptr = NULL;
+    for(int s=0; s < 3; s++)
+    {
+        n_snd.reset();
+        for(int i=0; i < size; i++)
+        {
+            Node &dest = n_snd.append();
+            dest["vals"].set(DataType::float32(rank+1));
+            float32 *vals_ptr = dest["vals"].value();
+            vals_ptr[rank] = (float32)(rank * 100 + i + s);
+            // only the child for rank 0 changes on the last step
+            if(s == 2 && i == 0)
+            {
+                dest["extra"] = (int8)1;
+            }
+        }
+
+        mpi::all_to_allv(n_snd,n_rcv,MPI_COMM_WORLD);
+
+        EXPECT_EQ(n_rcv.number_of_children(),size);
+        for(int i=0; i < size; i++)
+        {
+            Node &vals = n_rcv[i]["vals"];
+            EXPECT_EQ(vals.dtype().number_of_elements(),i+1);
+            EXPECT_EQ(vals.as_float32_ptr()[i],(float32)(i * 100 + rank + s));
+            EXPECT_EQ(n_rcv[i].has_path("extra"), s == 2 && rank == 0);
+        }
+
+        if(s == 1)
+        {
+            EXPECT_EQ(n_rcv.data_ptr(),data_ptr);
+        }
+        data_ptr = n_rcv.data_ptr();
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, scatter_all_to_all_errors) 
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int size = mpi::size(MPI_COMM_WORLD);
+
+    // too few children on root, every rank throws
+    Node n_snd;
+    Node n_rcv;
+    if(rank == 0)
+    {
+        n_snd.append() = (int32)0;
+    }
+    EXPECT_THROW(mpi::scatter(n_snd,n_rcv,0,MPI_COMM_WORLD),conduit::Error);
+    EXPECT_THROW(mpi::scatterv(n_snd,n_rcv,0,MPI_COMM_WORLD),conduit::Error);
+
+    // children with different schemas
+    if(rank == 0)
+    {
+        n_snd.reset();
+        for(int i=0; i < size; i++)
+        {
+            n_snd.append().set(DataType::int32(i+1));
+        }
+    }
+    EXPECT_THROW(mpi::scatter(n_snd,n_rcv,0,MPI_COMM_WORLD),conduit::Error);
+
+    // one rank has a bad send node
+    n_snd.reset();
+    for(int i=0; i < size; i++)
+    {
+        n_snd.append() = (int32)i;
+    }
+    if(rank == size - 1)
+    {
+        n_snd.append() = (int32)0;
+    }
+    EXPECT_THROW(mpi::all_to_all(n_snd,n_rcv,MPI_COMM_WORLD),conduit::Error);
+    EXPECT_THROW(mpi::all_to_allv(n_snd,n_rcv,MPI_COMM_WORLD),conduit::Error);
+
+    // ranks send different schemas
+    n_snd.reset();
+    for(int i=0; i < size; i++)
+    {
+        n_snd.append().set(DataType::int32(rank+1));
+    }
+    EXPECT_THROW(mpi::all_to_all(n_snd,n_rcv,MPI_COMM_WORLD),conduit::Error);
+
+    // collectives still work after the errors
+    n_snd.reset();
+    for(int i=0; i < size; i++)
+    {
+        n_snd.append() = (int32)(rank * 100 + i);
+    }
+    mpi::all_to_all(n_snd,n_rcv,MPI_COMM_WORLD);
+    EXPECT_EQ(n_rcv[0].as_int32(),rank);
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
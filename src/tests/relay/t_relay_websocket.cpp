@@ -52,6 +52,12 @@
 #include <iostream>
 #include "gtest/gtest.h"
 
+#include "civetweb.h"
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+#include <pthread.h>
+#endif
+
 #include "t_config.hpp"
 
 using namespace conduit;
@@ -146,12 +152,301 @@ TEST(conduit_relay_web_websocket, websocket_test)
         svr.websocket()->send(msg);
         // or with a very short timeout
         //svr.websocket(10,100)->send(msg);
+        // or send to all active websockets
+        //svr.broadcast(msg);
         
         msg["count"] = msg["count"].to_int64() + 1;
     }
 }
 
 
+//-----------------------------------------------------------------------------
+// loads a "conduit_sbin" websocket message via a file
+//-----------------------------------------------------------------------------
+void
+load_sbin_msg(const std::vector<uint8> &msg,
+              Node &res)
+{
+    std::string path = "tout_relay_websocket_delta_msg.conduit_sbin";
+    std::ofstream ofs(path.c_str(), std::ios::binary);
+    ofs.write((const char*)&msg[0],(std::streamsize)msg.size());
+    ofs.close();
+    res.reset();
+    res.load(path);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web_websocket, delta_encoder)
+{
+    Node n;
+    n["state/count"] = (int64)0;
+    n["state/vals"].set(DataType::float64(1000));
+    n["meshes"].append()["name"] = "a";
+    n["meshes"].append()["name"] = "b";
+
+    web::DeltaEncoder enc;
+    std::vector<uint8> msg;
+    Node n_msg;
+
+    // first message is a full message
+    EXPECT_TRUE(enc.encode(n,msg));
+    size_t full_bytes = msg.size();
+    load_sbin_msg(msg,n_msg);
+    EXPECT_EQ(n_msg["delta"].to_int(),0);
+    EXPECT_EQ(n_msg["data/state/vals"].dtype().number_of_elements(),1000);
+    EXPECT_EQ(n_msg["data/meshes"][1]["name"].as_string(),"b");
+
+    // nothing changed
+    EXPECT_FALSE(enc.encode(n,msg));
+
+    // only the count changed
+    n["state/count"] = (int64)1;
+    EXPECT_TRUE(enc.encode(n,msg));
+    EXPECT_TRUE(msg.size() < full_bytes);
+    load_sbin_msg(msg,n_msg);
+    EXPECT_EQ(n_msg["delta"].to_int(),1);
+    EXPECT_EQ(n_msg["leaves"].dtype().number_of_elements(),1);
+    EXPECT_EQ(n_msg["leaves"].as_uint64_ptr()[0],0);
+    EXPECT_EQ(n_msg["data"][0].as_int64(),1);
+
+    // leaves in lists are addressed by their depth first index
+    n["meshes"][1]["name"] = "c";
+    n["state/count"] = (int64)2;
+    EXPECT_TRUE(enc.encode(n,msg));
+    load_sbin_msg(msg,n_msg);
+    EXPECT_EQ(n_msg["leaves"].dtype().number_of_elements(),2);
+    EXPECT_EQ(n_msg["leaves"].as_uint64_ptr()[1],3);
+    EXPECT_EQ(n_msg["data"][1].as_string(),"c");
+
+    // layout changes send a full message
+    n["state/extra"] = (int32)5;
+    EXPECT_TRUE(enc.encode(n,msg));
+    load_sbin_msg(msg,n_msg);
+    EXPECT_EQ(n_msg["delta"].to_int(),0);
+    EXPECT_EQ(n_msg["data/state/extra"].as_int32(),5);
+
+    enc.reset();
+    EXPECT_TRUE(enc.encode(n,msg));
+    load_sbin_msg(msg,n_msg);
+    EXPECT_EQ(n_msg["delta"].to_int(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web_websocket, broadcast_stats)
+{
+    web::WebServer svr;
+    svr.set_port(8082);
+    svr.set_document_root(web::web_client_root_directory());
+    svr.set_websocket_queue_depth(0);
+    // depth is at least one
+    EXPECT_EQ(svr.websocket_queue_depth(),1);
+    svr.set_websocket_queue_depth(2);
+
+    Node msg;
+    msg["count"] = 0;
+
+    Node stats;
+    // no server yet
+    EXPECT_EQ(svr.broadcast(msg),0);
+    svr.websocket_stats(stats);
+    EXPECT_EQ(stats["connections"].to_int64(),0);
+
+    svr.serve();
+
+    // no clients
+    EXPECT_EQ(svr.broadcast(msg),0);
+    EXPECT_EQ(svr.broadcast(msg,"conduit_sbin"),0);
+    EXPECT_EQ(svr.broadcast(msg,"conduit_sbin_delta"),0);
+
+    svr.websocket_stats(stats);
+    EXPECT_EQ(stats["connections"].to_int64(),0);
+    EXPECT_EQ(stats["queued"].to_int64(),0);
+    EXPECT_EQ(stats["bytes_sent"].to_int64(),0);
+    EXPECT_EQ(stats["websockets"].number_of_children(),0);
+
+    svr.shutdown();
+}
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+//-----------------------------------------------------------------------------
+// websocket client that can stall its reader, used to back up the
+// server's send queue
+//-----------------------------------------------------------------------------
+struct StallingClient
+{
+    pthread_mutex_t                  mutex;
+    bool                             hold;
+    index_t                          num_received;
+    std::vector< std::vector<uint8> > binary_msgs;
+};
+
+//-----------------------------------------------------------------------------
+int
+stalling_client_data(mg_connection *conn,
+                     int flags,
+                     char *data,
+                     size_t data_len,
+                     void *) // user_data
+{
+    // civetweb passes the client's user data via the connection's context
+    StallingClient *client = (StallingClient*)
+                                mg_get_user_data(mg_get_context(conn));
+    int opcode = flags & 0xf;
+
+    if(opcode != WEBSOCKET_OPCODE_TEXT && opcode != WEBSOCKET_OPCODE_BINARY)
+    {
+        return 1;
+    }
+
+    pthread_mutex_lock(&client->mutex);
+    client->num_received++;
+    // keep the small binary messages to check the deltas
+    if(opcode == WEBSOCKET_OPCODE_BINARY && data_len < 4096)
+    {
+        client->binary_msgs.push_back(std::vector<uint8>(data,
+                                                         data + data_len));
+    }
+    pthread_mutex_unlock(&client->mutex);
+
+    // stop reading until released
+    bool hold = true;
+    while(hold)
+    {
+        pthread_mutex_lock(&client->mutex);
+        hold = client->hold;
+        pthread_mutex_unlock(&client->mutex);
+        if(hold)
+        {
+            utils::sleep(1);
+        }
+    }
+
+    return 1;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+stalling_client_num_received(StallingClient &client)
+{
+    pthread_mutex_lock(&client.mutex);
+    index_t res = client.num_received;
+    pthread_mutex_unlock(&client.mutex);
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+bool
+stalling_client_wait(StallingClient &client,
+                     index_t num_msgs)
+{
+    for(int i=0; i < 20000; i++)
+    {
+        if(stalling_client_num_received(client) >= num_msgs)
+        {
+            return true;
+        }
+        utils::sleep(1);
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web_websocket, send_queue_drops)
+{
+    web::WebServer svr;
+    svr.set_port(8083);
+    svr.set_document_root(web::web_client_root_directory());
+    svr.serve();
+
+    StallingClient client;
+    pthread_mutex_init(&client.mutex,NULL);
+    client.hold = true;
+    client.num_received = 0;
+
+    char err[256];
+    mg_connection *conn = mg_connect_websocket_client("localhost",
+                                                      8083,
+                                                      0,
+                                                      err,
+                                                      sizeof(err),
+                                                      "/websocket",
+                                                      NULL,
+                                                      stalling_client_data,
+                                                      NULL,
+                                                      &client);
+    ASSERT_TRUE(conn != NULL);
+
+    web::WebSocket *wsock = svr.websocket(10,10000);
+    ASSERT_TRUE(wsock != NULL);
+    wsock->set_queue_depth(2);
+    EXPECT_EQ(wsock->queue_depth(),2);
+
+    Node msg;
+    msg["count"] = (int64) 0;
+
+    // the first message stalls the client's reader
+    wsock->send(msg);
+    EXPECT_TRUE(stalling_client_wait(client,1));
+
+    // a message larger than the socket buffers blocks the writer thread
+    Node big;
+    big["vals"].set(DataType::uint8(64 * 1024 * 1024));
+    wsock->send(big,"conduit_sbin");
+    for(int i=0; i < 10000 && wsock->number_of_queued_messages() > 0; i++)
+    {
+        utils::sleep(1);
+    }
+    EXPECT_EQ(wsock->number_of_queued_messages(),0);
+
+    // a full queue drops the oldest message
+    wsock->send(msg);
+    wsock->send(msg);
+    wsock->send(msg);
+    EXPECT_EQ(wsock->number_of_queued_messages(),2);
+
+    // the first delta is a full message
+    wsock->send(msg,"conduit_sbin_delta");
+    EXPECT_EQ(wsock->number_of_queued_messages(),2);
+
+    // making room for a non-delta message drops every queued message 
+    // once a delta is queued
+    wsock->send(msg,"conduit_sbin");
+    EXPECT_EQ(wsock->number_of_queued_messages(),1);
+
+    // the client never sees the dropped delta, so the next delta must
+    // carry the full node
+    msg["count"] = (int64) 1;
+    wsock->send(msg,"conduit_sbin_delta");
+    EXPECT_EQ(wsock->number_of_queued_messages(),2);
+
+    Node stats;
+    wsock->stats(stats);
+    EXPECT_EQ(stats["queue_depth"].to_int64(),2);
+    EXPECT_EQ(stats["max_queued"].to_int64(),2);
+    EXPECT_EQ(stats["messages_dropped"].to_int64(),4);
+
+    // let the client catch up: first, big, sbin and delta messages
+    pthread_mutex_lock(&client.mutex);
+    client.hold = false;
+    pthread_mutex_unlock(&client.mutex);
+    EXPECT_TRUE(stalling_client_wait(client,4));
+
+    pthread_mutex_lock(&client.mutex);
+    std::vector< std::vector<uint8> > binary_msgs = client.binary_msgs;
+    pthread_mutex_unlock(&client.mutex);
+
+    ASSERT_EQ(binary_msgs.size(),2u);
+    Node n_msg;
+    load_sbin_msg(binary_msgs[1],n_msg);
+    EXPECT_EQ(n_msg["delta"].to_int(),0);
+    EXPECT_EQ(n_msg["data/count"].to_int64(),1);
+
+    mg_close_connection(conn);
+    svr.shutdown();
+    pthread_mutex_destroy(&client.mutex);
+}
+#endif
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {